@@ -80,9 +80,9 @@ static inline void fetch_ea_32_long(uint32_t rmdat)
         if (easeg != 0xFFFFFFFF && ((easeg + cpu_state.eaaddr) & 0xFFF) <= 0xFFC)
         {
 		uint32_t addr = easeg + cpu_state.eaaddr;
-                if ( readlookup2[addr >> 12] != -1)
+                if ( readlookup2[addr >> 12] != LOOKUP_INV)
                 	eal_r = (uint32_t *)(readlookup2[addr >> 12] + addr);
-                if (writelookup2[addr >> 12] != -1)
+                if (writelookup2[addr >> 12] != LOOKUP_INV)
                 	eal_w = (uint32_t *)(writelookup2[addr >> 12] + addr);
         }
 }
@@ -120,9 +120,9 @@ static inline void fetch_ea_16_long(uint32_t rmdat)
         if (easeg != 0xFFFFFFFF && ((easeg + cpu_state.eaaddr) & 0xFFF) <= 0xFFC)
         {
 		uint32_t addr = easeg + cpu_state.eaaddr;
-                if ( readlookup2[addr >> 12] != -1)
+                if ( readlookup2[addr >> 12] != LOOKUP_INV)
                 	eal_r = (uint32_t *)(readlookup2[addr >> 12] + addr);
-                if (writelookup2[addr >> 12] != -1)
+                if (writelookup2[addr >> 12] != LOOKUP_INV)
                 	eal_w = (uint32_t *)(writelookup2[addr >> 12] + addr);
         }
 }
@@ -215,57 +215,23 @@ void exec386(int cycs)
                         }
                 }
 
-                if (cpu_state.smi_pending)
+                /*Each of the events below needs at least one of these to be set,
+                  so test them together and skip the whole chain in the common
+                  case where nothing is pending*/
+                if (cpu_state.smi_pending | trap | nmi | pic_intpending)
                 {
-                        cpu_state.smi_pending = 0;
-                        x86_smi_enter();
-                }
-                else if (trap)
-                {
-                        flags_rebuild();
-//                        oldpc=pc;
-                        if (msw&1)
+                        if (cpu_state.smi_pending)
                         {
-                                pmodeint(1,0);
+                                cpu_state.smi_pending = 0;
+                                x86_smi_enter();
                         }
-                        else
-                        {
-                                writememw(ss,(SP-2)&0xFFFF,cpu_state.flags);
-                                writememw(ss,(SP-4)&0xFFFF,CS);
-                                writememw(ss,(SP-6)&0xFFFF,cpu_state.pc);
-                                SP-=6;
-                                addr = (1 << 2) + idt.base;
-                                cpu_state.flags &= ~I_FLAG;
-                                cpu_state.flags &= ~T_FLAG;
-                                cpu_state.pc=readmemw(0,addr);
-                                loadcs(readmemw(0,addr+2));
-                        }
-                }
-                else if (nmi && nmi_enable && nmi_mask)
-                {
-                        cpu_state.oldpc = cpu_state.pc;
-//                        pclog("NMI\n");
-                        x86_int(2);
-                        nmi_enable = 0;
-                        if (nmi_auto_clear)
+                        else if (trap)
                         {
-                                nmi_auto_clear = 0;
-                                nmi = 0;
-                        }
-                }
-                else if ((cpu_state.flags & I_FLAG) && pic_intpending)
-                {
-                        temp=picinterrupt();
-                        if (temp!=0xFF)
-                        {
-//                                if (temp == 0x54) pclog("Take int 54\n");
-//                                if (output) output=3;
-//                                if (temp == 0xd) pclog("Hardware int %02X %i %04X(%08X):%08X\n",temp,ins, CS,cs,pc);
-//                                if (temp==0x54) output=3;
                                 flags_rebuild();
+//                        oldpc=pc;
                                 if (msw&1)
                                 {
-                                        pmodeint(temp,0);
+                                        pmodeint(1,0);
                                 }
                                 else
                                 {
@@ -273,14 +239,54 @@ void exec386(int cycs)
                                         writememw(ss,(SP-4)&0xFFFF,CS);
                                         writememw(ss,(SP-6)&0xFFFF,cpu_state.pc);
                                         SP-=6;
-                                        addr = (temp << 2) + idt.base;
+                                        addr = (1 << 2) + idt.base;
                                         cpu_state.flags &= ~I_FLAG;
                                         cpu_state.flags &= ~T_FLAG;
                                         cpu_state.pc=readmemw(0,addr);
                                         loadcs(readmemw(0,addr+2));
-//                                        if (temp==0x76) pclog("INT to %04X:%04X\n",CS,pc);
                                 }
+                        }
+                        else if (nmi && nmi_enable && nmi_mask)
+                        {
+                                cpu_state.oldpc = cpu_state.pc;
+//                        pclog("NMI\n");
+                                x86_int(2);
+                                nmi_enable = 0;
+                                if (nmi_auto_clear)
+                                {
+                                        nmi_auto_clear = 0;
+                                        nmi = 0;
+                                }
+                        }
+                        else if ((cpu_state.flags & I_FLAG) && pic_intpending)
+                        {
+                                temp=picinterrupt();
+                                if (temp!=0xFF)
+                                {
+//                                if (temp == 0x54) pclog("Take int 54\n");
+//                                if (output) output=3;
+//                                if (temp == 0xd) pclog("Hardware int %02X %i %04X(%08X):%08X\n",temp,ins, CS,cs,pc);
+//                                if (temp==0x54) output=3;
+                                        flags_rebuild();
+                                        if (msw&1)
+                                        {
+                                                pmodeint(temp,0);
+                                        }
+                                        else
+                                        {
+                                                writememw(ss,(SP-2)&0xFFFF,cpu_state.flags);
+                                                writememw(ss,(SP-4)&0xFFFF,CS);
+                                                writememw(ss,(SP-6)&0xFFFF,cpu_state.pc);
+                                                SP-=6;
+                                                addr = (temp << 2) + idt.base;
+                                                cpu_state.flags &= ~I_FLAG;
+                                                cpu_state.flags &= ~T_FLAG;
+                                                cpu_state.pc=readmemw(0,addr);
+                                                loadcs(readmemw(0,addr+2));
+//                                        if (temp==0x76) pclog("INT to %04X:%04X\n",CS,pc);
+                                        }
 //                                pclog("Now at %04X(%08X):%08X\n", CS, cs, pc);
+                                }
                         }
                 }
 
@@ -10,6 +10,7 @@
 #include "codegen_backend.h"
 #include "cpu.h"
 #include "fdc.h"
+#include "io.h"
 #include "nmi.h"
 #include "pic.h"
 #include "timer.h"
@@ -89,9 +90,9 @@ static inline void fetch_ea_32_long(uint32_t rmdat)
         if (easeg != 0xFFFFFFFF && ((easeg + cpu_state.eaaddr) & 0xFFF) <= 0xFFC)
         {
                 uint32_t addr = easeg + cpu_state.eaaddr;
-                if ( readlookup2[addr >> 12] != -1)
+                if ( readlookup2[addr >> 12] != LOOKUP_INV)
                    eal_r = (uint32_t *)(readlookup2[addr >> 12] + addr);
-                if (writelookup2[addr >> 12] != -1)
+                if (writelookup2[addr >> 12] != LOOKUP_INV)
                    eal_w = (uint32_t *)(writelookup2[addr >> 12] + addr);
         }
 }
@@ -129,9 +130,9 @@ static inline void fetch_ea_16_long(uint32_t rmdat)
         if (easeg != 0xFFFFFFFF && ((easeg + cpu_state.eaaddr) & 0xFFF) <= 0xFFC)
         {
                 uint32_t addr = easeg + cpu_state.eaaddr;
-                if ( readlookup2[addr >> 12] != -1)
+                if ( readlookup2[addr >> 12] != LOOKUP_INV)
                    eal_r = (uint32_t *)(readlookup2[addr >> 12] + addr);
-                if (writelookup2[addr >> 12] != -1)
+                if (writelookup2[addr >> 12] != LOOKUP_INV)
                    eal_w = (uint32_t *)(writelookup2[addr >> 12] + addr);
         }
 }
@@ -376,9 +377,17 @@ static inline void exec_recompiler(void)
                 {
                         block->flags &= ~CODEBLOCK_WAS_RECOMPILED;
                         if (block->flags & CODEBLOCK_BYTE_MASK)
-                                block->flags |= CODEBLOCK_NO_IMMEDIATES;
+                        {
+                                /*Only stop inlining immediates if that is all
+                                  that was written to. Fetching them from memory
+                                  won't help a block whose opcodes are being
+                                  modified*/
+                                if (block->flags & CODEBLOCK_IMM_DIRTY)
+                                        block->flags |= CODEBLOCK_NO_IMMEDIATES;
+                        }
                         else
                                 block->flags |= CODEBLOCK_BYTE_MASK;
+                        block->flags &= ~CODEBLOCK_IMM_DIRTY;
                 }
                 if (valid_block && (block->flags & CODEBLOCK_WAS_RECOMPILED) && (block->flags & CODEBLOCK_STATIC_TOP) && block->TOP != (cpu_state.TOP & 7))
                 {
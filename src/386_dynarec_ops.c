@@ -8,6 +8,7 @@
 #include "nmi.h"
 #include "pic.h"
 #include "codegen.h"
+#include "io.h"
 
 #define CPU_BLOCK_END() cpu_block_end = 1
 
@@ -21,9 +22,9 @@ static inline void fetch_ea_32_long(uint32_t rmdat)
         if (easeg != 0xFFFFFFFF && ((easeg + cpu_state.eaaddr) & 0xFFF) <= 0xFFC)
         {
                 uint32_t addr = easeg + cpu_state.eaaddr;
-                if ( readlookup2[addr >> 12] != -1)
+                if ( readlookup2[addr >> 12] != LOOKUP_INV)
                    eal_r = (uint32_t *)(readlookup2[addr >> 12] + addr);
-                if (writelookup2[addr >> 12] != -1)
+                if (writelookup2[addr >> 12] != LOOKUP_INV)
                    eal_w = (uint32_t *)(writelookup2[addr >> 12] + addr);
         }
 }
@@ -35,9 +36,9 @@ static inline void fetch_ea_16_long(uint32_t rmdat)
         if (easeg != 0xFFFFFFFF && ((easeg + cpu_state.eaaddr) & 0xFFF) <= 0xFFC)
         {
                 uint32_t addr = easeg + cpu_state.eaaddr;
-                if ( readlookup2[addr >> 12] != -1)
+                if ( readlookup2[addr >> 12] != LOOKUP_INV)
                    eal_r = (uint32_t *)(readlookup2[addr >> 12] + addr);
-                if (writelookup2[addr >> 12] != -1)
+                if (writelookup2[addr >> 12] != LOOKUP_INV)
                    eal_w = (uint32_t *)(writelookup2[addr >> 12] + addr);
         }
 }
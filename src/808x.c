@@ -54,20 +54,20 @@ static void FETCHCOMPLETE();
 static uint8_t readmemb(uint32_t a)
 {
         if (a!=(cs+cpu_state.pc)) memcycs+=4;
-        if (readlookup2[(a)>>12]==-1) return readmembl(a);
+        if (readlookup2[(a)>>12]==LOOKUP_INV) return readmembl(a);
         else return *(uint8_t *)(readlookup2[(a) >> 12] + (a));
 }
 
 static uint8_t readmembf(uint32_t a)
 {
-        if (readlookup2[(a)>>12]==-1) return readmembl(a);
+        if (readlookup2[(a)>>12]==LOOKUP_INV) return readmembl(a);
         else return *(uint8_t *)(readlookup2[(a) >> 12] + (a));
 }
 
 static uint16_t readmemw(uint32_t s, uint16_t a)
 {
         if (a!=(cs+cpu_state.pc)) memcycs+=(8>>is8086);
-        if ((readlookup2[((s)+(a))>>12]==-1 || (s)==0xFFFFFFFF)) return readmemwl(s+a);
+        if ((readlookup2[((s)+(a))>>12]==LOOKUP_INV || (s)==0xFFFFFFFF)) return readmemwl(s+a);
         else return *(uint16_t *)(readlookup2[(s + a) >> 12] + s + a);
 }
 
@@ -83,13 +83,13 @@ void refreshread() { /*pclog("Refreshread\n"); */FETCHCOMPLETE(); memcycs+=4; }
 static void writememb(uint32_t a, uint8_t v)
 {
         memcycs+=4;
-        if (writelookup2[(a)>>12]==-1) writemembl(a,v);
+        if (writelookup2[(a)>>12]==LOOKUP_INV) writemembl(a,v);
         else *(uint8_t *)(writelookup2[a >> 12] + a) = v;
 }
 static void writememw(uint32_t s, uint32_t a, uint16_t v)
 {
         memcycs+=(8>>is8086);
-        if (writelookup2[((s)+(a))>>12]==-1 || (s)==0xFFFFFFFF) writememwl(s+a,v);
+        if (writelookup2[((s)+(a))>>12]==LOOKUP_INV || (s)==0xFFFFFFFF) writememwl(s+a,v);
         else *(uint16_t *)(writelookup2[(s + a) >> 12] + s + a) = v;
 }
 
@@ -588,8 +588,8 @@ void dumpregs()
         printf("Entries in readlookup : %i    writelookup : %i\n",readlnum,writelnum);
         for (c=0;c<1024*1024;c++)
         {
-                if (readlookup2[c]!=0xFFFFFFFF) d++;
-                if (writelookup2[c]!=0xFFFFFFFF) e++;
+                if (readlookup2[c]!=LOOKUP_INV) d++;
+                if (writelookup2[c]!=LOOKUP_INV) e++;
         }
         printf("Entries in readlookup : %i    writelookup : %i\n",d,e);
         x87_dumpregs();
@@ -2446,6 +2446,13 @@ void execx86(int cycs)
                         break;
                         case 0xCD: /*INT*/
                         temp=FETCH();
+                        if (cpu_idle_detect)
+                        {
+                                if (temp == 0x16 && (AH == 0x01 || AH == 0x11))
+                                        cpu_idle_poll(CPU_IDLE_POLL_KBD);
+                                else if (temp == 0x28)
+                                        cpu_idle_poll(CPU_IDLE_POLL_DOS);
+                        }
 
                         if (cpu_state.ssegs) ss=oldss;
                         writememw(ss, ((SP-2)&0xFFFF), cpu_state.flags | 0xF000);
@@ -3157,7 +3164,10 @@ void execx86(int cycs)
                         inhlt=1;
                         cpu_state.pc--;
                         FETCHCLEAR();
-                        cycles-=2;
+                        if ((cpu_state.flags & I_FLAG) && (pic.pend&~pic.mask))
+                                cycles-=2;
+                        else
+                                cpu_idle_skip(2);
                         break;
                         case 0xF5: /*CMC*/
                         cpu_state.flags ^= C_FLAG;
@@ -3581,53 +3591,58 @@ void execx86(int cycs)
                 clockhardware();
 
 
-                if (trap && (cpu_state.flags & T_FLAG) && !noint)
+                /*As in exec386(), only walk the event chain when something could
+                  be pending*/
+                if (trap | nmi | takeint)
                 {
+                        if (trap && (cpu_state.flags & T_FLAG) && !noint)
+                        {
 //                        printf("TRAP!!! %04X:%04X\n",CS,pc);
-                        writememw(ss,(SP-2)&0xFFFF,cpu_state.flags | 0xF000);
-                        writememw(ss,(SP-4)&0xFFFF,CS);
-                        writememw(ss,(SP-6)&0xFFFF,cpu_state.pc);
-                        SP-=6;
-                        addr=1<<2;
-                        cpu_state.flags &= ~I_FLAG;
-                        cpu_state.flags &= ~T_FLAG;
-                        cpu_state.pc=readmemw(0,addr);
-                        loadcs(readmemw(0,addr+2));
-                        FETCHCLEAR();
-                }
-                else if (nmi && nmi_enable && nmi_mask)
-                {
-//                        output = 3;
-                        writememw(ss,(SP-2)&0xFFFF,cpu_state.flags | 0xF000);
-                        writememw(ss,(SP-4)&0xFFFF,CS);
-                        writememw(ss,(SP-6)&0xFFFF,cpu_state.pc);
-                        SP-=6;
-                        addr=2<<2;
-                        cpu_state.flags &= ~I_FLAG;
-                        cpu_state.flags &= ~T_FLAG;
-                        cpu_state.pc=readmemw(0,addr);
-                        loadcs(readmemw(0,addr+2));
-                        FETCHCLEAR();
-                        nmi_enable = 0;
-                }
-                else if (takeint && !cpu_state.ssegs && !noint)
-                {
-                        temp=picinterrupt();
-                        if (temp!=0xFF)
+                                writememw(ss,(SP-2)&0xFFFF,cpu_state.flags | 0xF000);
+                                writememw(ss,(SP-4)&0xFFFF,CS);
+                                writememw(ss,(SP-6)&0xFFFF,cpu_state.pc);
+                                SP-=6;
+                                addr=1<<2;
+                                cpu_state.flags &= ~I_FLAG;
+                                cpu_state.flags &= ~T_FLAG;
+                                cpu_state.pc=readmemw(0,addr);
+                                loadcs(readmemw(0,addr+2));
+                                FETCHCLEAR();
+                        }
+                        else if (nmi && nmi_enable && nmi_mask)
                         {
-                                if (inhlt) cpu_state.pc++;
+//                        output = 3;
                                 writememw(ss,(SP-2)&0xFFFF,cpu_state.flags | 0xF000);
                                 writememw(ss,(SP-4)&0xFFFF,CS);
                                 writememw(ss,(SP-6)&0xFFFF,cpu_state.pc);
                                 SP-=6;
-                                addr=temp<<2;
+                                addr=2<<2;
                                 cpu_state.flags &= ~I_FLAG;
                                 cpu_state.flags &= ~T_FLAG;
                                 cpu_state.pc=readmemw(0,addr);
-//                        printf("INT INT INT\n");
                                 loadcs(readmemw(0,addr+2));
                                 FETCHCLEAR();
+                                nmi_enable = 0;
+                        }
+                        else if (takeint && !cpu_state.ssegs && !noint)
+                        {
+                                temp=picinterrupt();
+                                if (temp!=0xFF)
+                                {
+                                        if (inhlt) cpu_state.pc++;
+                                        writememw(ss,(SP-2)&0xFFFF,cpu_state.flags | 0xF000);
+                                        writememw(ss,(SP-4)&0xFFFF,CS);
+                                        writememw(ss,(SP-6)&0xFFFF,cpu_state.pc);
+                                        SP-=6;
+                                        addr=temp<<2;
+                                        cpu_state.flags &= ~I_FLAG;
+                                        cpu_state.flags &= ~T_FLAG;
+                                        cpu_state.pc=readmemw(0,addr);
+//                        printf("INT INT INT\n");
+                                        loadcs(readmemw(0,addr+2));
+                                        FETCHCLEAR();
 //                                printf("INTERRUPT\n");
+                                }
                         }
                 }
                 takeint = (cpu_state.flags & I_FLAG) && (pic.pend&~pic.mask);
@@ -214,7 +214,8 @@ static x86seg *codegen_generate_ea_32_long(ir_data_t *ir, x86seg *op_ea_seg, uin
                                 {
                                         new_eaaddr = fastreadl(cs + (*op_pc) + 1);
                                         uop_MOV_IMM(ir, IREG_eaaddr, new_eaaddr);
-                                        extra_bytes = 5;
+                                        codegen_mark_immediate_present(block, cs + (*op_pc) + 1, 4);
+                                        extra_bytes = 1;
                                 }
                                 (*op_pc) += 4;
                         }
@@ -241,7 +242,8 @@ static x86seg *codegen_generate_ea_32_long(ir_data_t *ir, x86seg *op_ea_seg, uin
                         {
                                 new_eaaddr = fastreadl(cs + (*op_pc) + 1);
                                 uop_MOV_IMM(ir, IREG_eaaddr, new_eaaddr);
-                                extra_bytes = 5;
+                                codegen_mark_immediate_present(block, cs + (*op_pc) + 1, 4);
+                                extra_bytes = 1;
                         }
                         (*op_pc) += 4;
                         uop_ADD(ir, IREG_eaaddr, IREG_eaaddr, sib & 7);
@@ -286,7 +288,7 @@ static x86seg *codegen_generate_ea_32_long(ir_data_t *ir, x86seg *op_ea_seg, uin
                         {
                                 new_eaaddr = fastreadl(cs + (*op_pc) + 1);
                                 uop_MOV_IMM(ir, IREG_eaaddr, new_eaaddr);
-                                extra_bytes = 4;
+                                codegen_mark_immediate_present(block, cs + (*op_pc) + 1, 4);
                         }
                         
                         (*op_pc) += 4;
@@ -315,7 +317,7 @@ static x86seg *codegen_generate_ea_32_long(ir_data_t *ir, x86seg *op_ea_seg, uin
                                         {
                                                 new_eaaddr = fastreadl(cs + (*op_pc) + 1);
                                                 uop_ADD_IMM(ir, IREG_eaaddr, IREG_eaaddr, new_eaaddr);
-                                                extra_bytes = 4;
+                                                codegen_mark_immediate_present(block, cs + (*op_pc) + 1, 4);
                                         }
                                         (*op_pc) += 4;
                                 }
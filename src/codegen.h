@@ -47,6 +47,10 @@ typedef struct codeblock_t
         
         uint64_t page_mask, page_mask2;
         uint64_t *dirty_mask, *dirty_mask2;
+        /*Bytes within page_mask/page_mask2 holding immediates or displacements
+          that CODEBLOCK_NO_IMMEDIATES would fetch at run time. Only valid for
+          CODEBLOCK_BYTE_MASK blocks.*/
+        uint64_t imm_mask, imm_mask2;
 
         /*Previous and next pointers, for the codeblock list associated with
           each physical page. Two sets of pointers, as a codeblock can be
@@ -81,6 +85,8 @@ extern uint8_t *block_write_data;
 #define CODEBLOCK_IN_DIRTY_LIST 0x40
 /*Code block is not inlining immediate parameters, parameters must be fetched from memory*/
 #define CODEBLOCK_NO_IMMEDIATES 0x80
+/*Code block was last invalidated by writes to immediate/displacement bytes only*/
+#define CODEBLOCK_IMM_DIRTY 0x100
 
 #define BLOCK_PC_INVALID 0xffffffff
 
@@ -289,6 +295,7 @@ static inline void codeblock_tree_delete(codeblock_t *block)
 #define PAGE_MASK_SHIFT 6
 
 void codegen_mark_code_present_multibyte(codeblock_t *block, uint32_t start_pc, int len);
+void codegen_mark_immediate(codeblock_t *block, uint32_t start_pc, int len);
 
 static inline void codegen_mark_code_present(codeblock_t *block, uint32_t start_pc, int len)
 {
@@ -313,6 +320,14 @@ static inline void codegen_mark_code_present(codeblock_t *block, uint32_t start_
                 codegen_mark_code_present_multibyte(block, start_pc, len);
 }
 
+/*Mark an inlined immediate or displacement as code present. Writes that only
+  land on these bytes can be tolerated by recompiling with CODEBLOCK_NO_IMMEDIATES*/
+static inline void codegen_mark_immediate_present(codeblock_t *block, uint32_t start_pc, int len)
+{
+        codegen_mark_code_present(block, start_pc, len);
+        codegen_mark_immediate(block, start_pc, len);
+}
+
 void codegen_init();
 void codegen_close();
 void codegen_reset();
@@ -346,6 +361,7 @@ extern int cpu_recomp_flushes, cpu_recomp_flushes_latched;
 extern int cpu_recomp_evicted, cpu_recomp_evicted_latched;
 extern int cpu_recomp_reuse, cpu_recomp_reuse_latched;
 extern int cpu_recomp_removed, cpu_recomp_removed_latched;
+extern int cpu_recomp_imm_avoided, cpu_recomp_imm_avoided_latched;
 
 extern int cpu_reps, cpu_reps_latched;
 extern int cpu_notreps, cpu_notreps_latched;
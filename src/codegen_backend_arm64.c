@@ -39,6 +39,19 @@ void *codegen_fp_round_quad;
 void *codegen_gpf_rout;
 void *codegen_exit_rout;
 
+typedef struct mem_stub_t
+{
+        void *routine;
+        uint32_t *misaligned_branch;
+        uint32_t *invalid_branch;
+        void *resume;
+} mem_stub_t;
+
+#define MEM_STUBS_MAX 512
+
+static mem_stub_t mem_stubs[MEM_STUBS_MAX];
+static int mem_stubs_nr;
+
 host_reg_def_t codegen_host_reg_list[CODEGEN_HOST_REGS] =
 {
         {REG_X19, 0},
@@ -76,7 +89,7 @@ static void build_load_routine(codeblock_t *block, int size, int is_float)
 	/*MOV W1, W0, LSR #12
 	  MOV X2, #readlookup2
 	  LDR X1, [X2, X1, LSL #3]
-	  CMP X1, #-1
+	  CMP X1, #LOOKUP_INV
 	  BEQ +
 	  LDRB W0, [X1, X0]
 	  MOV W1, #0
@@ -96,7 +109,7 @@ static void build_load_routine(codeblock_t *block, int size, int is_float)
 		host_arm64_TST_IMM(block, REG_W0, size-1);
 		misaligned_offset = host_arm64_BNE_(block);
 	}
-	host_arm64_CMPX_IMM(block, REG_X1, -1);
+	host_arm64_CMPX_IMM(block, REG_X1, LOOKUP_INV);
 	branch_offset = host_arm64_BEQ_(block);
 	if (size == 1 && !is_float)
 		host_arm64_LDRB_REG(block, REG_W0, REG_W1, REG_W0);
@@ -145,7 +158,7 @@ static void build_store_routine(codeblock_t *block, int size, int is_float)
 	/*MOV W2, W0, LSR #12
 	  MOV X3, #writelookup2
 	  LDR X2, [X3, X2, LSL #3]
-	  CMP X2, #-1
+	  CMP X2, #LOOKUP_INV
 	  BEQ +
 	  STRB W1, [X2, X0]
 	  MOV W1, #0
@@ -165,7 +178,7 @@ static void build_store_routine(codeblock_t *block, int size, int is_float)
 		host_arm64_TST_IMM(block, REG_W0, size-1);
 		misaligned_offset = host_arm64_BNE_(block);
 	}
-	host_arm64_CMPX_IMM(block, REG_X2, -1);
+	host_arm64_CMPX_IMM(block, REG_X2, LOOKUP_INV);
 	branch_offset = host_arm64_BEQ_(block);
 	if (size == 1 && !is_float)
 		host_arm64_STRB_REG(block, REG_X1, REG_X2, REG_X0);
@@ -318,7 +331,7 @@ void codegen_backend_init()
 	host_arm64_call(block, (void *)x86gpf);
 
         codegen_exit_rout = &block_write_data[block_pos];
-	host_arm64_LDP_POSTIDX_X(block, REG_X19, REG_X20, REG_XSP, 64);
+	host_arm64_LDP_POSTIDX_X(block, REG_X19, REG_X20, REG_XSP, 80);
 	host_arm64_LDP_POSTIDX_X(block, REG_X21, REG_X22, REG_XSP, 16);
 	host_arm64_LDP_POSTIDX_X(block, REG_X23, REG_X24, REG_XSP, 16);
 	host_arm64_LDP_POSTIDX_X(block, REG_X25, REG_X26, REG_XSP, 16);
@@ -342,6 +355,45 @@ void codegen_set_rounding_mode(int mode)
         cpu_state.new_fp_control = mode << 3;
 }
 
+int codegen_mem_stub_available()
+{
+        return mem_stubs_nr < MEM_STUBS_MAX;
+}
+
+void codegen_mem_stub_add(codeblock_t *block, void *routine, uint32_t *misaligned_branch, uint32_t *invalid_branch)
+{
+        mem_stub_t *stub = &mem_stubs[mem_stubs_nr++];
+
+        stub->routine = routine;
+        stub->misaligned_branch = misaligned_branch;
+        stub->invalid_branch = invalid_branch;
+        stub->resume = &block_write_data[block_pos];
+}
+
+static void codegen_mem_stubs_emit(codeblock_t *block)
+{
+        int c;
+
+        for (c = 0; c < mem_stubs_nr; c++)
+        {
+                mem_stub_t *stub = &mem_stubs[c];
+
+                /*Make sure the stub isn't split across memory blocks, so the
+                  branches can point straight at it*/
+                codegen_alloc(block, 48);
+                if (stub->misaligned_branch)
+                        host_arm64_branch_set_offset(stub->misaligned_branch, &block_write_data[block_pos]);
+                host_arm64_branch_set_offset(stub->invalid_branch, &block_write_data[block_pos]);
+
+                /*In - W0 = address, W1/V_TEMP = data (stores)
+                  Out - W0/V_TEMP = data (loads)*/
+                host_arm64_call(block, stub->routine);
+                host_arm64_CBNZ(block, REG_X1, (uintptr_t)codegen_exit_rout);
+                host_arm64_B(block, stub->resume);
+        }
+        mem_stubs_nr = 0;
+}
+
 /*R10 - cpu_state*/
 void codegen_backend_prologue(codeblock_t *block)
 {
@@ -354,7 +406,7 @@ void codegen_backend_prologue(codeblock_t *block)
 	host_arm64_STP_PREIDX_X(block, REG_X25, REG_X26, REG_XSP, -16);
 	host_arm64_STP_PREIDX_X(block, REG_X23, REG_X24, REG_XSP, -16);
 	host_arm64_STP_PREIDX_X(block, REG_X21, REG_X22, REG_XSP, -16);
-	host_arm64_STP_PREIDX_X(block, REG_X19, REG_X20, REG_XSP, -64);
+	host_arm64_STP_PREIDX_X(block, REG_X19, REG_X20, REG_XSP, -80);
 
 	host_arm64_MOVX_IMM(block, REG_CPUSTATE, (uint64_t)&cpu_state);
 
@@ -364,11 +416,19 @@ void codegen_backend_prologue(codeblock_t *block)
 		host_arm64_SUB_IMM(block, REG_TEMP, REG_TEMP, block->TOP);
 		host_arm64_STR_IMM_W(block, REG_TEMP, REG_XSP, IREG_TOP_diff_stack_offset);
         }
+
+	/*Lookup table bases for inline memory accesses*/
+	host_arm64_MOVX_IMM(block, REG_TEMP, (uint64_t)readlookup2);
+	host_arm64_STR_IMM_Q(block, REG_TEMP, REG_XSP, READLOOKUP2_stack_offset);
+	host_arm64_MOVX_IMM(block, REG_TEMP, (uint64_t)writelookup2);
+	host_arm64_STR_IMM_Q(block, REG_TEMP, REG_XSP, WRITELOOKUP2_stack_offset);
+
+	mem_stubs_nr = 0;
 }
 
 void codegen_backend_epilogue(codeblock_t *block)
 {
-	host_arm64_LDP_POSTIDX_X(block, REG_X19, REG_X20, REG_XSP, 64);
+	host_arm64_LDP_POSTIDX_X(block, REG_X19, REG_X20, REG_XSP, 80);
 	host_arm64_LDP_POSTIDX_X(block, REG_X21, REG_X22, REG_XSP, 16);
 	host_arm64_LDP_POSTIDX_X(block, REG_X23, REG_X24, REG_XSP, 16);
 	host_arm64_LDP_POSTIDX_X(block, REG_X25, REG_X26, REG_XSP, 16);
@@ -376,6 +436,8 @@ void codegen_backend_epilogue(codeblock_t *block)
 	host_arm64_LDP_POSTIDX_X(block, REG_X29, REG_X30, REG_XSP, 16);
 	host_arm64_RET(block, REG_X30);
 
+	codegen_mem_stubs_emit(block);
+
 	codegen_allocator_clean_blocks(block->head_mem_block);
 }
 
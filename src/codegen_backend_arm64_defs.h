@@ -111,6 +111,11 @@
 
 #define REG_V_TEMP REG_V0
 
+/*Stack frame offsets of the readlookup2 and writelookup2 pointers, stored by
+  codegen_backend_prologue() for inline memory accesses*/
+#define READLOOKUP2_stack_offset  64
+#define WRITELOOKUP2_stack_offset 72
+
 #define CODEGEN_HOST_REGS 10
 #define CODEGEN_HOST_FP_REGS 8
 
@@ -132,4 +137,10 @@ extern void *codegen_fp_round;
 extern void *codegen_fp_round_quad;
 
 extern void *codegen_gpf_rout;
-extern void *codegen_exit_rout;
\ No newline at end of file
+extern void *codegen_exit_rout;
+
+/*Slow paths for guest memory accesses done inline in a block. The access
+  branches to a stub, emitted after the block epilogue, that calls routine and
+  then returns to the instruction after the access*/
+int codegen_mem_stub_available();
+void codegen_mem_stub_add(codeblock_t *block, void *routine, uint32_t *misaligned_branch, uint32_t *invalid_branch);
\ No newline at end of file
@@ -926,6 +926,87 @@ static int codegen_LOAD_SEG(codeblock_t *block, uop_t *uop)
         return 0;
 }
 
+/*Guest memory accesses probe readlookup2/writelookup2 inline, using the table
+  bases stored in the stack frame by the block prologue. Misaligned accesses
+  and lookup misses branch to a stub after the block epilogue, which calls the
+  out-of-line routine. If the block has run out of stubs the routine is called
+  directly.
+
+  In - W0 = address, W1/V_TEMP = data (stores)
+  Out - W0/V_TEMP = data (loads)
+  Corrupts X1-X3*/
+static int codegen_mem_probe(codeblock_t *block, int size, int is_store, uint32_t **misaligned_branch, uint32_t **invalid_branch)
+{
+	int page_reg = is_store ? REG_X2 : REG_X1;
+	int table_reg = is_store ? REG_X3 : REG_X2;
+
+	if (!codegen_mem_stub_available())
+		return 0;
+
+	host_arm64_MOV_REG_LSR(block, page_reg, REG_W0, 12);
+	host_arm64_LDR_IMM_X(block, table_reg, REG_XSP, is_store ? WRITELOOKUP2_stack_offset : READLOOKUP2_stack_offset);
+	host_arm64_LDRX_REG_LSL3(block, page_reg, table_reg, page_reg);
+	if (size != 1)
+	{
+		host_arm64_TST_IMM(block, REG_W0, size-1);
+		*misaligned_branch = host_arm64_BNE_(block);
+	}
+	else
+		*misaligned_branch = NULL;
+	host_arm64_CMPX_IMM(block, page_reg, LOOKUP_INV);
+	*invalid_branch = host_arm64_BEQ_(block);
+
+	return 1;
+}
+
+static void codegen_mem_load(codeblock_t *block, void *routine, int size, int is_float)
+{
+	uint32_t *misaligned_branch, *invalid_branch;
+
+	if (!codegen_mem_probe(block, size, 0, &misaligned_branch, &invalid_branch))
+	{
+		host_arm64_call(block, routine);
+		host_arm64_CBNZ(block, REG_X1, (uintptr_t)codegen_exit_rout);
+		return;
+	}
+
+	if (size == 1)
+		host_arm64_LDRB_REG(block, REG_W0, REG_W1, REG_W0);
+	else if (size == 2)
+		host_arm64_LDRH_REG(block, REG_W0, REG_W1, REG_W0);
+	else if (size == 4 && !is_float)
+		host_arm64_LDR_REG(block, REG_W0, REG_W1, REG_W0);
+	else if (size == 4 && is_float)
+		host_arm64_LDR_REG_F32(block, REG_V_TEMP, REG_W1, REG_W0);
+	else
+		host_arm64_LDR_REG_F64(block, REG_V_TEMP, REG_W1, REG_W0);
+	codegen_mem_stub_add(block, routine, misaligned_branch, invalid_branch);
+}
+
+static void codegen_mem_store(codeblock_t *block, void *routine, int size, int is_float)
+{
+	uint32_t *misaligned_branch, *invalid_branch;
+
+	if (!codegen_mem_probe(block, size, 1, &misaligned_branch, &invalid_branch))
+	{
+		host_arm64_call(block, routine);
+		host_arm64_CBNZ(block, REG_X1, (uintptr_t)codegen_exit_rout);
+		return;
+	}
+
+	if (size == 1)
+		host_arm64_STRB_REG(block, REG_X1, REG_X2, REG_X0);
+	else if (size == 2)
+		host_arm64_STRH_REG(block, REG_X1, REG_X2, REG_X0);
+	else if (size == 4 && !is_float)
+		host_arm64_STR_REG(block, REG_X1, REG_X2, REG_X0);
+	else if (size == 4 && is_float)
+		host_arm64_STR_REG_F32(block, REG_V_TEMP, REG_X2, REG_X0);
+	else
+		host_arm64_STR_REG_F64(block, REG_V_TEMP, REG_X2, REG_X0);
+	codegen_mem_stub_add(block, routine, misaligned_branch, invalid_branch);
+}
+
 static int codegen_MEM_LOAD_ABS(codeblock_t *block, uop_t *uop)
 {
         int dest_reg = HOST_REG_GET(uop->dest_reg_a_real), seg_reg = HOST_REG_GET(uop->src_reg_a_real);
@@ -934,19 +1015,18 @@ static int codegen_MEM_LOAD_ABS(codeblock_t *block, uop_t *uop)
 	host_arm64_ADD_IMM(block, REG_X0, seg_reg, uop->imm_data);
         if (REG_IS_B(dest_size) || REG_IS_BH(dest_size))
         {
-                host_arm64_call(block, codegen_mem_load_byte);
+                codegen_mem_load(block, codegen_mem_load_byte, 1, 0);
         }
         else if (REG_IS_W(dest_size))
         {
-                host_arm64_call(block, codegen_mem_load_word);
+                codegen_mem_load(block, codegen_mem_load_word, 2, 0);
         }
         else if (REG_IS_L(dest_size))
         {
-                host_arm64_call(block, codegen_mem_load_long);
+                codegen_mem_load(block, codegen_mem_load_long, 4, 0);
         }
         else
                 fatal("MEM_LOAD_ABS - %02x\n", uop->dest_reg_a_real);
-	host_arm64_CBNZ(block, REG_X1, (uintptr_t)codegen_exit_rout);
         if (REG_IS_B(dest_size))
         {
 		host_arm64_BFI(block, dest_reg, REG_X0, 0, 8);
@@ -976,23 +1056,22 @@ static int codegen_MEM_LOAD_REG(codeblock_t *block, uop_t *uop)
                 host_arm64_ADD_IMM(block, REG_X0, REG_X0, uop->imm_data);
         if (REG_IS_B(dest_size) || REG_IS_BH(dest_size))
         {
-                host_arm64_call(block, codegen_mem_load_byte);
+                codegen_mem_load(block, codegen_mem_load_byte, 1, 0);
         }
         else if (REG_IS_W(dest_size))
         {
-                host_arm64_call(block, codegen_mem_load_word);
+                codegen_mem_load(block, codegen_mem_load_word, 2, 0);
         }
         else if (REG_IS_L(dest_size))
         {
-                host_arm64_call(block, codegen_mem_load_long);
+                codegen_mem_load(block, codegen_mem_load_long, 4, 0);
         }
         else if (REG_IS_Q(dest_size))
         {
-                host_arm64_call(block, codegen_mem_load_quad);
+                codegen_mem_load(block, codegen_mem_load_quad, 8, 0);
         }
         else
                 fatal("MEM_LOAD_REG - %02x\n", uop->dest_reg_a_real);
-	host_arm64_CBNZ(block, REG_X1, (uintptr_t)codegen_exit_rout);
         if (REG_IS_B(dest_size))
         {
 		host_arm64_BFI(block, dest_reg, REG_X0, 0, 8);
@@ -1027,8 +1106,7 @@ static int codegen_MEM_LOAD_DOUBLE(codeblock_t *block, uop_t *uop)
 	host_arm64_ADD_REG(block, REG_X0, seg_reg, addr_reg, 0);
         if (uop->imm_data)
                 host_arm64_ADD_IMM(block, REG_X0, REG_X0, uop->imm_data);
-        host_arm64_call(block, codegen_mem_load_double);
-	host_arm64_CBNZ(block, REG_X1, (uintptr_t)codegen_exit_rout);
+        codegen_mem_load(block, codegen_mem_load_double, 8, 1);
 	host_arm64_FMOV_D_D(block, dest_reg, REG_V_TEMP);
 
         return 0;
@@ -1044,8 +1122,7 @@ static int codegen_MEM_LOAD_SINGLE(codeblock_t *block, uop_t *uop)
 	host_arm64_ADD_REG(block, REG_X0, seg_reg, addr_reg, 0);
         if (uop->imm_data)
                 host_arm64_ADD_IMM(block, REG_X0, REG_X0, uop->imm_data);
-        host_arm64_call(block, codegen_mem_load_single);
-	host_arm64_CBNZ(block, REG_X1, (uintptr_t)codegen_exit_rout);
+        codegen_mem_load(block, codegen_mem_load_single, 4, 1);
 	host_arm64_FCVT_D_S(block, dest_reg, REG_V_TEMP);
 
         return 0;
@@ -1060,26 +1137,25 @@ static int codegen_MEM_STORE_ABS(codeblock_t *block, uop_t *uop)
         if (REG_IS_B(src_size))
         {
 		host_arm64_AND_IMM(block, REG_W1, src_reg, 0xff);
-                host_arm64_call(block, codegen_mem_store_byte);
+                codegen_mem_store(block, codegen_mem_store_byte, 1, 0);
         }
 	else if (REG_IS_BH(src_size))
 	{
 		host_arm64_UBFX(block, REG_W1, src_reg, 8, 8);
-                host_arm64_call(block, codegen_mem_store_byte);
+                codegen_mem_store(block, codegen_mem_store_byte, 1, 0);
 	}
         else if (REG_IS_W(src_size))
         {
 		host_arm64_AND_IMM(block, REG_W1, src_reg, 0xffff);
-                host_arm64_call(block, codegen_mem_store_word);
+                codegen_mem_store(block, codegen_mem_store_word, 2, 0);
         }
         else if (REG_IS_L(src_size))
         {
 		host_arm64_MOV_REG(block, REG_W1, src_reg, 0);
-                host_arm64_call(block, codegen_mem_store_long);
+                codegen_mem_store(block, codegen_mem_store_long, 4, 0);
         }
         else
                 fatal("MEM_STORE_ABS - %02x\n", uop->dest_reg_a_real);
-	host_arm64_CBNZ(block, REG_X1, (uintptr_t)codegen_exit_rout);
 
         return 0;
 }
@@ -1094,31 +1170,30 @@ static int codegen_MEM_STORE_REG(codeblock_t *block, uop_t *uop)
         if (REG_IS_B(src_size))
         {
 		host_arm64_AND_IMM(block, REG_W1, src_reg, 0xff);
-                host_arm64_call(block, codegen_mem_store_byte);
+                codegen_mem_store(block, codegen_mem_store_byte, 1, 0);
         }
 	else if (REG_IS_BH(src_size))
 	{
 		host_arm64_UBFX(block, REG_W1, src_reg, 8, 8);
-                host_arm64_call(block, codegen_mem_store_byte);
+                codegen_mem_store(block, codegen_mem_store_byte, 1, 0);
 	}
         else if (REG_IS_W(src_size))
         {
 		host_arm64_AND_IMM(block, REG_W1, src_reg, 0xffff);
-                host_arm64_call(block, codegen_mem_store_word);
+                codegen_mem_store(block, codegen_mem_store_word, 2, 0);
         }
         else if (REG_IS_L(src_size))
         {
 		host_arm64_MOV_REG(block, REG_W1, src_reg, 0);
-                host_arm64_call(block, codegen_mem_store_long);
+                codegen_mem_store(block, codegen_mem_store_long, 4, 0);
         }
         else if (REG_IS_Q(src_size))
         {
 		host_arm64_FMOV_D_D(block, REG_V_TEMP, src_reg);
-                host_arm64_call(block, codegen_mem_store_quad);
+                codegen_mem_store(block, codegen_mem_store_quad, 8, 0);
         }
         else
                 fatal("MEM_STORE_REG - %02x\n", uop->src_reg_c_real);
-	host_arm64_CBNZ(block, REG_X1, (uintptr_t)codegen_exit_rout);
 
         return 0;
 }
@@ -1129,8 +1204,7 @@ static int codegen_MEM_STORE_IMM_8(codeblock_t *block, uop_t *uop)
 
 	host_arm64_ADD_REG(block, REG_W0, seg_reg, addr_reg, 0);
 	host_arm64_mov_imm(block, REG_W1, uop->imm_data);
-        host_arm64_call(block, codegen_mem_store_byte);
-	host_arm64_CBNZ(block, REG_X1, (uintptr_t)codegen_exit_rout);
+        codegen_mem_store(block, codegen_mem_store_byte, 1, 0);
 
         return 0;
 }
@@ -1140,8 +1214,7 @@ static int codegen_MEM_STORE_IMM_16(codeblock_t *block, uop_t *uop)
 
 	host_arm64_ADD_REG(block, REG_W0, seg_reg, addr_reg, 0);
 	host_arm64_mov_imm(block, REG_W1, uop->imm_data);
-        host_arm64_call(block, codegen_mem_store_word);
-	host_arm64_CBNZ(block, REG_X1, (uintptr_t)codegen_exit_rout);
+        codegen_mem_store(block, codegen_mem_store_word, 2, 0);
 
         return 0;
 }
@@ -1151,8 +1224,7 @@ static int codegen_MEM_STORE_IMM_32(codeblock_t *block, uop_t *uop)
 
 	host_arm64_ADD_REG(block, REG_W0, seg_reg, addr_reg, 0);
 	host_arm64_mov_imm(block, REG_W1, uop->imm_data);
-        host_arm64_call(block, codegen_mem_store_long);
-	host_arm64_CBNZ(block, REG_X1, (uintptr_t)codegen_exit_rout);
+        codegen_mem_store(block, codegen_mem_store_long, 4, 0);
 
         return 0;
 }
@@ -1169,8 +1241,7 @@ static int codegen_MEM_STORE_SINGLE(codeblock_t *block, uop_t *uop)
         if (uop->imm_data)
                 host_arm64_ADD_IMM(block, REG_X0, REG_X0, uop->imm_data);
 	host_arm64_FCVT_S_D(block, REG_V_TEMP, src_reg);
-        host_arm64_call(block, codegen_mem_store_single);
-	host_arm64_CBNZ(block, REG_X1, (uintptr_t)codegen_exit_rout);
+        codegen_mem_store(block, codegen_mem_store_single, 4, 1);
 
         return 0;
 }
@@ -1186,8 +1257,7 @@ static int codegen_MEM_STORE_DOUBLE(codeblock_t *block, uop_t *uop)
         if (uop->imm_data)
                 host_arm64_ADD_IMM(block, REG_X0, REG_X0, uop->imm_data);
 	host_arm64_FMOV_D_D(block, REG_V_TEMP, src_reg);
-        host_arm64_call(block, codegen_mem_store_double);
-	host_arm64_CBNZ(block, REG_X1, (uintptr_t)codegen_exit_rout);
+        codegen_mem_store(block, codegen_mem_store_double, 8, 1);
 
         return 0;
 }
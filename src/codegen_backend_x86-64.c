@@ -6,6 +6,7 @@
 #include "codegen_backend.h"
 #include "codegen_backend_x86-64_defs.h"
 #include "codegen_backend_x86-64_ops.h"
+#include "codegen_backend_x86-64_ops_helpers.h"
 #include "codegen_backend_x86-64_ops_sse.h"
 #include "codegen_reg.h"
 #include "x86.h"
@@ -36,6 +37,19 @@ void *codegen_mem_store_double;
 void *codegen_gpf_rout;
 void *codegen_exit_rout;
 
+typedef struct mem_stub_t
+{
+        void *routine;
+        uint32_t *misaligned_branch;
+        uint32_t *invalid_branch;
+        void *resume;
+} mem_stub_t;
+
+#define MEM_STUBS_MAX 512
+
+static mem_stub_t mem_stubs[MEM_STUBS_MAX];
+static int mem_stubs_nr;
+
 host_reg_def_t codegen_host_reg_list[CODEGEN_HOST_REGS] =
 {
         /*Note: while EAX and EDX are normally volatile registers under x86
@@ -74,7 +88,7 @@ static void build_load_routine(codeblock_t *block, int size, int is_float)
         /*MOV ECX, ESI
           SHR ESI, 12
           MOV RSI, [readlookup2+ESI*4]
-          CMP ESI, -1
+          CMP RSI, LOOKUP_INV
           JNZ +
           MOVZX ECX, B[RSI+RCX]
           XOR ESI,ESI
@@ -98,7 +112,7 @@ static void build_load_routine(codeblock_t *block, int size, int is_float)
                 host_x86_TEST32_REG_IMM(block, REG_ECX, size-1);
                 misaligned_offset = host_x86_JNZ_short(block);
         }
-        host_x86_CMP64_REG_IMM(block, REG_RSI, (uint32_t)-1);
+        host_x86_CMP64_REG_IMM(block, REG_RSI, LOOKUP_INV);
         branch_offset = host_x86_JZ_short(block);
         if (size == 1 && !is_float)
                 host_x86_MOVZX_BASE_INDEX_32_8(block, REG_ECX, REG_RSI, REG_RCX);
@@ -172,7 +186,7 @@ static void build_store_routine(codeblock_t *block, int size, int is_float)
         /*MOV EDI, ESI
           SHR ESI, 12
           MOV ESI, [writelookup2+ESI*4]
-          CMP ESI, -1
+          CMP RSI, LOOKUP_INV
           JNZ +
           MOV [RSI+RDI], ECX
           XOR ESI,ESI
@@ -196,7 +210,7 @@ static void build_store_routine(codeblock_t *block, int size, int is_float)
                 host_x86_TEST32_REG_IMM(block, REG_EDI, size-1);
                 misaligned_offset = host_x86_JNZ_short(block);
         }
-        host_x86_CMP64_REG_IMM(block, REG_RSI, (uint32_t)-1);
+        host_x86_CMP64_REG_IMM(block, REG_RSI, LOOKUP_INV);
         branch_offset = host_x86_JZ_short(block);
         if (size == 1 && !is_float)
                 host_x86_MOV8_BASE_INDEX_REG(block, REG_RSI, REG_RDI, REG_ECX);
@@ -344,6 +358,48 @@ void codegen_set_rounding_mode(int mode)
         cpu_state.new_fp_control = (cpu_state.old_fp_control & ~0x6000) | (mode << 13);
 }
 
+int codegen_mem_stub_available()
+{
+        return mem_stubs_nr < MEM_STUBS_MAX;
+}
+
+void codegen_mem_stub_add(codeblock_t *block, void *routine, uint32_t *misaligned_branch, uint32_t *invalid_branch)
+{
+        mem_stub_t *stub = &mem_stubs[mem_stubs_nr++];
+
+        stub->routine = routine;
+        stub->misaligned_branch = misaligned_branch;
+        stub->invalid_branch = invalid_branch;
+        stub->resume = &block_write_data[block_pos];
+}
+
+static void codegen_mem_stubs_emit(codeblock_t *block)
+{
+        int c;
+
+        for (c = 0; c < mem_stubs_nr; c++)
+        {
+                mem_stub_t *stub = &mem_stubs[c];
+                uint8_t *dest;
+
+                /*Make sure the stub isn't split across memory blocks, so the
+                  branches can point straight at it*/
+                codegen_alloc_bytes(block, 40);
+                dest = &block_write_data[block_pos];
+                if (stub->misaligned_branch)
+                        *stub->misaligned_branch = (uintptr_t)dest - ((uintptr_t)stub->misaligned_branch + 4);
+                *stub->invalid_branch = (uintptr_t)dest - ((uintptr_t)stub->invalid_branch + 4);
+
+                /*In - ESI = address, ECX/XMM_TEMP = data (stores)
+                  Out - ECX/XMM_TEMP = data (loads)*/
+                host_x86_CALL(block, stub->routine);
+                host_x86_TEST32_REG(block, REG_ESI, REG_ESI);
+                host_x86_JNZ(block, codegen_exit_rout);
+                host_x86_JMP(block, stub->resume);
+        }
+        mem_stubs_nr = 0;
+}
+
 void codegen_backend_prologue(codeblock_t *block)
 {
         block_pos = BLOCK_START; /*Entry code*/
@@ -365,6 +421,11 @@ void codegen_backend_prologue(codeblock_t *block)
         }
         if (block->flags & CODEBLOCK_NO_IMMEDIATES)
             host_x86_MOV64_REG_IMM(block, REG_R12, (uintptr_t)ram);
+        /*Lookup table bases for inline memory accesses*/
+        host_x86_MOV64_REG_IMM(block, REG_R14, (uintptr_t)readlookup2);
+        host_x86_MOV64_REG_IMM(block, REG_R15, (uintptr_t)writelookup2);
+
+        mem_stubs_nr = 0;
 }
 
 void codegen_backend_epilogue(codeblock_t *block)
@@ -379,5 +440,7 @@ void codegen_backend_epilogue(codeblock_t *block)
         host_x86_POP(block, REG_RBP);
         host_x86_POP(block, REG_RDX);
         host_x86_RET(block);
+
+        codegen_mem_stubs_emit(block);
 }
 #endif
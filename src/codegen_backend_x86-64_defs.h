@@ -65,3 +65,9 @@ extern void *codegen_mem_store_double;
 
 extern void *codegen_gpf_rout;
 extern void *codegen_exit_rout;
+
+/*Slow paths for guest memory accesses done inline in a block. The access
+  branches to a stub, emitted after the block epilogue, that calls routine and
+  then returns to the instruction after the access*/
+int codegen_mem_stub_available();
+void codegen_mem_stub_add(codeblock_t *block, void *routine, uint32_t *misaligned_branch, uint32_t *invalid_branch);
@@ -938,6 +938,86 @@ static int codegen_LOAD_SEG(codeblock_t *block, uop_t *uop)
         return 0;
 }
 
+/*Guest memory accesses probe readlookup2/writelookup2 inline, using the table
+  bases loaded into R14/R15 by the block prologue. Misaligned accesses and
+  lookup misses branch to a stub after the block epilogue, which calls the
+  out-of-line routine. If the block has run out of stubs the routine is called
+  directly.
+
+  In - ESI = address, ECX/XMM_TEMP = data (stores)
+  Out - ECX/XMM_TEMP = data (loads)
+  Corrupts EDI*/
+static int codegen_mem_probe(codeblock_t *block, int size, int lookup_reg, uint32_t **misaligned_branch, uint32_t **invalid_branch)
+{
+        if (!codegen_mem_stub_available())
+                return 0;
+
+        host_x86_MOV32_REG_REG(block, REG_EDI, REG_ESI);
+        host_x86_SHR32_IMM(block, REG_EDI, 12);
+        host_x86_MOV64_REG_BASE_INDEX_SHIFT(block, REG_RDI, lookup_reg, REG_RDI, 3);
+        if (size != 1)
+        {
+                host_x86_TEST32_REG_IMM(block, REG_ESI, size-1);
+                *misaligned_branch = host_x86_JNZ_long(block);
+        }
+        else
+                *misaligned_branch = NULL;
+        host_x86_CMP64_REG_IMM(block, REG_RDI, LOOKUP_INV);
+        *invalid_branch = host_x86_JZ_long(block);
+
+        return 1;
+}
+
+static void codegen_mem_load(codeblock_t *block, void *routine, int size, int is_float)
+{
+        uint32_t *misaligned_branch, *invalid_branch;
+
+        if (!codegen_mem_probe(block, size, REG_R14, &misaligned_branch, &invalid_branch))
+        {
+                host_x86_CALL(block, routine);
+                host_x86_TEST32_REG(block, REG_ESI, REG_ESI);
+                host_x86_JNZ(block, codegen_exit_rout);
+                return;
+        }
+
+        if (size == 1)
+                host_x86_MOVZX_BASE_INDEX_32_8(block, REG_ECX, REG_RDI, REG_RSI);
+        else if (size == 2)
+                host_x86_MOVZX_BASE_INDEX_32_16(block, REG_ECX, REG_RDI, REG_RSI);
+        else if (size == 4 && !is_float)
+                host_x86_MOV32_REG_BASE_INDEX(block, REG_ECX, REG_RDI, REG_RSI);
+        else if (size == 4 && is_float)
+                host_x86_CVTSS2SD_XREG_BASE_INDEX(block, REG_XMM_TEMP, REG_RDI, REG_RSI);
+        else
+                host_x86_MOVQ_XREG_BASE_INDEX(block, REG_XMM_TEMP, REG_RDI, REG_RSI);
+        codegen_mem_stub_add(block, routine, misaligned_branch, invalid_branch);
+}
+
+static void codegen_mem_store(codeblock_t *block, void *routine, int size, int is_float)
+{
+        uint32_t *misaligned_branch, *invalid_branch;
+
+        if (!codegen_mem_probe(block, size, REG_R15, &misaligned_branch, &invalid_branch))
+        {
+                host_x86_CALL(block, routine);
+                host_x86_TEST32_REG(block, REG_ESI, REG_ESI);
+                host_x86_JNZ(block, codegen_exit_rout);
+                return;
+        }
+
+        if (size == 1)
+                host_x86_MOV8_BASE_INDEX_REG(block, REG_RDI, REG_RSI, REG_ECX);
+        else if (size == 2)
+                host_x86_MOV16_BASE_INDEX_REG(block, REG_RDI, REG_RSI, REG_ECX);
+        else if (size == 4 && !is_float)
+                host_x86_MOV32_BASE_INDEX_REG(block, REG_RDI, REG_RSI, REG_ECX);
+        else if (size == 4 && is_float)
+                host_x86_MOVD_BASE_INDEX_XREG(block, REG_RDI, REG_RSI, REG_XMM_TEMP);
+        else
+                host_x86_MOVQ_BASE_INDEX_XREG(block, REG_RDI, REG_RSI, REG_XMM_TEMP);
+        codegen_mem_stub_add(block, routine, misaligned_branch, invalid_branch);
+}
+
 static int codegen_MEM_LOAD_ABS(codeblock_t *block, uop_t *uop)
 {
         int dest_reg = HOST_REG_GET(uop->dest_reg_a_real), seg_reg = HOST_REG_GET(uop->src_reg_a_real);
@@ -946,22 +1026,20 @@ static int codegen_MEM_LOAD_ABS(codeblock_t *block, uop_t *uop)
         host_x86_LEA_REG_IMM(block, REG_ESI, seg_reg, uop->imm_data);
         if (REG_IS_B(dest_size))
         {
-                host_x86_CALL(block, codegen_mem_load_byte);
+                codegen_mem_load(block, codegen_mem_load_byte, 1, 0);
         }
         else if (REG_IS_W(dest_size))
         {
-                host_x86_CALL(block, codegen_mem_load_word);
+                codegen_mem_load(block, codegen_mem_load_word, 2, 0);
         }
         else if (REG_IS_L(dest_size))
         {
-                host_x86_CALL(block, codegen_mem_load_long);
+                codegen_mem_load(block, codegen_mem_load_long, 4, 0);
         }
 #ifdef RECOMPILER_DEBUG
         else
                 fatal("MEM_LOAD_ABS - %02x\n", uop->dest_reg_a_real);
 #endif
-        host_x86_TEST32_REG(block, REG_ESI, REG_ESI);
-        host_x86_JNZ(block, codegen_exit_rout);
         if (REG_IS_B(dest_size))
         {
                 host_x86_MOV8_REG_REG(block, dest_reg, REG_ECX);
@@ -987,26 +1065,24 @@ static int codegen_MEM_LOAD_REG(codeblock_t *block, uop_t *uop)
                 host_x86_ADD32_REG_IMM(block, REG_ESI, uop->imm_data);
         if (REG_IS_B(dest_size))
         {
-                host_x86_CALL(block, codegen_mem_load_byte);
+                codegen_mem_load(block, codegen_mem_load_byte, 1, 0);
         }
         else if (REG_IS_W(dest_size))
         {
-                host_x86_CALL(block, codegen_mem_load_word);
+                codegen_mem_load(block, codegen_mem_load_word, 2, 0);
         }
         else if (REG_IS_L(dest_size))
         {
-                host_x86_CALL(block, codegen_mem_load_long);
+                codegen_mem_load(block, codegen_mem_load_long, 4, 0);
         }
         else if (REG_IS_Q(dest_size))
         {
-                host_x86_CALL(block, codegen_mem_load_quad);
+                codegen_mem_load(block, codegen_mem_load_quad, 8, 0);
         }
 #ifdef RECOMPILER_DEBUG
         else
                 fatal("MEM_LOAD_REG - %02x\n", uop->dest_reg_a_real);
 #endif
-        host_x86_TEST32_REG(block, REG_ESI, REG_ESI);
-        host_x86_JNZ(block, codegen_exit_rout);
         if (REG_IS_B(dest_size))
         {
                 host_x86_MOV8_REG_REG(block, dest_reg, REG_ECX);
@@ -1038,9 +1114,7 @@ static int codegen_MEM_LOAD_SINGLE(codeblock_t *block, uop_t *uop)
         host_x86_LEA_REG_REG(block, REG_ESI, seg_reg, addr_reg);
         if (uop->imm_data)
                 host_x86_ADD32_REG_IMM(block, REG_ESI, uop->imm_data);
-        host_x86_CALL(block, codegen_mem_load_single);
-        host_x86_TEST32_REG(block, REG_ESI, REG_ESI);
-        host_x86_JNZ(block, codegen_exit_rout);
+        codegen_mem_load(block, codegen_mem_load_single, 4, 1);
         host_x86_MOVQ_XREG_XREG(block, dest_reg, REG_XMM_TEMP);
 
         return 0;
@@ -1057,9 +1131,7 @@ static int codegen_MEM_LOAD_DOUBLE(codeblock_t *block, uop_t *uop)
         host_x86_LEA_REG_REG(block, REG_ESI, seg_reg, addr_reg);
         if (uop->imm_data)
                 host_x86_ADD32_REG_IMM(block, REG_ESI, uop->imm_data);
-        host_x86_CALL(block, codegen_mem_load_double);
-        host_x86_TEST32_REG(block, REG_ESI, REG_ESI);
-        host_x86_JNZ(block, codegen_exit_rout);
+        codegen_mem_load(block, codegen_mem_load_double, 8, 1);
         host_x86_MOVQ_XREG_XREG(block, dest_reg, REG_XMM_TEMP);
 
         return 0;
@@ -1074,24 +1146,22 @@ static int codegen_MEM_STORE_ABS(codeblock_t *block, uop_t *uop)
         if (REG_IS_B(src_size))
         {
                 host_x86_MOV8_REG_REG(block, REG_ECX, src_reg);
-                host_x86_CALL(block, codegen_mem_store_byte);
+                codegen_mem_store(block, codegen_mem_store_byte, 1, 0);
         }
         else if (REG_IS_W(src_size))
         {
                 host_x86_MOV16_REG_REG(block, REG_ECX, src_reg);
-                host_x86_CALL(block, codegen_mem_store_word);
+                codegen_mem_store(block, codegen_mem_store_word, 2, 0);
         }
         else if (REG_IS_L(src_size))
         {
                 host_x86_MOV32_REG_REG(block, REG_ECX, src_reg);
-                host_x86_CALL(block, codegen_mem_store_long);
+                codegen_mem_store(block, codegen_mem_store_long, 4, 0);
         }
 #ifdef RECOMPILER_DEBUG
         else
                 fatal("MEM_STORE_ABS - %02x\n", uop->src_reg_b_real);
 #endif
-        host_x86_TEST32_REG(block, REG_ESI, REG_ESI);
-        host_x86_JNZ(block, codegen_exit_rout);
 
         return 0;
 }
@@ -1102,9 +1172,7 @@ static int codegen_MEM_STORE_IMM_8(codeblock_t *block, uop_t *uop)
 
         host_x86_LEA_REG_REG(block, REG_ESI, seg_reg, addr_reg);
         host_x86_MOV8_REG_IMM(block, REG_ECX, uop->imm_data);
-        host_x86_CALL(block, codegen_mem_store_byte);
-        host_x86_TEST32_REG(block, REG_ESI, REG_ESI);
-        host_x86_JNZ(block, codegen_exit_rout);
+        codegen_mem_store(block, codegen_mem_store_byte, 1, 0);
 
         return 0;
 }
@@ -1114,9 +1182,7 @@ static int codegen_MEM_STORE_IMM_16(codeblock_t *block, uop_t *uop)
 
         host_x86_LEA_REG_REG(block, REG_ESI, seg_reg, addr_reg);
         host_x86_MOV16_REG_IMM(block, REG_ECX, uop->imm_data);
-        host_x86_CALL(block, codegen_mem_store_word);
-        host_x86_TEST32_REG(block, REG_ESI, REG_ESI);
-        host_x86_JNZ(block, codegen_exit_rout);
+        codegen_mem_store(block, codegen_mem_store_word, 2, 0);
 
         return 0;
 }
@@ -1126,9 +1192,7 @@ static int codegen_MEM_STORE_IMM_32(codeblock_t *block, uop_t *uop)
 
         host_x86_LEA_REG_REG(block, REG_ESI, seg_reg, addr_reg);
         host_x86_MOV32_REG_IMM(block, REG_ECX, uop->imm_data);
-        host_x86_CALL(block, codegen_mem_store_long);
-        host_x86_TEST32_REG(block, REG_ESI, REG_ESI);
-        host_x86_JNZ(block, codegen_exit_rout);
+        codegen_mem_store(block, codegen_mem_store_long, 4, 0);
 
         return 0;
 }
@@ -1144,29 +1208,27 @@ static int codegen_MEM_STORE_REG(codeblock_t *block, uop_t *uop)
         if (REG_IS_B(src_size))
         {
                 host_x86_MOV8_REG_REG(block, REG_ECX, src_reg);
-                host_x86_CALL(block, codegen_mem_store_byte);
+                codegen_mem_store(block, codegen_mem_store_byte, 1, 0);
         }
         else if (REG_IS_W(src_size))
         {
                 host_x86_MOV16_REG_REG(block, REG_ECX, src_reg);
-                host_x86_CALL(block, codegen_mem_store_word);
+                codegen_mem_store(block, codegen_mem_store_word, 2, 0);
         }
         else if (REG_IS_L(src_size))
         {
                 host_x86_MOV32_REG_REG(block, REG_ECX, src_reg);
-                host_x86_CALL(block, codegen_mem_store_long);
+                codegen_mem_store(block, codegen_mem_store_long, 4, 0);
         }
         else if (REG_IS_Q(src_size))
         {
                 host_x86_MOVQ_XREG_XREG(block, REG_XMM_TEMP, src_reg);
-                host_x86_CALL(block, codegen_mem_store_quad);
+                codegen_mem_store(block, codegen_mem_store_quad, 8, 0);
         }
 #ifdef RECOMPILER_DEBUG
         else
                 fatal("MEM_STORE_REG - %02x\n", uop->src_reg_b_real);
 #endif
-        host_x86_TEST32_REG(block, REG_ESI, REG_ESI);
-        host_x86_JNZ(block, codegen_exit_rout);
 
         return 0;
 }
@@ -1184,9 +1246,7 @@ static int codegen_MEM_STORE_SINGLE(codeblock_t *block, uop_t *uop)
         if (uop->imm_data)
                 host_x86_ADD32_REG_IMM(block, REG_ESI, uop->imm_data);
         host_x86_CVTSD2SS_XREG_XREG(block, REG_XMM_TEMP, src_reg);
-        host_x86_CALL(block, codegen_mem_store_single);
-        host_x86_TEST32_REG(block, REG_ESI, REG_ESI);
-        host_x86_JNZ(block, codegen_exit_rout);
+        codegen_mem_store(block, codegen_mem_store_single, 4, 1);
 
         return 0;
 }
@@ -1203,9 +1263,7 @@ static int codegen_MEM_STORE_DOUBLE(codeblock_t *block, uop_t *uop)
         if (uop->imm_data)
                 host_x86_ADD32_REG_IMM(block, REG_ESI, uop->imm_data);
         host_x86_MOVQ_XREG_XREG(block, REG_XMM_TEMP, src_reg);
-        host_x86_CALL(block, codegen_mem_store_double);
-        host_x86_TEST32_REG(block, REG_ESI, REG_ESI);
-        host_x86_JNZ(block, codegen_exit_rout);
+        codegen_mem_store(block, codegen_mem_store_double, 8, 1);
 
         return 0;
 }
@@ -66,7 +66,7 @@ static void build_load_routine(codeblock_t *block, int size, int is_float)
         /*MOV ECX, ESI
           SHR ESI, 12
           MOV ESI, [readlookup2+ESI*4]
-          CMP ESI, -1
+          CMP ESI, LOOKUP_INV
           JNZ +
           MOVZX ECX, B[ESI+ECX]
           XOR ESI,ESI
@@ -89,7 +89,7 @@ static void build_load_routine(codeblock_t *block, int size, int is_float)
                 host_x86_TEST32_REG_IMM(block, REG_ECX, size-1);
                 misaligned_offset = host_x86_JNZ_short(block);
         }
-        host_x86_CMP32_REG_IMM(block, REG_ESI, (uint32_t)-1);
+        host_x86_CMP32_REG_IMM(block, REG_ESI, LOOKUP_INV);
         branch_offset = host_x86_JZ_short(block);
         if (size == 1 && !is_float)
                 host_x86_MOVZX_BASE_INDEX_32_8(block, REG_ECX, REG_ESI, REG_ECX);
@@ -156,7 +156,7 @@ static void build_store_routine(codeblock_t *block, int size, int is_float)
         /*MOV EDI, ESI
           SHR ESI, 12
           MOV ESI, [writelookup2+ESI*4]
-          CMP ESI, -1
+          CMP ESI, LOOKUP_INV
           JNZ +
           MOV [ESI+EDI], ECX
           XOR ESI,ESI
@@ -179,7 +179,7 @@ static void build_store_routine(codeblock_t *block, int size, int is_float)
                 host_x86_TEST32_REG_IMM(block, REG_EDI, size-1);
                 misaligned_offset = host_x86_JNZ_short(block);
         }
-        host_x86_CMP32_REG_IMM(block, REG_ESI, (uint32_t)-1);
+        host_x86_CMP32_REG_IMM(block, REG_ESI, LOOKUP_INV);
         branch_offset = host_x86_JZ_short(block);
         if (size == 1 && !is_float)
                 host_x86_MOV8_BASE_INDEX_REG(block, REG_ESI, REG_EDI, REG_ECX);
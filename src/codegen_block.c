@@ -38,6 +38,7 @@ int cpu_recomp_flushes, cpu_recomp_flushes_latched;
 int cpu_recomp_evicted, cpu_recomp_evicted_latched;
 int cpu_recomp_reuse, cpu_recomp_reuse_latched;
 int cpu_recomp_removed, cpu_recomp_removed_latched;
+int cpu_recomp_imm_avoided, cpu_recomp_imm_avoided_latched;
 
 uint32_t codegen_endpc;
 
@@ -499,6 +500,22 @@ void codegen_delete_random_block(int required_mem_block)
         }
 }
 
+/*Record whether the writes that are about to invalidate this block landed only
+  on immediate/displacement bytes. If so, recompiling with
+  CODEBLOCK_NO_IMMEDIATES will stop the block being invalidated again*/
+static void block_check_imm_dirty(codeblock_t *block)
+{
+        uint64_t code_dirty = *block->dirty_mask & block->page_mask & ~block->imm_mask;
+
+        if (block->page_mask2 && block->dirty_mask2)
+                code_dirty |= *block->dirty_mask2 & block->page_mask2 & ~block->imm_mask2;
+
+        if ((block->flags & CODEBLOCK_BYTE_MASK) && !code_dirty)
+                block->flags |= CODEBLOCK_IMM_DIRTY;
+        else
+                block->flags &= ~CODEBLOCK_IMM_DIRTY;
+}
+
 void codegen_check_flush(page_t *page, uint64_t mask, uint32_t phys_addr)
 {
         uint16_t block_nr = page->block;
@@ -513,9 +530,12 @@ void codegen_check_flush(page_t *page, uint64_t mask, uint32_t phys_addr)
                 if (*block->dirty_mask & block->page_mask)
                 {
 //                        pclog("Delete block from codegen_check_flush %08x %08x  %016llx %016llx %016llx  %02x\n", phys_addr, block->pc, *block->dirty_mask, block->page_mask, *block->dirty_mask & block->page_mask, block->flags);
+                        block_check_imm_dirty(block);
                         invalidate_block(block);
                         cpu_recomp_evicted++;
                 }
+                else if (*block->dirty_mask & block->imm_mask)
+                        cpu_recomp_imm_avoided++;
 #ifndef RELEASE_BUILD
                 if (block_nr == next_block)
                         fatal("Broken 1\n");
@@ -533,9 +553,12 @@ void codegen_check_flush(page_t *page, uint64_t mask, uint32_t phys_addr)
                 if (*block->dirty_mask2 & block->page_mask2)
                 {
 //                        pclog("Delete block from codegen_check_flush2 %08x %08x\n", phys_addr, block->pc);*/
+                        block_check_imm_dirty(block);
                         invalidate_block(block);
                         cpu_recomp_evicted++;
                 }
+                else if (*block->dirty_mask2 & block->imm_mask2)
+                        cpu_recomp_imm_avoided++;
 #ifndef RELEASE_BUILD
                 if (block_nr == next_block)
                         fatal("Broken 2\n");
@@ -585,6 +608,7 @@ void codegen_block_init(uint32_t phys_addr)
         block->next = block->prev = BLOCK_INVALID;
         block->next_2 = block->prev_2 = BLOCK_INVALID;
         block->page_mask = block->page_mask2 = 0;
+        block->imm_mask = block->imm_mask2 = 0;
         block->flags = CODEBLOCK_STATIC_TOP;
 //        pclog("  block_init: %p flags = %x\n", block, block->flags);
         block->status = cpu_cur_status;
@@ -620,6 +644,7 @@ void codegen_block_start_recompile(codeblock_t *block)
         block->status = cpu_cur_status;
         
         block->page_mask = block->page_mask2 = 0;
+        block->imm_mask = block->imm_mask2 = 0;
         block->ins = 0;
 
         cpu_block_end = 0;
@@ -655,6 +680,7 @@ void codegen_block_start_recompile(codeblock_t *block)
         
         if (block->flags & CODEBLOCK_BYTE_MASK)
         {
+                page_ensure_byte_masks(page);
                 block->dirty_mask = &page->byte_dirty_mask[(block->phys >> PAGE_BYTE_MASK_SHIFT) & PAGE_BYTE_MASK_OFFSET_MASK];
                 block->dirty_mask2 = NULL;
         }
@@ -709,6 +735,7 @@ void codegen_block_generate_end_mask_recompile()
                         {
                                 int offset = (block->phys_2 >> PAGE_BYTE_MASK_SHIFT) & PAGE_BYTE_MASK_OFFSET_MASK;
                                 
+                                page_ensure_byte_masks(page_2);
                                 page_2->byte_code_present_mask[offset] |= block->page_mask2;
                                 block->dirty_mask2 = &page_2->byte_dirty_mask[offset];
                         }
@@ -918,3 +945,19 @@ void codegen_mark_code_present_multibyte(codeblock_t *block, uint32_t start_pc,
                 }
         }
 }
+
+void codegen_mark_immediate(codeblock_t *block, uint32_t start_pc, int len)
+{
+        uint32_t pc;
+
+        if (!(block->flags & CODEBLOCK_BYTE_MASK))
+                return;
+
+        for (pc = start_pc; pc < start_pc + len; pc++)
+        {
+                if ((pc ^ block->pc) & ~0x3f)
+                        block->imm_mask2 |= ((uint64_t)1 << (pc & PAGE_MASK_MASK));
+                else
+                        block->imm_mask |= ((uint64_t)1 << (pc & PAGE_MASK_MASK));
+        }
+}
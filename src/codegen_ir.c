@@ -53,9 +53,35 @@ static void duplicate_uop(ir_data_t *ir, uop_t *uop, int offset)
         }
 }
 
+/*Is this uOP a conditional jump over a block exit stub (MOV_IMM pc / JMP), that
+  is the only jump to its destination? If so, then lazy flags state only needs
+  to be written back on the exit stub, and can stay in host registers on the
+  path that takes the jump. This is the usual form of a CMP/TEST/DEC + Jcc pair.
+
+  The destination must be a uOP within the block that is not a barrier; the
+  jump lands after any flush emitted for a barrier, and the end of block flush
+  is emitted before the jump targets at the end are set, so in both cases the
+  taken path would skip the writeback of the deferred registers*/
+static int ir_is_exit_branch(ir_data_t *ir, int c)
+{
+        uop_t *uop = &ir->uops[c];
+        int dest = uop->jump_dest_uop;
+
+        if (!(uop->type & UOP_TYPE_JUMP) || dest != c+3)
+                return 0;
+        if ((ir->uops[c+1].type & UOP_MASK) != (UOP_MOV_IMM & UOP_MASK) || IREG_GET_REG(ir->uops[c+1].dest_reg_a.reg) != IREG_pc)
+                return 0;
+        if (ir->uops[c+2].type != UOP_JMP)
+                return 0;
+        if (dest >= ir->wr_pos || (ir->uops[dest].type & UOP_TYPE_BARRIER))
+                return 0;
+        return !(ir->uops[dest].type & UOP_TYPE_JUMP_DEST);
+}
+
 void codegen_ir_compile(ir_data_t *ir, codeblock_t *block)
 {
         int jump_target_at_end = -1;
+        int deferred_dest = -1;
         int c;
 
         if (codegen_unroll_count)
@@ -90,6 +116,12 @@ void codegen_ir_compile(ir_data_t *ir, codeblock_t *block)
                 
 //                pclog("uOP %i : %08x\n", c, uop->type);
 
+                if (c == deferred_dest)
+                {
+                        codegen_reg_end_defer();
+                        deferred_dest = -1;
+                }
+
                 if (uop->type & UOP_TYPE_BARRIER)
                         codegen_reg_flush_invalidate(ir, block);
 
@@ -147,7 +179,15 @@ void codegen_ir_compile(ir_data_t *ir, codeblock_t *block)
                         }
 
                         if (uop->type & UOP_TYPE_ORDER_BARRIER)
-                                codegen_reg_flush(ir, block);
+                        {
+                                if (ir_is_exit_branch(ir, c))
+                                {
+                                        codegen_reg_flush_defer_flags(ir, block);
+                                        deferred_dest = uop->jump_dest_uop;
+                                }
+                                else
+                                        codegen_reg_flush(ir, block);
+                        }
 
                         if (uop->type & UOP_TYPE_PARAMS_REGS)
                         {
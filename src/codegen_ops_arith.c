@@ -318,7 +318,7 @@ uint32_t ropADD_EAX_imm(codeblock_t *block, ir_data_t *ir, uint8_t opcode, uint3
                 fetchdat = fastreadl(cs + op_pc);
                 uop_ADD_IMM(ir, IREG_EAX, IREG_EAX, fetchdat);
                 uop_MOV_IMM(ir, IREG_flags_op2, fetchdat);
-                codegen_mark_code_present(block, cs+op_pc, 4);
+                codegen_mark_immediate_present(block, cs+op_pc, 4);
         }
 
         uop_MOV_IMM(ir, IREG_flags_op, FLAGS_ADD32);
@@ -1060,7 +1060,7 @@ uint32_t ropSUB_EAX_imm(codeblock_t *block, ir_data_t *ir, uint8_t opcode, uint3
         else
         {
                 fetchdat = fastreadl(cs + op_pc);
-                codegen_mark_code_present(block, cs+op_pc, 4);
+                codegen_mark_immediate_present(block, cs+op_pc, 4);
                 uop_SUB_IMM(ir, IREG_EAX, IREG_EAX, fetchdat);
                 uop_MOV_IMM(ir, IREG_flags_op2, fetchdat);
         }
@@ -1286,6 +1286,8 @@ uint32_t rop80(codeblock_t *block, ir_data_t *ir, uint8_t opcode, uint32_t fetch
                         skip_immediate = 1;
                         LOAD_IMMEDIATE_FROM_RAM_8(block, ir, IREG_temp0_B, cs+op_pc+1);
                 }
+                else
+                        codegen_mark_immediate(block, cs+op_pc+1, 1);
 
                 switch (fetchdat & 0x38)
                 {
@@ -1514,6 +1516,8 @@ uint32_t rop81_w(codeblock_t *block, ir_data_t *ir, uint8_t opcode, uint32_t fet
                         skip_immediate = 1;
                         LOAD_IMMEDIATE_FROM_RAM_16(block, ir, IREG_temp0_W, cs+op_pc+1);
                 }
+                else
+                        codegen_mark_immediate(block, cs+op_pc+1, 2);
 
                 switch (fetchdat & 0x38)
                 {
@@ -1650,6 +1654,8 @@ uint32_t rop81_w(codeblock_t *block, ir_data_t *ir, uint8_t opcode, uint32_t fet
                         skip_immediate = 1;
                         LOAD_IMMEDIATE_FROM_RAM_16(block, ir, IREG_temp2_W, cs+op_pc+1);
                 }
+                else
+                        codegen_mark_immediate(block, cs+op_pc+1, 2);
 
                 switch (fetchdat & 0x38)
                 {
@@ -1788,6 +1794,8 @@ uint32_t rop81_l(codeblock_t *block, ir_data_t *ir, uint8_t opcode, uint32_t fet
                         skip_immediate = 1;
                         LOAD_IMMEDIATE_FROM_RAM_32(block, ir, IREG_temp0, cs+op_pc+1);
                 }
+                else
+                        codegen_mark_immediate(block, cs+op_pc+1, 4);
 
                 switch (fetchdat & 0x38)
                 {
@@ -1924,6 +1932,8 @@ uint32_t rop81_l(codeblock_t *block, ir_data_t *ir, uint8_t opcode, uint32_t fet
                         skip_immediate = 1;
                         LOAD_IMMEDIATE_FROM_RAM_32(block, ir, IREG_temp2, cs+op_pc+1);
                 }
+                else
+                        codegen_mark_immediate(block, cs+op_pc+1, 4);
 
                 switch (fetchdat & 0x38)
                 {
@@ -89,12 +89,14 @@ static inline void CHECK_SEG_LIMITS(codeblock_t *block, ir_data_t *ir, x86seg *s
 
 static inline void LOAD_IMMEDIATE_FROM_RAM_8(codeblock_t *block, ir_data_t *ir, int dest_reg, uint32_t addr)
 {
+        codegen_mark_immediate(block, addr, 1);
         uop_MOVZX_REG_PTR_8(ir, dest_reg, get_ram_ptr(addr));
 }
 
 void LOAD_IMMEDIATE_FROM_RAM_16_unaligned(codeblock_t *block, ir_data_t *ir, int dest_reg, uint32_t addr);
 static inline void LOAD_IMMEDIATE_FROM_RAM_16(codeblock_t *block, ir_data_t *ir, int dest_reg, uint32_t addr)
 {
+        codegen_mark_immediate(block, addr, 2);
         if ((addr & 0xfff) == 0xfff)
                 LOAD_IMMEDIATE_FROM_RAM_16_unaligned(block, ir, dest_reg, addr);
         else
@@ -104,6 +106,7 @@ static inline void LOAD_IMMEDIATE_FROM_RAM_16(codeblock_t *block, ir_data_t *ir,
 void LOAD_IMMEDIATE_FROM_RAM_32_unaligned(codeblock_t *block, ir_data_t *ir, int dest_reg, uint32_t addr);
 static inline void LOAD_IMMEDIATE_FROM_RAM_32(codeblock_t *block, ir_data_t *ir, int dest_reg, uint32_t addr)
 {
+        codegen_mark_immediate(block, addr, 4);
         if ((addr & 0xfff) >= 0xffd)
                 LOAD_IMMEDIATE_FROM_RAM_32_unaligned(block, ir, dest_reg, addr);
         else
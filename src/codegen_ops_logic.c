@@ -43,7 +43,7 @@ uint32_t ropAND_EAX_imm(codeblock_t *block, ir_data_t *ir, uint8_t opcode, uint3
         else
         {
                 fetchdat = fastreadl(cs + op_pc);
-                codegen_mark_code_present(block, cs+op_pc, 4);
+                codegen_mark_immediate_present(block, cs+op_pc, 4);
                 uop_AND_IMM(ir, IREG_EAX, IREG_EAX, fetchdat);
         }
 
@@ -265,7 +265,7 @@ uint32_t ropOR_EAX_imm(codeblock_t *block, ir_data_t *ir, uint8_t opcode, uint32
         else
         {
                 fetchdat = fastreadl(cs + op_pc);
-                codegen_mark_code_present(block, cs+op_pc, 4);
+                codegen_mark_immediate_present(block, cs+op_pc, 4);
                 uop_OR_IMM(ir, IREG_EAX, IREG_EAX, fetchdat);
         }
 
@@ -486,7 +486,7 @@ uint32_t ropTEST_EAX_imm(codeblock_t *block, ir_data_t *ir, uint8_t opcode, uint
         else
         {
                 fetchdat = fastreadl(cs + op_pc);
-                codegen_mark_code_present(block, cs+op_pc, 4);
+                codegen_mark_immediate_present(block, cs+op_pc, 4);
                 uop_AND_IMM(ir, IREG_flags_res, IREG_EAX, fetchdat);
         }
 
@@ -614,7 +614,7 @@ uint32_t ropXOR_EAX_imm(codeblock_t *block, ir_data_t *ir, uint8_t opcode, uint3
         else
         {
                 fetchdat = fastreadl(cs + op_pc);
-                codegen_mark_code_present(block, cs+op_pc, 4);
+                codegen_mark_immediate_present(block, cs+op_pc, 4);
                 uop_XOR_IMM(ir, IREG_EAX, IREG_EAX, fetchdat);
         }
 
@@ -36,7 +36,7 @@ uint32_t ropMOV_rl_imm(codeblock_t *block, ir_data_t *ir, uint8_t opcode, uint32
         {
                 fetchdat = fastreadl(cs + op_pc);
                 uop_MOV_IMM(ir, IREG_32(opcode & 7), fetchdat);
-                codegen_mark_code_present(block, cs+op_pc, 4);
+                codegen_mark_immediate_present(block, cs+op_pc, 4);
         }
         return op_pc + 4;
 }
@@ -226,7 +226,7 @@ uint32_t ropMOV_EAX_abs(codeblock_t *block, ir_data_t *ir, uint8_t opcode, uint3
                 else
                 {
                         addr = fastreadl(cs + op_pc);
-                        codegen_mark_code_present(block, cs+op_pc, 4);
+                        codegen_mark_immediate_present(block, cs+op_pc, 4);
                 }
         }
         else
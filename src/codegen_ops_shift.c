@@ -511,7 +511,7 @@ uint32_t ropC1_l(codeblock_t *block, ir_data_t *ir, uint8_t opcode, uint32_t fet
         else
         {
                 uint8_t imm = fastreadb(cs + op_pc + 1) & 0x1f;
-                codegen_mark_code_present(block, cs+op_pc+1, 1);
+                codegen_mark_immediate_present(block, cs+op_pc+1, 1);
         
                 if (imm)
                         return shift_common_32(ir, fetchdat, op_pc, target_seg, imm) + 1;
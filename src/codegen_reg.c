@@ -29,6 +29,12 @@ typedef struct host_reg_set_t
 
 static host_reg_set_t host_reg_set, host_fp_reg_set;
 
+/*Host registers holding lazy flags state whose write back has been deferred
+  past a conditional block exit. These are written back by the exit stub, and
+  are pinned until the jump destination is reached*/
+static uint16_t host_reg_deferred;
+static ir_reg_t host_reg_deferred_regs[CODEGEN_HOST_REGS];
+
 enum
 {
         REG_BYTE,
@@ -251,6 +257,7 @@ void codegen_reg_reset()
         
         reg_dead_list = 0;
         max_version_refcount = 0;
+        host_reg_deferred = 0;
 }
 
 static inline int ir_get_refcount(ir_reg_t ir_reg)
@@ -589,7 +596,7 @@ void codegen_reg_alloc_register(ir_reg_t dest_reg_a, ir_reg_t src_reg_a, ir_reg_
 {
         int dest_reference = 0;
         
-        host_reg_set.locked = 0;
+        host_reg_set.locked = host_reg_deferred;
         host_fp_reg_set.locked = 0;
         
 /*        pclog("alloc_register: dst=%i.%i src_a=%i.%i src_b=%i.%i\n", dest_reg_a.reg, dest_reg_a.version,
@@ -857,6 +864,65 @@ void codegen_reg_flush(ir_data_t *ir, codeblock_t *block)
         }
 }
 
+static int ireg_is_lazy_flags(int ir_reg)
+{
+        return (ir_reg == IREG_flags_op || ir_reg == IREG_flags_res ||
+                ir_reg == IREG_flags_op1 || ir_reg == IREG_flags_op2);
+}
+
+void codegen_reg_flush_defer_flags(ir_data_t *ir, codeblock_t *block)
+{
+        host_reg_set_t *reg_set = &host_reg_set;
+        int nr_deferred = 0;
+        int c;
+
+        host_reg_deferred = 0;
+        for (c = 0; c < reg_set->nr_regs; c++)
+        {
+                /*Always leave one register free for the exit stub*/
+                if (nr_deferred == reg_set->nr_regs - 1)
+                        break;
+                if (!ir_reg_is_invalid(reg_set->regs[c]) && reg_set->dirty[c] &&
+                                ireg_is_lazy_flags(IREG_GET_REG(reg_set->regs[c].reg)) &&
+                                !(reg_set->reg_list[c].flags & HOST_REG_FLAG_VOLATILE))
+                {
+                        host_reg_deferred |= (1 << c);
+                        host_reg_deferred_regs[c] = reg_set->regs[c];
+                        reg_set->dirty[c] = 0;
+                        nr_deferred++;
+                }
+        }
+
+        codegen_reg_flush(ir, block);
+
+        for (c = 0; c < reg_set->nr_regs; c++)
+        {
+                if (host_reg_deferred & (1 << c))
+                        reg_set->dirty[c] = 1;
+        }
+}
+
+void codegen_reg_end_defer()
+{
+        host_reg_set_t *reg_set = &host_reg_set;
+        int c;
+
+        for (c = 0; c < reg_set->nr_regs; c++)
+        {
+                if (host_reg_deferred & (1 << c))
+                {
+#ifndef RELEASE_BUILD
+                        if (reg_set->regs[c].reg != host_reg_deferred_regs[c].reg || reg_set->regs[c].version != host_reg_deferred_regs[c].version)
+                                fatal("codegen_reg_end_defer - deferred register %i changed\n", c);
+#endif
+                        /*The exit stub wrote this register back, but the path
+                          that took the branch did not*/
+                        reg_set->dirty[c] = 1;
+                }
+        }
+        host_reg_deferred = 0;
+}
+
 void codegen_reg_flush_invalidate(ir_data_t *ir, codeblock_t *block)
 {
         host_reg_set_t *reg_set;
@@ -400,6 +400,12 @@ void codegen_reg_reset();
 void codegen_reg_flush(struct ir_data_t *ir, codeblock_t *block);
 /*Write back and evict all registers*/
 void codegen_reg_flush_invalidate(struct ir_data_t *ir, codeblock_t *block);
+/*Write back all dirty registers, except for lazy flags state, which is left
+  dirty for the following block exit stub to write back*/
+void codegen_reg_flush_defer_flags(struct ir_data_t *ir, codeblock_t *block);
+/*Jump destination after a deferred exit stub reached; mark deferred lazy flags
+  state as dirty again*/
+void codegen_reg_end_defer();
 
 /*Register ir_reg usage for this uOP. This ensures that required registers aren't evicted*/
 void codegen_reg_alloc_register(ir_reg_t dest_reg_a, ir_reg_t src_reg_a, ir_reg_t src_reg_b, ir_reg_t src_reg_c);
@@ -7,6 +7,7 @@
 #include "pci.h"
 #include "codegen.h"
 #include "x87_timings.h"
+#include "timer.h"
 
 int fpu_type;
 uint32_t cpu_features;
@@ -2204,3 +2205,64 @@ void cpu_set_nonturbo_divider(int divider)
                 cpu_set_turbo(0);
         }
 }
+
+/*Idle fast-forwarding. When the guest is halted (or, with cpu_idle_detect set,
+  spinning in a recognised idle loop) nothing can change until the next timer
+  event, so the remaining time up to that event is charged in one go rather than
+  re-executing the idle instructions. The skip is limited to what is left of the
+  current execution slice, so host input is polled and real time pacing works
+  as normal - the main thread simply sleeps for the time the guest was idle.*/
+int cpu_idle_detect;
+
+#define IDLE_POLL_THRESHOLD 16
+/*Polls further apart than this many CPU cycles are not considered part of the
+  same idle loop*/
+#define IDLE_POLL_WINDOW    2000
+
+static uint32_t idle_last_poll[CPU_IDLE_POLL_MAX];
+static int idle_poll_count[CPU_IDLE_POLL_MAX];
+
+int cpu_idle_skip(int min_cycles)
+{
+        int32_t remaining = (int32_t)(timer_target - (uint32_t)tsc) + 1;
+        int skip = min_cycles;
+
+        if (remaining > 0)
+        {
+                if (is386 || AT)
+                        skip = remaining;
+                else /*XT TSC runs at 14.318 MHz rather than the CPU clock*/
+                        skip = (int)(((uint64_t)remaining << 32) / xt_cpu_multi) + 1;
+        }
+        if (skip > cycles)
+                skip = cycles;
+        if (skip < min_cycles)
+                skip = min_cycles;
+
+        cycles -= skip;
+        return skip;
+}
+
+static uint32_t cpu_cycles_to_tsc(int c)
+{
+        if (is386 || AT)
+                return c;
+        return (uint32_t)(((uint64_t)c * xt_cpu_multi) >> 32);
+}
+
+void cpu_idle_poll(int type)
+{
+        uint32_t now = (uint32_t)tsc;
+
+        if (now - idle_last_poll[type] < cpu_cycles_to_tsc(IDLE_POLL_WINDOW))
+        {
+                if (idle_poll_count[type] < IDLE_POLL_THRESHOLD)
+                        idle_poll_count[type]++;
+                else
+                        now += cpu_cycles_to_tsc(cpu_idle_skip(0));
+        }
+        else
+                idle_poll_count[type] = 0;
+
+        idle_last_poll[type] = now;
+}
@@ -193,6 +193,23 @@ extern int cpu_use_dynarec;
 
 extern uint64_t xt_cpu_multi;
 
+/*Idle loop types recognised by cpu_idle_poll()*/
+enum
+{
+        CPU_IDLE_POLL_KBD = 0,  /*INT 16h keyboard status poll*/
+        CPU_IDLE_POLL_DOS,      /*INT 28h DOS idle callout*/
+        CPU_IDLE_POLL_PIT,      /*PIT counter read*/
+        CPU_IDLE_POLL_MAX
+};
+
+extern int cpu_idle_detect;
+/*Fast-forward to the next timer event, charging at least min_cycles. Returns
+  the number of cycles charged*/
+int cpu_idle_skip(int min_cycles);
+/*Note a poll that may be part of an idle loop, fast-forwarding once the guest
+  is clearly spinning. Only called when cpu_idle_detect is set*/
+void cpu_idle_poll(int type);
+
 extern int isa_cycles;
 #define ISA_CYCLES(x) (x * isa_cycles)
 
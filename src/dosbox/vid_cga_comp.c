@@ -3,6 +3,7 @@
 
 #include <stdlib.h>
 #include <stdint.h>
+#include <string.h>
 #include <math.h>
 
 #include "../ibm.h"
@@ -53,8 +54,14 @@ double mode_hue;
 double min_v;
 double max_v;
 
-double video_ri, video_rq, video_gi, video_gq, video_bi, video_bq;
+int video_ri, video_rq, video_gi, video_gq, video_bi, video_bq;
 int video_sharpness;
+
+/* Decode coefficients for each chroma phase, [r/g/b][phase]. Output pixel x
+   is Y + chroma_a[][x&3]*A + chroma_b[][x&3]*B, which folds the I/Q rotation
+   of each phase into the coefficients so the decode is the same for every
+   pixel. */
+static int chroma_a[3][4], chroma_b[3][4];
 int tandy_mode_control = 0;
 
 static bool new_cga = 0;
@@ -135,6 +142,20 @@ void update_cga16_color(uint8_t cgamode) {
         video_bi = (int) (bi*iq_adjust_i + bq*iq_adjust_q);
         video_bq = (int) (-bi*iq_adjust_q + bq*iq_adjust_i);
         video_sharpness = (int) (sharpness*256/100);
+
+        /* (I, Q) is (A, B), (-B, A), (-A, -B), (B, -A) for phases 0-3 */
+        chroma_a[0][0] =  video_ri; chroma_b[0][0] =  video_rq;
+        chroma_a[0][1] =  video_rq; chroma_b[0][1] = -video_ri;
+        chroma_a[0][2] = -video_ri; chroma_b[0][2] = -video_rq;
+        chroma_a[0][3] = -video_rq; chroma_b[0][3] =  video_ri;
+        chroma_a[1][0] =  video_gi; chroma_b[1][0] =  video_gq;
+        chroma_a[1][1] =  video_gq; chroma_b[1][1] = -video_gi;
+        chroma_a[1][2] = -video_gi; chroma_b[1][2] = -video_gq;
+        chroma_a[1][3] = -video_gq; chroma_b[1][3] =  video_gi;
+        chroma_a[2][0] =  video_bi; chroma_b[2][0] =  video_bq;
+        chroma_a[2][1] =  video_bq; chroma_b[2][1] = -video_bi;
+        chroma_a[2][2] = -video_bi; chroma_b[2][2] = -video_bq;
+        chroma_a[2][3] = -video_bq; chroma_b[2][3] =  video_bi;
 }
 
 static Bit8u byte_clamp(int v) {
@@ -148,31 +169,15 @@ static Bit8u byte_clamp(int v) {
 static int temp[SCALER_MAXWIDTH + 10]={0};
 static int atemp[SCALER_MAXWIDTH + 2]={0};
 static int btemp[SCALER_MAXWIDTH + 2]={0};
+static Bit32u rgbtemp[SCALER_MAXWIDTH]={0};
 
 Bit8u * Composite_Process(uint8_t cgamode, Bit8u border, Bit32u blocks/*, bool doublewidth*/, Bit8u *TempLine)
 {
-	int x;
+	int x, p;
 	Bit32u x2;
 
         int w = blocks*4;
 
-#define COMPOSITE_CONVERT(I, Q) do { \
-        i[1] = (i[1]<<3) - ap[1]; \
-        a = ap[0]; \
-        b = bp[0]; \
-        c = i[0]+i[0]; \
-        d = i[-1]+i[1]; \
-        y = ((c+d)<<8) + video_sharpness*(c-d); \
-        rr = y + video_ri*(I) + video_rq*(Q); \
-        gg = y + video_gi*(I) + video_gq*(Q); \
-        bb = y + video_bi*(I) + video_bq*(Q); \
-        ++i; \
-        ++ap; \
-        ++bp; \
-        *srgb = (byte_clamp(rr)<<16) | (byte_clamp(gg)<<8) | byte_clamp(bb); \
-        ++srgb; \
-} while (0)
-
 #define OUT(v) do { *o = (v); ++o; } while (0)
 
         // Simulate CGA composite output
@@ -190,44 +195,51 @@ Bit8u * Composite_Process(uint8_t cgamode, Bit8u border, Bit32u blocks/*, bool d
         for (x = 0; x < 5; ++x)
                 OUT(b[x&3]);
 
+        /* The decode loops below only do independent integer arithmetic per
+           pixel on separate arrays, so the compiler can vectorise them. The
+           output goes to rgbtemp and is copied to TempLine at the end, as
+           TempLine still holds the input. */
         if ((cgamode & 4) != 0) {
                 // Decode
                 int* i = temp + 5;
-                Bit32u* srgb = (Bit32u *)TempLine;
-                for (x2 = 0; x2 < blocks*4; ++x2) {
-                        int c = (i[0]+i[0])<<3;
-                        int d = (i[-1]+i[1])<<3;
+                for (x = 0; x < w; ++x) {
+                        int c = (i[x]+i[x])<<3;
+                        int d = (i[x-1]+i[x+1])<<3;
                         int y = ((c+d)<<8) + video_sharpness*(c-d);
-                        ++i;
-                        *srgb = byte_clamp(y)*0x10101;
-                        ++srgb;
+                        rgbtemp[x] = byte_clamp(y)*0x10101;
                 }
         }
         else {
                 // Store chroma
-                int* i = temp + 4;
+                int* i = temp + 5;
                 int* ap = atemp + 1;
                 int* bp = btemp + 1;
                 for (x = -1; x < w + 1; ++x) {
-                        ap[x] = i[-4]-((i[-2]-i[0]+i[2])<<1)+i[4];
-                        bp[x] = (i[-3]-i[-1]+i[1]-i[3])<<1;
-                        ++i;
+                        ap[x] = i[x-4]-((i[x-2]-i[x]+i[x+2])<<1)+i[x+4];
+                        bp[x] = (i[x-3]-i[x-1]+i[x+1]-i[x+3])<<1;
                 }
 
+                // Remove chroma from the luma samples
+                for (x = -1; x < w + 1; ++x)
+                        i[x] = (i[x]<<3) - ap[x];
+
                 // Decode
-                i = temp + 5;
-                i[-1] = (i[-1]<<3) - ap[-1];
-                i[0] = (i[0]<<3) - ap[0];
-                Bit32u* srgb = (Bit32u *)TempLine;
                 for (x2 = 0; x2 < blocks; ++x2) {
-                        int y,a,b,c,d,rr,gg,bb;
-                        COMPOSITE_CONVERT(a, b);
-                        COMPOSITE_CONVERT(-b, a);
-                        COMPOSITE_CONVERT(-a, -b);
-                        COMPOSITE_CONVERT(b, -a);
+                        for (p = 0; p < 4; ++p) {
+                                int c = i[p]+i[p];
+                                int d = i[p-1]+i[p+1];
+                                int y = ((c+d)<<8) + video_sharpness*(c-d);
+                                int rr = y + chroma_a[0][p]*ap[p] + chroma_b[0][p]*bp[p];
+                                int gg = y + chroma_a[1][p]*ap[p] + chroma_b[1][p]*bp[p];
+                                int bb = y + chroma_a[2][p]*ap[p] + chroma_b[2][p]*bp[p];
+                                rgbtemp[(x2 << 2) + p] = (byte_clamp(rr)<<16) | (byte_clamp(gg)<<8) | byte_clamp(bb);
+                        }
+                        i += 4;
+                        ap += 4;
+                        bp += 4;
                 }
         }
-#undef COMPOSITE_CONVERT
+        memcpy(TempLine, rgbtemp, w*4);
 #undef OUT
 
         return TempLine;
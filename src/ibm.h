@@ -31,6 +31,10 @@ int writelookup[256],writelookupp[256];
 uintptr_t *writelookup2;
 int writelnext;
 
+/*Value of readlookup2[]/writelookup2[] entries with no cached translation. This
+  is zero so the tables can be allocated as demand-zero memory*/
+#define LOOKUP_INV 0
+
 extern int mmu_perm;
 
 uint8_t readmembl(uint32_t addr);
@@ -1,3 +1,4 @@
+#include <string.h>
 #include "ibm.h"
 #include "amstrad.h"
 #include "ide.h"
@@ -5,37 +6,86 @@
 #include "video.h"
 #include "cpu.h"
 
-uint8_t  (*port_inb[0x10000][2])(uint16_t addr, void *priv);
-uint16_t (*port_inw[0x10000][2])(uint16_t addr, void *priv);
-uint32_t (*port_inl[0x10000][2])(uint16_t addr, void *priv);
+/*Handler records. Each registration made by io_sethandler() gets a record
+  holding its handlers and priv pointer, shared between identical
+  registrations and freed once no port refers to it. port_handler[] holds up
+  to two record indices per port, so a port access touches one small index
+  entry and one record rather than seven separate tables. Record 0 has no
+  handlers and marks an empty slot.*/
+typedef struct io_handler_t
+{
+        uint8_t  (*inb)(uint16_t addr, void *priv);
+        uint16_t (*inw)(uint16_t addr, void *priv);
+        uint32_t (*inl)(uint16_t addr, void *priv);
+        void (*outb)(uint16_t addr, uint8_t  val, void *priv);
+        void (*outw)(uint16_t addr, uint16_t val, void *priv);
+        void (*outl)(uint16_t addr, uint32_t val, void *priv);
+        void *priv;
+        int refcount;
+} io_handler_t;
+
+#define IO_HANDLER_NR 4096
 
-void (*port_outb[0x10000][2])(uint16_t addr, uint8_t  val, void *priv);
-void (*port_outw[0x10000][2])(uint16_t addr, uint16_t val, void *priv);
-void (*port_outl[0x10000][2])(uint16_t addr, uint32_t val, void *priv);
+static io_handler_t io_handlers[IO_HANDLER_NR];
+static int io_handler_top = 1;
+static uint16_t port_handler[0x10000][2];
 
-void *port_priv[0x10000][2];
+uint32_t io_handler_gen = 1;
+io_port_resolved_t io_port_resolved[0x100];
 
 void io_init()
 {
-        int c;
         pclog("io_init\n");
-        for (c = 0; c < 0x10000; c++)
+        io_handler_gen++;
+        memset(io_handlers, 0, sizeof(io_handlers));
+        memset(port_handler, 0, sizeof(port_handler));
+        io_handler_top = 1;
+}
+
+/*Find a record matching the given handlers, or allocate a new one. The
+  returned record is only kept if a port takes a reference to it*/
+static int io_handler_get(uint8_t  (*inb)(uint16_t addr, void *priv), 
+                          uint16_t (*inw)(uint16_t addr, void *priv), 
+                          uint32_t (*inl)(uint16_t addr, void *priv), 
+                          void (*outb)(uint16_t addr, uint8_t  val, void *priv),
+                          void (*outw)(uint16_t addr, uint16_t val, void *priv),
+                          void (*outl)(uint16_t addr, uint32_t val, void *priv),
+                          void *priv)
+{
+        io_handler_t *h;
+        int free_idx = 0;
+        int c;
+
+        for (c = 1; c < io_handler_top; c++)
         {
-                port_inb[c][0]  = NULL;
-                port_inw[c][0]  = NULL;
-                port_inl[c][0]  = NULL;
-                port_outb[c][0] = NULL;
-                port_outw[c][0] = NULL;
-                port_outl[c][0] = NULL;
-                port_inb[c][1]  = NULL;
-                port_inw[c][1]  = NULL;
-                port_inl[c][1]  = NULL;
-                port_outb[c][1] = NULL;
-                port_outw[c][1] = NULL;
-                port_outl[c][1] = NULL;
-                port_priv[c][0] = NULL;
-                port_priv[c][1] = NULL;
+                h = &io_handlers[c];
+                if (!h->refcount)
+                {
+                        if (!free_idx)
+                                free_idx = c;
+                }
+                else if (h->inb == inb && h->inw == inw && h->inl == inl &&
+                         h->outb == outb && h->outw == outw && h->outl == outl && h->priv == priv)
+                        return c;
         }
+        if (!free_idx)
+        {
+                if (io_handler_top >= IO_HANDLER_NR)
+                        fatal("io_handler_get : out of handler records\n");
+                free_idx = io_handler_top++;
+        }
+
+        h = &io_handlers[free_idx];
+        h->inb  = inb;
+        h->inw  = inw;
+        h->inl  = inl;
+        h->outb = outb;
+        h->outw = outw;
+        h->outl = outl;
+        h->priv = priv;
+        h->refcount = 0;
+
+        return free_idx;
 }
 
 void io_sethandler(uint16_t base, int size, 
@@ -48,29 +98,26 @@ void io_sethandler(uint16_t base, int size,
                    void *priv)
 {
         int c;
+        int idx;
+
+        if (!inb && !inw && !inl && !outb && !outw && !outl)
+                return;
+
+        io_handler_gen++;
+        idx = io_handler_get(inb, inw, inl, outb, outw, outl, priv);
         for (c = 0; c < size; c++)
         {
-                if (!port_inb[ base + c][0] && !port_inw[ base + c][0] && !port_inl[ base + c][0] &&
-                    !port_outb[base + c][0] && !port_outw[base + c][0] && !port_outl[base + c][0])
+                uint16_t *slot = port_handler[(uint16_t)(base + c)];
+
+                if (!slot[0])
                 {
-                        port_inb[ base + c][0] = inb;
-                        port_inw[ base + c][0] = inw;
-                        port_inl[ base + c][0] = inl;
-                        port_outb[base + c][0] = outb;
-                        port_outw[base + c][0] = outw;
-                        port_outl[base + c][0] = outl;
-                        port_priv[base + c][0] = priv;
+                        slot[0] = idx;
+                        io_handlers[idx].refcount++;
                 }
-                else if (!port_inb[ base + c][1] && !port_inw[ base + c][1] && !port_inl[ base + c][1] &&
-                         !port_outb[base + c][1] && !port_outw[base + c][1] && !port_outl[base + c][1])
+                else if (!slot[1])
                 {
-                        port_inb[ base + c][1] = inb;
-                        port_inw[ base + c][1] = inw;
-                        port_inl[ base + c][1] = inl;
-                        port_outb[base + c][1] = outb;
-                        port_outw[base + c][1] = outw;
-                        port_outl[base + c][1] = outl;
-                        port_priv[base + c][1] = priv;
+                        slot[1] = idx;
+                        io_handlers[idx].refcount++;
                 }
         }
 }
@@ -84,44 +131,57 @@ void io_removehandler(uint16_t base, int size,
                    void (*outl)(uint16_t addr, uint32_t val, void *priv),
                    void *priv)
 {
-        int c;
+        int c, d;
+
+        io_handler_gen++;
         for (c = 0; c < size; c++)
         {
-                if (port_priv[base + c][0] == priv)
-                {
-                        if (port_inb[ base + c][0] == inb)
-                           port_inb[ base + c][0] = NULL;
-                        if (port_inw[ base + c][0] == inw)
-                           port_inw[ base + c][0] = NULL;
-                        if (port_inl[ base + c][0] == inl)
-                           port_inl[ base + c][0] = NULL;
-                        if (port_outb[ base + c][0] == outb)
-                           port_outb[ base + c][0] = NULL;
-                        if (port_outw[ base + c][0] == outw)
-                           port_outw[ base + c][0] = NULL;
-                        if (port_outl[ base + c][0] == outl)
-                           port_outl[ base + c][0] = NULL;
-                        port_priv[base + c][0] = NULL;
-                }
-                if (port_priv[base + c][1] == priv)
+                uint16_t *slot = port_handler[(uint16_t)(base + c)];
+
+                for (d = 0; d < 2; d++)
                 {
-                        if (port_inb[ base + c][1] == inb)
-                           port_inb[ base + c][1] = NULL;
-                        if (port_inw[ base + c][1] == inw)
-                           port_inw[ base + c][1] = NULL;
-                        if (port_inl[ base + c][1] == inl)
-                           port_inl[ base + c][1] = NULL;
-                        if (port_outb[ base + c][1] == outb)
-                           port_outb[ base + c][1] = NULL;
-                        if (port_outw[ base + c][1] == outw)
-                           port_outw[ base + c][1] = NULL;
-                        if (port_outl[ base + c][1] == outl)
-                           port_outl[ base + c][1] = NULL;
-                        port_priv[base + c][1] = NULL;
+                        io_handler_t *h = &io_handlers[slot[d]];
+
+                        if (slot[d] && h->priv == priv)
+                        {
+                                /*Only the matching handlers are removed; any
+                                  left over stay registered without a priv*/
+                                uint8_t  (*new_inb)(uint16_t addr, void *priv) = (h->inb == inb) ? NULL : h->inb;
+                                uint16_t (*new_inw)(uint16_t addr, void *priv) = (h->inw == inw) ? NULL : h->inw;
+                                uint32_t (*new_inl)(uint16_t addr, void *priv) = (h->inl == inl) ? NULL : h->inl;
+                                void (*new_outb)(uint16_t addr, uint8_t  val, void *priv) = (h->outb == outb) ? NULL : h->outb;
+                                void (*new_outw)(uint16_t addr, uint16_t val, void *priv) = (h->outw == outw) ? NULL : h->outw;
+                                void (*new_outl)(uint16_t addr, uint32_t val, void *priv) = (h->outl == outl) ? NULL : h->outl;
+
+                                h->refcount--;
+                                slot[d] = 0;
+                                if (new_inb || new_inw || new_inl || new_outb || new_outw || new_outl)
+                                {
+                                        slot[d] = io_handler_get(new_inb, new_inw, new_inl, new_outb, new_outw, new_outl, NULL);
+                                        io_handlers[slot[d]].refcount++;
+                                }
+                        }
                 }
         }
 }
 
+void io_port_resolve(uint8_t port)
+{
+        io_port_resolved_t *r = &io_port_resolved[port];
+        io_handler_t *h = &io_handlers[port_handler[port][0]];
+        int single = !port_handler[port][1];
+
+        r->inb  = single ? h->inb  : NULL;
+        r->inw  = single ? h->inw  : NULL;
+        r->inl  = single ? h->inl  : NULL;
+        r->outb = single ? h->outb : NULL;
+        r->outw = single ? h->outw : NULL;
+        r->outl = single ? h->outl : NULL;
+        r->priv = h->priv;
+        r->latch = (port & 0x80) ? AMSTRAD_NOLATCH : AMSTRAD_SW9;
+        r->gen = io_handler_gen;
+}
+
 uint8_t cgamode,cgastat=0,cgacol;
 int hsync;
 uint8_t lpt2dat;
@@ -129,12 +189,18 @@ int sw9;
 int t237=0;
 uint8_t inb(uint16_t port)
 {
+        uint16_t *slot = port_handler[port];
+        io_handler_t *h = &io_handlers[slot[0]];
         uint8_t temp = 0xff;
 
-        if (port_inb[port][0])
-           temp &= port_inb[port][0](port, port_priv[port][0]);
-        if (port_inb[port][1])
-           temp &= port_inb[port][1](port, port_priv[port][1]);
+        if (h->inb)
+           temp &= h->inb(port, h->priv);
+        if (slot[1])
+        {
+                h = &io_handlers[slot[1]];
+                if (h->inb)
+                   temp &= h->inb(port, h->priv);
+        }
            
         if (port & 0x80)
                 amstrad_latch = AMSTRAD_NOLATCH;
@@ -143,7 +209,7 @@ uint8_t inb(uint16_t port)
         else
                 amstrad_latch = AMSTRAD_SW9;
 
-/*           if (!port_inb[port][0] && !port_inb[port][1])
+/*           if (!h->inb && !slot[1])
            	pclog("Bad INB %04X %04X:%04X\n", port, CS, pc);*/
            	
         return temp;
@@ -153,39 +219,54 @@ uint8_t cpu_readport(uint32_t port) { return inb(port); }
 
 void outb(uint16_t port, uint8_t val)
 {
-        if (port_outb[port][0])
-           port_outb[port][0](port, val, port_priv[port][0]);
-        if (port_outb[port][1])
-           port_outb[port][1](port, val, port_priv[port][1]);
+        uint16_t *slot = port_handler[port];
+        io_handler_t *h = &io_handlers[slot[0]];
+
+        if (h->outb)
+           h->outb(port, val, h->priv);
+        if (slot[1])
+        {
+                h = &io_handlers[slot[1]];
+                if (h->outb)
+                   h->outb(port, val, h->priv);
+        }
         
-/*        if (!port_outb[port][0] && !port_outb[port][1])
+/*        if (!h->outb && !slot[1])
         	pclog("Bad OUTB %04X %02X %04X:%08X\n", port, val, CS, pc);*/
         return;
 }
 
 uint16_t inw(uint16_t port)
 {
+        uint16_t *slot = port_handler[port];
+        io_handler_t *h = &io_handlers[slot[0]];
+
 //        pclog("INW %04X\n", port);
-        if (port_inw[port][0])
-           return port_inw[port][0](port, port_priv[port][0]);
-        if (port_inw[port][1])
-           return port_inw[port][1](port, port_priv[port][1]);
+        if (h->inw)
+           return h->inw(port, h->priv);
+        h = &io_handlers[slot[1]];
+        if (h->inw)
+           return h->inw(port, h->priv);
            
         return inb(port) | (inb(port + 1) << 8);
 }
 
 void outw(uint16_t port, uint16_t val)
 {
+        uint16_t *slot = port_handler[port];
+        io_handler_t *h0 = &io_handlers[slot[0]];
+        io_handler_t *h1 = &io_handlers[slot[1]];
+
 //        printf("OUTW %04X %04X %04X:%08X\n",port,val, CS, pc);
 /*        if ((port & ~0xf) == 0xf000)
            pclog("OUTW %04X %04X\n", port, val);*/
 
-        if (port_outw[port][0])
-           port_outw[port][0](port, val, port_priv[port][0]);
-        if (port_outw[port][1])
-           port_outw[port][1](port, val, port_priv[port][1]);
+        if (h0->outw)
+           h0->outw(port, val, h0->priv);
+        if (h1->outw)
+           h1->outw(port, val, h1->priv);
 
-        if (port_outw[port][0] || port_outw[port][1])
+        if (h0->outw || h1->outw)
            return;
 
         outb(port,val);
@@ -194,26 +275,34 @@ void outw(uint16_t port, uint16_t val)
 
 uint32_t inl(uint16_t port)
 {
+        uint16_t *slot = port_handler[port];
+        io_handler_t *h = &io_handlers[slot[0]];
+
 //        pclog("INL %04X\n", port);
-        if (port_inl[port][0])
-           return port_inl[port][0](port, port_priv[port][0]);
-        if (port_inl[port][1])
-           return port_inl[port][1](port, port_priv[port][1]);
+        if (h->inl)
+           return h->inl(port, h->priv);
+        h = &io_handlers[slot[1]];
+        if (h->inl)
+           return h->inl(port, h->priv);
            
         return inw(port) | (inw(port + 2) << 16);
 }
 
 void outl(uint16_t port, uint32_t val)
 {
+        uint16_t *slot = port_handler[port];
+        io_handler_t *h0 = &io_handlers[slot[0]];
+        io_handler_t *h1 = &io_handlers[slot[1]];
+
 /*        if ((port & ~0xf) == 0xf000)
            pclog("OUTL %04X %08X\n", port, val);*/
 
-        if (port_outl[port][0])
-           port_outl[port][0](port, val, port_priv[port][0]);
-        if (port_outl[port][1])
-           port_outl[port][1](port, val, port_priv[port][1]);
+        if (h0->outl)
+           h0->outl(port, val, h0->priv);
+        if (h1->outl)
+           h1->outl(port, val, h1->priv);
 
-        if (port_outl[port][0] || port_outl[port][1])
+        if (h0->outl || h1->outl)
            return;
                 
         outw(port, val);
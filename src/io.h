@@ -1,5 +1,91 @@
 void io_init();
 
+/*Handlers for a port in the range reachable by the IN/OUT imm8 forms, resolved
+  down to a single device so constant port accesses can call it directly.
+  Records are revalidated against io_handler_gen, which is bumped whenever a
+  handler is added or removed. Function pointers are NULL when the port isn't
+  owned by exactly one device, in which case the generic path is used*/
+typedef struct io_port_resolved_t
+{
+        uint32_t gen;
+        uint8_t  (*inb)(uint16_t addr, void *priv);
+        uint16_t (*inw)(uint16_t addr, void *priv);
+        uint32_t (*inl)(uint16_t addr, void *priv);
+        void (*outb)(uint16_t addr, uint8_t  val, void *priv);
+        void (*outw)(uint16_t addr, uint16_t val, void *priv);
+        void (*outl)(uint16_t addr, uint32_t val, void *priv);
+        void *priv;
+        int latch;
+} io_port_resolved_t;
+
+extern uint32_t io_handler_gen;
+extern io_port_resolved_t io_port_resolved[0x100];
+extern int amstrad_latch;
+
+void io_port_resolve(uint8_t port);
+
+static inline io_port_resolved_t *io_get_resolved(uint8_t port)
+{
+        io_port_resolved_t *r = &io_port_resolved[port];
+
+        if (r->gen != io_handler_gen)
+                io_port_resolve(port);
+        return r;
+}
+
+static inline uint8_t inb_const(uint8_t port)
+{
+        io_port_resolved_t *r = io_get_resolved(port);
+
+        if (!r->inb)
+                return inb(port);
+        amstrad_latch = r->latch;
+        return r->inb(port, r->priv);
+}
+static inline uint16_t inw_const(uint8_t port)
+{
+        io_port_resolved_t *r = io_get_resolved(port);
+
+        if (!r->inw)
+                return inw(port);
+        return r->inw(port, r->priv);
+}
+static inline uint32_t inl_const(uint8_t port)
+{
+        io_port_resolved_t *r = io_get_resolved(port);
+
+        if (!r->inl)
+                return inl(port);
+        return r->inl(port, r->priv);
+}
+static inline void outb_const(uint8_t port, uint8_t val)
+{
+        io_port_resolved_t *r = io_get_resolved(port);
+
+        if (!r->outb)
+                outb(port, val);
+        else
+                r->outb(port, val, r->priv);
+}
+static inline void outw_const(uint8_t port, uint16_t val)
+{
+        io_port_resolved_t *r = io_get_resolved(port);
+
+        if (!r->outw)
+                outw(port, val);
+        else
+                r->outw(port, val, r->priv);
+}
+static inline void outl_const(uint8_t port, uint32_t val)
+{
+        io_port_resolved_t *r = io_get_resolved(port);
+
+        if (!r->outl)
+                outl(port, val);
+        else
+                r->outl(port, val, r->priv);
+}
+
 void io_sethandler(uint16_t base, int size, 
                    uint8_t  (*inb)(uint16_t addr, void *priv), 
                    uint16_t (*inw)(uint16_t addr, void *priv), 
@@ -11,6 +11,7 @@
 
 #include "config.h"
 #include "mem.h"
+#include "mem_host.h"
 #include "video.h"
 #include "x86.h"
 #include "cpu.h"
@@ -20,6 +21,7 @@
 #include "xi8088.h"
 
 page_t *pages;
+static int pages_sz;
 page_t **page_lookup;
 
 static mem_mapping_t  *read_mapping[0x40000];
@@ -46,8 +48,13 @@ int cachesize=256;
 uint8_t *ram, *rom = NULL;
 uint8_t romext[32768];
 
-uint64_t *byte_dirty_mask;
-uint64_t *byte_code_present_mask;
+/*Byte granularity dirty tracking is only needed for pages that hold
+  CODEBLOCK_BYTE_MASK blocks, so per-page masks are only allocated when the
+  first such block is compiled. Until then the page points at these shared
+  masks - writes land harmlessly in the dirty mask, and the code present mask
+  is never set so always reads as empty.*/
+uint64_t page_byte_mask_dummy_dirty[64];
+uint64_t page_byte_mask_dummy_code_present[64];
 
 uint32_t mem_logical_addr;
 
@@ -68,12 +75,25 @@ void resetreadlookup()
 {
         int c;
 //        /*if (output) */pclog("resetreadlookup\n");
-        memset(readlookup2,0xFF,1024*1024*sizeof(uintptr_t));
-        for (c=0;c<256;c++) readlookup[c]=0xFFFFFFFF;
+        /*Only entries listed in readlookup[]/writelookup[] can be valid, so
+          clear those rather than the whole tables. This keeps the untouched
+          parts of the tables from ever becoming resident*/
+        for (c=0;c<256;c++)
+        {
+                if (readlookup[c] != 0xFFFFFFFF)
+                        readlookup2[readlookup[c]] = LOOKUP_INV;
+                readlookup[c]=0xFFFFFFFF;
+        }
         readlnext=0;
-        memset(writelookup2,0xFF,1024*1024*sizeof(uintptr_t));
-        memset(page_lookup, 0, (1 << 20) * sizeof(page_t *));
-        for (c=0;c<256;c++) writelookup[c]=0xFFFFFFFF;
+        for (c=0;c<256;c++)
+        {
+                if (writelookup[c] != 0xFFFFFFFF)
+                {
+                        writelookup2[writelookup[c]] = LOOKUP_INV;
+                        page_lookup[writelookup[c]] = NULL;
+                }
+                writelookup[c]=0xFFFFFFFF;
+        }
         writelnext=0;
         pccache=0xFFFFFFFF;
 //        readlnum=writelnum=0;
@@ -86,20 +106,20 @@ void flushmmucache()
 //        /*if (output) */pclog("flushmmucache\n");
 /*        for (c=0;c<16;c++)
         {
-                if ( readlookup2[0xE0+c]!=0xFFFFFFFF) pclog("RL2 %02X = %08X\n",0xE0+c, readlookup2[0xE0+c]);
-                if (writelookup2[0xE0+c]!=0xFFFFFFFF) pclog("WL2 %02X = %08X\n",0xE0+c,writelookup2[0xE0+c]);
+                if ( readlookup2[0xE0+c]!=LOOKUP_INV) pclog("RL2 %02X = %08X\n",0xE0+c, readlookup2[0xE0+c]);
+                if (writelookup2[0xE0+c]!=LOOKUP_INV) pclog("WL2 %02X = %08X\n",0xE0+c,writelookup2[0xE0+c]);
         }*/
         for (c=0;c<256;c++)
         {
                 if (readlookup[c]!=0xFFFFFFFF)
                 {
-                        readlookup2[readlookup[c]] = -1;
+                        readlookup2[readlookup[c]] = LOOKUP_INV;
                         readlookup[c]=0xFFFFFFFF;
                 }
                 if (writelookup[c] != 0xFFFFFFFF)
                 {
                         page_lookup[writelookup[c]] = NULL;
-                        writelookup2[writelookup[c]] = -1;
+                        writelookup2[writelookup[c]] = LOOKUP_INV;
                         writelookup[c] = 0xFFFFFFFF;
                 }
         }
@@ -116,13 +136,13 @@ void flushmmucache()
 
 /*        for (c = 0; c < 1024*1024; c++)
         {
-                if (readlookup2[c] != 0xFFFFFFFF)
+                if (readlookup2[c] != LOOKUP_INV)
                 {
                         pclog("Readlookup inconsistency - %05X %08X\n", c, readlookup2[c]);
                         dumpregs();
                         exit(-1);
                 }
-                if (writelookup2[c] != 0xFFFFFFFF)
+                if (writelookup2[c] != LOOKUP_INV)
                 {
                         pclog("Readlookup inconsistency - %05X %08X\n", c, readlookup2[c]);
                         dumpregs();
@@ -139,13 +159,13 @@ void flushmmucache_nopc()
         {
                 if (readlookup[c]!=0xFFFFFFFF)
                 {
-                        readlookup2[readlookup[c]] = -1;
+                        readlookup2[readlookup[c]] = LOOKUP_INV;
                         readlookup[c]=0xFFFFFFFF;
                 }
                 if (writelookup[c] != 0xFFFFFFFF)
                 {
                         page_lookup[writelookup[c]] = NULL;
-                        writelookup2[writelookup[c]] = -1;
+                        writelookup2[writelookup[c]] = LOOKUP_INV;
                         writelookup[c] = 0xFFFFFFFF;
                 }
         }
@@ -159,25 +179,25 @@ void flushmmucache_cr3()
         {
                 if (readlookup[c]!=0xFFFFFFFF)// && !readlookupp[c])
                 {
-                        readlookup2[readlookup[c]] = -1;
+                        readlookup2[readlookup[c]] = LOOKUP_INV;
                         readlookup[c]=0xFFFFFFFF;
                 }
                 if (writelookup[c] != 0xFFFFFFFF)// && !writelookupp[c])
                 {
                         page_lookup[writelookup[c]] = NULL;
-                        writelookup2[writelookup[c]] = -1;
+                        writelookup2[writelookup[c]] = LOOKUP_INV;
                         writelookup[c] = 0xFFFFFFFF;                        
                 }
         }
 /*        for (c = 0; c < 1024*1024; c++)
         {
-                if (readlookup2[c] != 0xFFFFFFFF)
+                if (readlookup2[c] != LOOKUP_INV)
                 {
                         pclog("Readlookup inconsistency - %05X %08X\n", c, readlookup2[c]);
                         dumpregs();
                         exit(-1);
                 }
-                if (writelookup2[c] != 0xFFFFFFFF)
+                if (writelookup2[c] != LOOKUP_INV)
                 {
                         pclog("Readlookup inconsistency - %05X %08X\n", c, readlookup2[c]);
                         dumpregs();
@@ -203,7 +223,7 @@ void mem_flush_write_page(uint32_t addr, uint32_t virt)
                         if (writelookup2[writelookup[c]] == target || page_lookup[writelookup[c]] == page_target)
                         {
 //                                pclog("  throw out %02x %p %p\n", writelookup[c], (void *)page_lookup[writelookup[c]], (void *)writelookup2[writelookup[c]]);
-                                writelookup2[writelookup[c]] = -1;
+                                writelookup2[writelookup[c]] = LOOKUP_INV;
                                 page_lookup[writelookup[c]] = NULL;
                                 writelookup[c] = 0xffffffff;
                         }
@@ -357,12 +377,13 @@ void mmu_invalidate(uint32_t addr)
 
 void addreadlookup(uint32_t virt, uint32_t phys)
 {
+        uintptr_t lookup = (uintptr_t)&ram[(uintptr_t)(phys & ~0xFFF) - (uintptr_t)(virt & ~0xfff)];
 //        return;
 //        printf("Addreadlookup %08X %08X %08X %08X %08X %08X %02X %08X\n",virt,phys,cs,ds,es,ss,opcode,pc);
-        if (virt == 0xffffffff)
+        if (virt == 0xffffffff || lookup == LOOKUP_INV)
                 return;
                 
-        if (readlookup2[virt>>12] != -1) 
+        if (readlookup2[virt>>12] != LOOKUP_INV) 
         {
 /*                if (readlookup2[virt>>12] != phys&~0xfff)
                 {
@@ -376,10 +397,10 @@ void addreadlookup(uint32_t virt, uint32_t phys)
         
         if (readlookup[readlnext]!=0xFFFFFFFF)
         {
-                readlookup2[readlookup[readlnext]] = -1;
+                readlookup2[readlookup[readlnext]] = LOOKUP_INV;
 //                readlnum--;
         }
-        readlookup2[virt>>12] = (uintptr_t)&ram[(uintptr_t)(phys & ~0xFFF) - (uintptr_t)(virt & ~0xfff)];
+        readlookup2[virt>>12] = lookup;
         readlookupp[readlnext]=mmu_perm;
         readlookup[readlnext++]=virt>>12;
         readlnext&=(cachesize-1);
@@ -389,9 +410,10 @@ void addreadlookup(uint32_t virt, uint32_t phys)
 
 void addwritelookup(uint32_t virt, uint32_t phys)
 {
+        uintptr_t lookup = (uintptr_t)&ram[(uintptr_t)(phys & ~0xFFF) - (uintptr_t)(virt & ~0xfff)];
 //        return;
 //        printf("Addwritelookup %08X %08X\n",virt,phys);
-        if (virt == 0xffffffff)
+        if (virt == 0xffffffff || lookup == LOOKUP_INV)
                 return;
 
         if (page_lookup[virt >> 12])
@@ -408,16 +430,16 @@ void addwritelookup(uint32_t virt, uint32_t phys)
         if (writelookup[writelnext] != -1)
         {
                 page_lookup[writelookup[writelnext]] = NULL;
-                writelookup2[writelookup[writelnext]] = -1;
+                writelookup2[writelookup[writelnext]] = LOOKUP_INV;
 //                writelnum--;
         }
-//        if (page_lookup[virt >> 12] && (writelookup2[virt>>12] != 0xffffffff))
+//        if (page_lookup[virt >> 12] && (writelookup2[virt>>12] != LOOKUP_INV))
 //                fatal("Bad write mapping\n");
 
         if (pages[phys >> 12].block || (phys & ~0xfff) == recomp_page)
                 page_lookup[virt >> 12] = &pages[phys >> 12];//(uintptr_t)&ram[(uintptr_t)(phys & ~0xFFF) - (uintptr_t)(virt & ~0xfff)];
         else
-                writelookup2[virt>>12] = (uintptr_t)&ram[(uintptr_t)(phys & ~0xFFF) - (uintptr_t)(virt & ~0xfff)];
+                writelookup2[virt>>12] = lookup;
 //        pclog("addwritelookup %08x %08x %p %p %016llx %p\n", virt, phys, (void *)page_lookup[virt >> 12], (void *)writelookup2[virt >> 12], pages[phys >> 12].dirty_mask, (void *)&pages[phys >> 12]);
         writelookupp[writelnext] = mmu_perm;
         writelookup[writelnext++] = virt >> 12;
@@ -426,6 +448,87 @@ void addwritelookup(uint32_t virt, uint32_t phys)
         cycles -= 9;
 }
 
+/*Add a write translation from the page of the write access in progress
+  directly to host memory, with host being the host address of phys, for device memory where writes have no side effects
+  (eg an SVGA linear framebuffer in a packed pixel mode). write_l/p identify
+  the handler making the call; the translation is only added when that handler
+  is servicing phys as the mapping for it, and phys is what the current access
+  translates to. Entries are dropped by the usual MMU cache flushes, on any
+  mapping change, and by mem_flush_write_host_range()*/
+void mem_add_write_direct(uint32_t phys, uint8_t *host, void (*write_l)(uint32_t addr, uint32_t val, void *priv), void *p)
+{
+        uint32_t virt = mem_logical_addr;
+        mem_mapping_t *map = write_mapping[(phys & rammask) >> 14];
+        uint32_t check;
+        uintptr_t lookup;
+
+        if (virt == 0xffffffff || !map || map->write_l != write_l || map->p != p)
+                return;
+        if ((virt ^ phys) & 0xfff)
+                return;
+        check = (cr0 >> 31) ? mmutranslate_noabrt(virt, 1) : virt;
+        if (check == 0xffffffff || (check & rammask) != phys)
+                return;
+        if (page_lookup[virt >> 12] || writelookup2[virt >> 12] != LOOKUP_INV)
+                return;
+        lookup = (uintptr_t)(host - (phys & 0xfff)) - (uintptr_t)(virt & ~0xfff);
+        if (lookup == LOOKUP_INV)
+                return;
+
+        if (writelookup[writelnext] != -1)
+        {
+                page_lookup[writelookup[writelnext]] = NULL;
+                writelookup2[writelookup[writelnext]] = LOOKUP_INV;
+        }
+        writelookup2[virt >> 12] = lookup;
+        writelookupp[writelnext] = mmu_perm;
+        writelookup[writelnext++] = virt >> 12;
+        writelnext &= (cachesize - 1);
+}
+
+/*Drop write translations that point into host memory [base, base+size)*/
+void mem_flush_write_host_range(uint8_t *base, uint32_t size)
+{
+        int c;
+
+        for (c = 0; c < 256; c++)
+        {
+                if (writelookup[c] != 0xffffffff && writelookup2[writelookup[c]] != LOOKUP_INV)
+                {
+                        uint8_t *host = (uint8_t *)(writelookup2[writelookup[c]] + ((uintptr_t)writelookup[c] << 12));
+
+                        if (host >= base && host < base + size)
+                        {
+                                writelookup2[writelookup[c]] = LOOKUP_INV;
+                                writelookup[c] = 0xffffffff;
+                        }
+                }
+        }
+}
+
+/*Drop all write translations that don't point into guest RAM*/
+static void mem_flush_write_direct()
+{
+        int c;
+
+        if (!writelookup2 || !ram)
+                return;
+
+        for (c = 0; c < 256; c++)
+        {
+                if (writelookup[c] != 0xffffffff && writelookup2[writelookup[c]] != LOOKUP_INV)
+                {
+                        uint8_t *host = (uint8_t *)(writelookup2[writelookup[c]] + ((uintptr_t)writelookup[c] << 12));
+
+                        if (host < ram || host >= ram + mem_size * 1024)
+                        {
+                                writelookup2[writelookup[c]] = LOOKUP_INV;
+                                writelookup[c] = 0xffffffff;
+                        }
+                }
+        }
+}
+
 uint8_t *getpccache(uint32_t a)
 {
         uint32_t a2=a;
@@ -514,7 +617,7 @@ uint16_t readmemwl(uint32_t addr)
                         }
                         return readmembl(addr)|(readmembl(addr+1)<<8);
                 }
-                else if (readlookup2[addr >> 12] != -1)
+                else if (readlookup2[addr >> 12] != LOOKUP_INV)
                         return *(uint16_t *)(readlookup2[addr >> 12] + addr);
         }
         if (cr0>>31)
@@ -560,7 +663,7 @@ void writememwl(uint32_t addr, uint16_t val)
                         writemembl(addr+1,val>>8);
                         return;
                 }
-                else if (writelookup2[addr >> 12] != -1)
+                else if (writelookup2[addr >> 12] != LOOKUP_INV)
                 {
                         *(uint16_t *)(writelookup2[addr >> 12] + addr) = val;
                         return;
@@ -614,7 +717,7 @@ uint32_t readmemll(uint32_t addr)
                         }
                         return readmemwl(addr)|(readmemwl(addr+2)<<16);
                 }
-                else if (readlookup2[addr >> 12] != -1)
+                else if (readlookup2[addr >> 12] != LOOKUP_INV)
                         return *(uint32_t *)(readlookup2[addr >> 12] + addr);
         }
 
@@ -665,7 +768,7 @@ void writememll(uint32_t addr, uint32_t val)
                         writememwl(addr+2,val>>16);
                         return;
                 }
-                else if (writelookup2[addr >> 12] != -1)
+                else if (writelookup2[addr >> 12] != LOOKUP_INV)
                 {
                         *(uint32_t *)(writelookup2[addr >> 12] + addr) = val;
                         return;
@@ -723,7 +826,7 @@ uint64_t readmemql(uint32_t addr)
                         }
                         return readmemll(addr)|((uint64_t)readmemll(addr+4)<<32);
                 }
-                else if (readlookup2[addr >> 12] != -1)
+                else if (readlookup2[addr >> 12] != LOOKUP_INV)
                         return *(uint64_t *)(readlookup2[addr >> 12] + addr);
         }
         
@@ -762,7 +865,7 @@ void writememql(uint32_t addr, uint64_t val)
                         writememll(addr+4, val >> 32);
                         return;
                 }
-                else if (writelookup2[addr >> 12] != -1)
+                else if (writelookup2[addr >> 12] != LOOKUP_INV)
                 {
                         *(uint64_t *)(writelookup2[addr >> 12] + addr) = val;
                         return;
@@ -934,6 +1037,23 @@ void page_remove_from_evict_list(page_t *p)
         purgeable_page_count--;
 }
 
+void page_alloc_byte_masks(page_t *p)
+{
+        uint64_t *masks = malloc(64 * 2 * sizeof(uint64_t));
+
+        memset(masks, 0, 64 * 2 * sizeof(uint64_t));
+        p->byte_dirty_mask = masks;
+        p->byte_code_present_mask = &masks[64];
+}
+
+void page_free_byte_masks(page_t *p)
+{
+        if (p->byte_dirty_mask != page_byte_mask_dummy_dirty)
+                free(p->byte_dirty_mask);
+        p->byte_dirty_mask = page_byte_mask_dummy_dirty;
+        p->byte_code_present_mask = page_byte_mask_dummy_code_present;
+}
+
 void mem_write_ramb_page(uint32_t addr, uint8_t val, page_t *p)
 {      
         if (val != p->mem[addr & 0xfff] || codegen_in_recompile)
@@ -1191,6 +1311,9 @@ static void mem_mapping_recalc(uint64_t base, uint64_t size)
 
         if (!size)
                 return;
+        /*Direct write translations may point at memory of a mapping that is
+          moving or going away*/
+        mem_flush_write_direct();
         /*Clear out old mappings*/
         for (c = base; c < base + size; c += 0x4000)
         {
@@ -1392,8 +1515,6 @@ static void mem_remap_top(int max_size)
                         pages[c].write_w = mem_write_ramw_page;
                         pages[c].write_l = mem_write_raml_page;
                         pages[c].evict_prev = EVICT_NOT_IN_LIST;
-                        pages[c].byte_dirty_mask = &byte_dirty_mask[offset * 64];
-                        pages[c].byte_code_present_mask = &byte_code_present_mask[offset * 64];
                 }
 
                 mem_set_mem_state(start * 1024, size * 1024, MEM_READ_INTERNAL | MEM_WRITE_INTERNAL);
@@ -1418,9 +1539,12 @@ void mem_set_704kb()
 
 void mem_init()
 {
-        readlookup2  = malloc(1024 * 1024 * sizeof(uintptr_t));
-        writelookup2 = malloc(1024 * 1024 * sizeof(uintptr_t));
-        page_lookup = malloc((1 << 20) * sizeof(page_t *));
+        /*LOOKUP_INV is zero, so these start out fully invalidated. Only a
+          few hundred entries are ever valid at once, so most of each table is
+          never touched and never becomes resident*/
+        readlookup2  = calloc(1024 * 1024, sizeof(uintptr_t));
+        writelookup2 = calloc(1024 * 1024, sizeof(uintptr_t));
+        page_lookup = calloc(1 << 20, sizeof(page_t *));
 
         memset(ff_array, 0xff, sizeof(ff_array));
 
@@ -1432,32 +1556,30 @@ void mem_alloc()
 {
         int c;
         
-        free(ram);
-        ram = malloc(mem_size * 1024);
-        memset(ram, 0, mem_size * 1024);
-        
-        free(byte_dirty_mask);
-        byte_dirty_mask = malloc((mem_size * 1024) / 8);
-        memset(byte_dirty_mask, 0, (mem_size * 1024) / 8);
-        free(byte_code_present_mask);
-        byte_code_present_mask = malloc((mem_size * 1024) / 8);
-        memset(byte_code_present_mask, 0, (mem_size * 1024) / 8);
+        mem_host_free(ram);
+        ram = mem_host_alloc(mem_size * 1024);
         
+        if (pages)
+        {
+                for (c = 0; c < pages_sz; c++)
+                        page_free_byte_masks(&pages[c]);
+        }
         free(pages);
-        pages = malloc((((mem_size + 384) * 1024) >> 12) * sizeof(page_t));
-        memset(pages, 0, (((mem_size + 384) * 1024) >> 12) * sizeof(page_t));
-        for (c = 0; c < (((mem_size + 384) * 1024) >> 12); c++)
+        pages_sz = ((mem_size + 384) * 1024) >> 12;
+        pages = malloc(pages_sz * sizeof(page_t));
+        memset(pages, 0, pages_sz * sizeof(page_t));
+        for (c = 0; c < pages_sz; c++)
         {
                 pages[c].mem = &ram[c << 12];
                 pages[c].write_b = mem_write_ramb_page;
                 pages[c].write_w = mem_write_ramw_page;
                 pages[c].write_l = mem_write_raml_page;
                 pages[c].evict_prev = EVICT_NOT_IN_LIST;
-                pages[c].byte_dirty_mask = &byte_dirty_mask[c * 64];
-                pages[c].byte_code_present_mask = &byte_code_present_mask[c * 64];
+                pages[c].byte_dirty_mask = page_byte_mask_dummy_dirty;
+                pages[c].byte_code_present_mask = page_byte_mask_dummy_code_present;
         }
 
-        memset(page_lookup, 0, (1 << 20) * sizeof(page_t *));
+        resetreadlookup();
 
         memset(read_mapping, 0, sizeof(read_mapping));
         memset(write_mapping, 0, sizeof(write_mapping));
@@ -112,8 +112,8 @@ mem_mapping_t bios_high_mapping[9];
 extern mem_mapping_t ram_high_mapping;
 extern mem_mapping_t ram_remapped_mapping;
 
-extern uint64_t *byte_dirty_mask;
-extern uint64_t *byte_code_present_mask;
+extern uint64_t page_byte_mask_dummy_dirty[64];
+extern uint64_t page_byte_mask_dummy_code_present[64];
 
 #define PAGE_BYTE_MASK_SHIFT 6
 #define PAGE_BYTE_MASK_OFFSET_MASK 63
@@ -153,6 +153,15 @@ static inline int page_in_evict_list(page_t *p)
 void page_remove_from_evict_list(page_t *p);
 void page_add_to_evict_list(page_t *p);
 
+void page_alloc_byte_masks(page_t *p);
+void page_free_byte_masks(page_t *p);
+/*Make sure page has its own byte masks, rather than the shared dummy masks*/
+static inline void page_ensure_byte_masks(page_t *p)
+{
+        if (p->byte_code_present_mask == page_byte_mask_dummy_code_present)
+                page_alloc_byte_masks(p);
+}
+
 int mem_addr_is_ram(uint32_t addr);
 
 uint32_t mmutranslate_noabrt(uint32_t addr, int rw);
@@ -170,7 +179,7 @@ static inline uint32_t get_phys(uint32_t addr)
                 return addr & rammask;
         }
         
-        if (readlookup2[addr >> 12] != -1)
+        if (readlookup2[addr >> 12] != LOOKUP_INV)
                 get_phys_phys = ((uintptr_t)readlookup2[addr >> 12] + (addr & ~0xfff)) - (uintptr_t)ram;
         else
         {
@@ -190,7 +199,7 @@ static inline uint32_t get_phys_noabrt(uint32_t addr)
         if (!(cr0 >> 31))
                 return addr & rammask;
         
-        if (readlookup2[addr >> 12] != -1)
+        if (readlookup2[addr >> 12] != LOOKUP_INV)
                 return ((uintptr_t)readlookup2[addr >> 12] + addr) - (uintptr_t)ram;
 
         phys_addr = mmutranslate_noabrt(addr, 0) & rammask;
@@ -217,6 +226,8 @@ void mem_remap_top_256k();
 void mem_remap_top_384k();
 
 void mem_flush_write_page(uint32_t addr, uint32_t virt);
+void mem_add_write_direct(uint32_t phys, uint8_t *host, void (*write_l)(uint32_t addr, uint32_t val, void *priv), void *p);
+void mem_flush_write_host_range(uint8_t *base, uint32_t size);
 
 void mem_add_bios();
 
@@ -0,0 +1,161 @@
+#if defined(__linux__)
+#define _GNU_SOURCE
+#endif
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#if defined WIN32 || defined _WIN32
+#include <windows.h>
+#endif
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "ibm.h"
+#include "mem_host.h"
+
+int mem_host_hugepages = 1;
+int mem_host_mergeable = 0;
+int mem_host_shared = 0;
+
+static uint8_t *host_mem = NULL;
+static size_t host_mem_size;
+static int host_mem_mmaped;
+static int host_mem_fd = -1;
+
+#define HUGE_PAGE_SIZE (2 << 20)
+
+#if defined(__linux__) || defined(__APPLE__)
+static uint8_t *mem_host_mmap(size_t size)
+{
+        uint8_t *p;
+        int flags = MAP_PRIVATE | MAP_ANON;
+        int fd = -1;
+
+#if defined(__linux__) && defined(MFD_CLOEXEC)
+        if (mem_host_shared)
+        {
+                fd = memfd_create("pcem-ram", MFD_CLOEXEC);
+                if (fd != -1 && ftruncate(fd, size))
+                {
+                        close(fd);
+                        fd = -1;
+                }
+                if (fd != -1)
+                        flags = MAP_SHARED;
+                else
+                        pclog("mem_host : memfd_create failed, using anonymous memory\n");
+        }
+#endif
+        if (fd == -1 && mem_host_hugepages && size >= HUGE_PAGE_SIZE)
+        {
+                /*Over-allocate so the mapping can be trimmed to a huge page
+                  boundary, otherwise the first and last 2MB regions can never
+                  be backed by huge pages*/
+                uint8_t *base = mmap(NULL, size + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, flags, -1, 0);
+
+                if (base == MAP_FAILED)
+                        return NULL;
+                p = (uint8_t *)(((uintptr_t)base + HUGE_PAGE_SIZE - 1) & ~(uintptr_t)(HUGE_PAGE_SIZE - 1));
+                if (p != base)
+                        munmap(base, p - base);
+                munmap(p + size, (base + HUGE_PAGE_SIZE) - p);
+        }
+        else
+        {
+                p = mmap(NULL, size, PROT_READ | PROT_WRITE, flags, fd, 0);
+                if (p == MAP_FAILED)
+                {
+                        if (fd != -1)
+                                close(fd);
+                        return NULL;
+                }
+        }
+        host_mem_fd = fd;
+
+#ifdef MADV_HUGEPAGE
+        if (mem_host_hugepages && fd == -1)
+                madvise(p, size, MADV_HUGEPAGE);
+#endif
+#ifdef MADV_MERGEABLE
+        if (mem_host_mergeable && fd == -1)
+                madvise(p, size, MADV_MERGEABLE);
+#endif
+        return p;
+}
+#endif
+
+/*Allocate zeroed backing store for guest RAM. Only one allocation is live at
+  a time; any previous allocation should be freed first*/
+uint8_t *mem_host_alloc(size_t size)
+{
+        uint8_t *p = NULL;
+
+#if defined WIN32 || defined _WIN32
+        p = VirtualAlloc(NULL, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+#elif defined(__linux__) || defined(__APPLE__)
+        p = mem_host_mmap(size);
+#endif
+        host_mem_mmaped = (p != NULL);
+        if (!p)
+        {
+                p = malloc(size);
+                if (!p)
+                        fatal("mem_host_alloc : failed to allocate %u bytes\n", (unsigned)size);
+                memset(p, 0, size);
+        }
+        host_mem = p;
+        host_mem_size = size;
+
+        return p;
+}
+
+void mem_host_free(uint8_t *p)
+{
+        if (!p)
+                return;
+        if (p != host_mem || !host_mem_mmaped)
+        {
+                free(p);
+                return;
+        }
+
+#if defined WIN32 || defined _WIN32
+        VirtualFree(p, 0, MEM_RELEASE);
+#elif defined(__linux__) || defined(__APPLE__)
+        munmap(p, host_mem_size);
+        if (host_mem_fd != -1)
+                close(host_mem_fd);
+        host_mem_fd = -1;
+#endif
+        host_mem = NULL;
+        host_mem_size = 0;
+}
+
+/*File descriptor backing guest RAM, or -1 if RAM is not memfd backed. Mapping
+  this MAP_PRIVATE gives a copy-on-write view of guest memory*/
+int mem_host_get_fd()
+{
+        return host_mem_fd;
+}
+
+/*Log resident and huge page usage of the process, for comparing allocation
+  modes*/
+void mem_host_log_stats()
+{
+#if defined(__linux__)
+        FILE *f = fopen("/proc/self/smaps_rollup", "r");
+        char line[256];
+
+        if (!f)
+                return;
+        while (fgets(line, sizeof(line), f))
+        {
+                if (!strncmp(line, "Rss:", 4) || !strncmp(line, "AnonHugePages:", 14) ||
+                    !strncmp(line, "Shared_Clean:", 13) || !strncmp(line, "Private_Dirty:", 14))
+                        pclog("mem_host : %s", line);
+        }
+        fclose(f);
+#endif
+}
@@ -0,0 +1,18 @@
+#ifndef _MEM_HOST_H_
+#define _MEM_HOST_H_
+
+/*Host backing for guest RAM*/
+uint8_t *mem_host_alloc(size_t size);
+void mem_host_free(uint8_t *p);
+int mem_host_get_fd();
+void mem_host_log_stats();
+
+/*Request transparent huge pages for guest RAM (Linux only)*/
+extern int mem_host_hugepages;
+/*Allow identical guest pages to be merged by KSM across instances (Linux only)*/
+extern int mem_host_mergeable;
+/*Back guest RAM with a memfd, so it can be mapped again by snapshot/fork
+  code and shared copy-on-write (Linux only)*/
+extern int mem_host_shared;
+
+#endif /*_MEM_HOST_H_*/
@@ -27,6 +27,7 @@
 #include "keyboard.h"
 #include "keyboard_at.h"
 #include "lpt.h"
+#include "mem_host.h"
 #include "model.h"
 #include "mouse.h"
 #include "nvr.h"
@@ -235,6 +236,8 @@ void initpc(int argc, char *argv[])
 //        char *config_file = NULL;
         int c;
 
+        video_init_tables();
+
         for (c = 1; c < argc; c++)
         {
                 if (!strcasecmp(argv[c], "--help"))
@@ -563,6 +566,7 @@ void runpc()
                 cpu_recomp_evicted_latched = cpu_recomp_evicted;
                 cpu_recomp_reuse_latched = cpu_recomp_reuse;
                 cpu_recomp_removed_latched = cpu_recomp_removed;
+                cpu_recomp_imm_avoided_latched = cpu_recomp_imm_avoided;
 
                 cpu_recomp_blocks = 0;
                 cpu_state.cpu_recomp_ins = 0;
@@ -572,6 +576,7 @@ void runpc()
                 cpu_recomp_evicted = 0;
                 cpu_recomp_reuse = 0;
                 cpu_recomp_removed = 0;
+                cpu_recomp_imm_avoided = 0;
 
                 updatestatus=1;
                 readlnum=writelnum=0;
@@ -616,6 +621,7 @@ void speedchanged()
 
 void closepc()
 {
+        mem_host_log_stats();
         codegen_close();
         atapi->exit();
 //        ioctl_close();
@@ -694,6 +700,10 @@ void loadconfig(char *fn)
 
         sound_buf_len = config_get_int(CFG_GLOBAL, NULL, "sound_buf_len", 200);
         sound_gain = config_get_int(CFG_GLOBAL, NULL, "sound_gain", 0);
+
+        mem_host_hugepages = config_get_int(CFG_GLOBAL, NULL, "mem_host_hugepages", 1);
+        mem_host_mergeable = config_get_int(CFG_GLOBAL, NULL, "mem_host_mergeable", 0);
+        mem_host_shared = config_get_int(CFG_GLOBAL, NULL, "mem_host_shared", 0);
         
         GAMEBLASTER = config_get_int(CFG_MACHINE, NULL, "gameblaster", 0);
         GUS = config_get_int(CFG_MACHINE, NULL, "gus", 0);
@@ -716,6 +726,7 @@ void loadconfig(char *fn)
         fpu_type = fpu_get_type(model, cpu_manufacturer, cpu, p);
         cpu_use_dynarec = config_get_int(CFG_MACHINE, NULL, "cpu_use_dynarec", 0);
         cpu_waitstates = config_get_int(CFG_MACHINE, NULL, "cpu_waitstates", 0);
+        cpu_idle_detect = config_get_int(CFG_MACHINE, NULL, "cpu_idle_detect", 0);
                 
         p = (char *)config_get_string(CFG_MACHINE, NULL, "gfxcard", "");
         if (p)
@@ -896,6 +907,10 @@ void saveconfig(char *fn)
 
         config_set_int(CFG_GLOBAL, NULL, "sound_buf_len", sound_buf_len);
         config_set_int(CFG_GLOBAL, NULL, "sound_gain", sound_gain);
+
+        config_set_int(CFG_GLOBAL, NULL, "mem_host_hugepages", mem_host_hugepages);
+        config_set_int(CFG_GLOBAL, NULL, "mem_host_mergeable", mem_host_mergeable);
+        config_set_int(CFG_GLOBAL, NULL, "mem_host_shared", mem_host_shared);
         
         config_set_int(CFG_MACHINE, NULL, "gameblaster", GAMEBLASTER);
         config_set_int(CFG_MACHINE, NULL, "gus", GUS);
@@ -908,6 +923,7 @@ void saveconfig(char *fn)
         config_set_string(CFG_MACHINE, NULL, "fpu", (char *)fpu_get_internal_name(model, cpu_manufacturer, cpu, fpu_type));
         config_set_int(CFG_MACHINE, NULL, "cpu_use_dynarec", cpu_use_dynarec);
         config_set_int(CFG_MACHINE, NULL, "cpu_waitstates", cpu_waitstates);
+        config_set_int(CFG_MACHINE, NULL, "cpu_idle_detect", cpu_idle_detect);
         
         config_set_string(CFG_MACHINE, NULL, "gfxcard", video_get_internal_name(video_old_to_new(gfxcard)));
         config_set_int(CFG_MACHINE, NULL, "video_speed", video_speed);
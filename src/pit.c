@@ -476,6 +476,8 @@ uint8_t pit_read(uint16_t addr, void *p)
         {
                 case 0: case 1: case 2: /*Timers*/
                 t = addr & 3;
+                if (cpu_idle_detect)
+                        cpu_idle_poll(CPU_IDLE_POLL_PIT);
                 if (pit->do_read_status[t])
                 {
                         pit->do_read_status[t] = 0;
@@ -318,6 +318,82 @@ int scsi_bus_match(scsi_bus_t *bus, int bus_assert)
         return (bus_assert & (BUS_CD | BUS_IO | BUS_MSG)) == (bus->bus_out & (BUS_CD | BUS_IO | BUS_MSG));
 }
 
+/*Bulk data phase transfers. These move up to len bytes between buf and the
+  selected target in one call, leaving the bus in the state the equivalent run
+  of REQ/ACK handshakes would have. They only act when the target is asserting
+  REQ in the matching data phase with no phase change pending, and return the
+  number of bytes transferred (0 if the bus is not ready)*/
+static int scsi_bus_data_ready(scsi_bus_t *bus, int state)
+{
+        if (bus->state != state || bus->dev_id == -1)
+                return 0;
+        if (!(bus->bus_out & BUS_REQ) || (bus->bus_in & BUS_ACK))
+                return 0;
+        if (bus->clear_req || bus->change_state_delay || bus->new_req_delay)
+                return 0;
+        return 1;
+}
+
+int scsi_bus_read_data(scsi_bus_t *bus, uint8_t *buf, int len)
+{
+        scsi_device_t *dev;
+        void *dev_data;
+        int c;
+
+        if (!scsi_bus_data_ready(bus, STATE_DATAIN))
+                return 0;
+
+        dev = bus->devices[bus->dev_id];
+        dev_data = bus->device_data[bus->dev_id];
+
+        for (c = 0; c < len; c++)
+        {
+                buf[c] = BUS_GETDATA(bus->bus_out);
+
+                if (dev->read_complete(dev_data))
+                {
+                        bus->bus_out &= ~BUS_REQ;
+                        bus->new_state = BUS_CD | BUS_IO;
+                        bus->change_state_delay = 4;
+                        bus->new_req_delay = 8;
+                        return c + 1;
+                }
+
+                bus->bus_out = (bus->bus_out & ~BUS_DATAMASK) | BUS_SETDATA(dev->read(dev_data)) | BUS_DBP;
+        }
+
+        return len;
+}
+
+int scsi_bus_write_data(scsi_bus_t *bus, uint8_t *buf, int len)
+{
+        scsi_device_t *dev;
+        void *dev_data;
+        int c;
+
+        if (!scsi_bus_data_ready(bus, STATE_DATAOUT))
+                return 0;
+
+        dev = bus->devices[bus->dev_id];
+        dev_data = bus->device_data[bus->dev_id];
+
+        for (c = 0; c < len; c++)
+        {
+                dev->write(buf[c], dev_data);
+
+                if (dev->write_complete(dev_data))
+                {
+                        bus->bus_out &= ~BUS_REQ;
+                        bus->new_state = dev->command(bus->command, dev_data);
+                        bus->change_state_delay = 4;
+                        bus->new_req_delay = 8;
+                        return c + 1;
+                }
+        }
+
+        return len;
+}
+
 void scsi_bus_kick(scsi_bus_t *bus)
 {
 //        pclog("scsi_bus_kick\n");
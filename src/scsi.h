@@ -104,6 +104,8 @@ void scsi_set_irq(uint8_t status);
 int scsi_bus_update(scsi_bus_t *bus, int bus_assert);
 int scsi_bus_read(scsi_bus_t *bus);
 int scsi_bus_match(scsi_bus_t *bus, int bus_assert);
+int scsi_bus_read_data(scsi_bus_t *bus, uint8_t *buf, int len);
+int scsi_bus_write_data(scsi_bus_t *bus, uint8_t *buf, int len);
 void scsi_bus_kick(scsi_bus_t *bus);
 void scsi_bus_init(scsi_bus_t *bus);
 void scsi_bus_close(scsi_bus_t *bus);
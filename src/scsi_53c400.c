@@ -9,7 +9,9 @@
 #include "timer.h"
 
 #define POLL_TIME_US 1
-#define MAX_BYTES_TRANSFERRED_PER_POLL 50
+/*DMA moves the rest of the 128 byte buffer per callback, with the next callback
+  delayed by the time the block would take at 50 bytes/us*/
+#define BYTES_PER_US 50
 
 typedef struct ncr5380_t
 {
@@ -105,6 +107,13 @@ static void set_dma_enable(lcs6821n_t *scsi, int enable)
 		timer_disable(&scsi->dma_timer);
 }
 
+/*Restart the DMA timer after the host has filled or drained the buffer. The
+  callback stops the timer while it is waiting on the host side*/
+static void dma_kick(lcs6821n_t *scsi)
+{
+	set_dma_enable(scsi, scsi->ncr5380_dma_enabled && scsi->block_count_loaded);
+}
+
 static void ncr53c400_dma_changed(ncr5380_t *ncr, int mode, int enable)
 {
         lcs6821n_t *scsi = (lcs6821n_t *)ncr->p;
@@ -348,7 +357,10 @@ static uint8_t lcs6821n_read(uint32_t addr, void *p)
                         temp = scsi->buffer[scsi->buffer_host_pos++];
                         
                         if (scsi->buffer_host_pos == 128)
+                        {
                                 scsi->status_ctrl |= STATUS_BUFFER_NOT_READY;
+                                dma_kick(scsi);
+                        }
                 }
                 break;
                 
@@ -410,6 +422,7 @@ static void lcs6821n_write(uint32_t addr, uint8_t val, void *p)
                         {
                                 scsi->status_ctrl |= STATUS_BUFFER_NOT_READY;
                                 scsi->ncr_busy = 1;
+                                dma_kick(scsi);
                         }
                 }
                 break;
@@ -429,6 +442,7 @@ static void lcs6821n_write(uint32_t addr, uint8_t val, void *p)
                                 scsi->status_ctrl &= ~STATUS_BUFFER_NOT_READY;
                         }
                         scsi->status_ctrl = (scsi->status_ctrl & 0x87) | (val & 0x78);
+                        dma_kick(scsi);
                         break;
                         case 0x3981: /*Block counter register*/
                         scsi->block_count = val;
@@ -540,16 +554,16 @@ static void ncr53c400_dma_callback(void *p)
         ncr5380_t *ncr = &scsi->ncr;
         int c;
         int bytes_transferred = 0;
+        int wait_for_host = 0;
 
 //pclog("dma_Callback poll\n");
-	timer_advance_u64(&scsi->dma_timer, TIMER_USEC * POLL_TIME_US);
-                
         switch (scsi->ncr.dma_mode)
         {
                 case DMA_SEND:
                 if (scsi->status_ctrl & CTRL_DATA_DIR)
                 {
                         pclog("DMA_SEND with DMA direction set wrong\n");
+                        wait_for_host = 1;
                         break;
                 }
                 
@@ -559,6 +573,7 @@ static void ncr53c400_dma_callback(void *p)
                 if (!(scsi->status_ctrl & STATUS_BUFFER_NOT_READY))
                 {
 //                        pclog(" !(scsi->status_ctrl & STATUS_BUFFER_NOT_READY)\n");
+                        wait_for_host = 1;
                         break;
                 }
                 
@@ -568,57 +583,43 @@ static void ncr53c400_dma_callback(void *p)
                         break;
                 }
                 
-                while (bytes_transferred < MAX_BYTES_TRANSFERRED_PER_POLL)
+                for (c = 0; c < 10; c++)
                 {
-                        int bus;
-                        uint8_t data;
-                        
-                        for (c = 0; c < 10; c++)
-                        {
-                                uint8_t status = scsi_bus_read(&ncr->bus);
-                        
-                                if (status & BUS_REQ)
-                                        break;
-                        }
-                        if (c == 10)
-                        {
-//                                pclog(" No req\n");
+                        uint8_t status = scsi_bus_read(&ncr->bus);
+                
+                        if (status & BUS_REQ)
                                 break;
-                        }
+                }
+                if (c == 10)
+                {
+//                        pclog(" No req\n");
+                        break;
+                }
 
-                        /*Data ready*/
-                        data = scsi->buffer[scsi->buffer_pos];
-                	bus = get_bus_host(ncr) & ~BUS_DATAMASK;
-                        bus |= BUS_SETDATA(data);
-                        	
-                        scsi_bus_update(&ncr->bus, bus | BUS_ACK);
-                        scsi_bus_update(&ncr->bus, bus & ~BUS_ACK);
-//                         pclog(" Sent data %02x %i\n", data, scsi->buffer_pos);
-
-                        scsi->buffer_pos++;
-                        bytes_transferred++;
-                        
-                        if (scsi->buffer_pos == 128)
+                /*Data ready*/
+                bytes_transferred = scsi_bus_write_data(&ncr->bus, &scsi->buffer[scsi->buffer_pos], 128 - scsi->buffer_pos);
+//                pclog(" Sent data %i %i\n", bytes_transferred, scsi->buffer_pos);
+                scsi->buffer_pos += bytes_transferred;
+                
+                if (scsi->buffer_pos == 128)
+                {
+                        scsi->buffer_pos = 0;
+                        scsi->buffer_host_pos = 0;
+                        scsi->status_ctrl &= ~STATUS_BUFFER_NOT_READY;
+                        scsi->block_count = (scsi->block_count - 1) & 255;
+                        scsi->ncr_busy = 0;
+//                        pclog("Sent buffer %i\n", scsi->block_count);
+                        if (!scsi->block_count)
                         {
-                                scsi->buffer_pos = 0;
-                                scsi->buffer_host_pos = 0;
-                                scsi->status_ctrl &= ~STATUS_BUFFER_NOT_READY;
-                                scsi->block_count = (scsi->block_count - 1) & 255;
-                                scsi->ncr_busy = 0;
-//                                pclog("Sent buffer %i\n", scsi->block_count);
-                                if (!scsi->block_count)
-                                {
-                                        scsi->block_count_loaded = 0;
-                                        set_dma_enable(scsi, 0);
-//                                        scsi->buffer_host_pos = 128;
-//                                        scsi->status_ctrl |= STATUS_BUFFER_NOT_READY;
-
-                                        ncr->tcr |= TCR_LAST_BYTE_SENT;
-                                        ncr->isr |= STATUS_END_OF_DMA;                                        
-                                        if (ncr->mode & MODE_ENA_EOP_INT)
-                                                ncr->isr |= STATUS_INT;
-                                }
-                                break;
+                                scsi->block_count_loaded = 0;
+                                set_dma_enable(scsi, 0);
+//                                scsi->buffer_host_pos = 128;
+//                                scsi->status_ctrl |= STATUS_BUFFER_NOT_READY;
+
+                                ncr->tcr |= TCR_LAST_BYTE_SENT;
+                                ncr->isr |= STATUS_END_OF_DMA;                                        
+                                if (ncr->mode & MODE_ENA_EOP_INT)
+                                        ncr->isr |= STATUS_INT;
                         }
                 }
                 break;
@@ -627,67 +628,57 @@ static void ncr53c400_dma_callback(void *p)
                 if (!(scsi->status_ctrl & CTRL_DATA_DIR))
                 {
                         pclog("DMA_INITIATOR_RECEIVE with DMA direction set wrong\n");
+                        wait_for_host = 1;
                         break;
                 }
                 
                 if (!(scsi->status_ctrl & STATUS_BUFFER_NOT_READY))
+                {
+                        wait_for_host = 1;
                         break;
+                }
                 
                 if (!scsi->block_count_loaded)
                         break;
                 
-                while (bytes_transferred < MAX_BYTES_TRANSFERRED_PER_POLL)
+                for (c = 0; c < 10; c++)
                 {
-                        int bus;
-                        uint8_t temp;
-                        
-                        for (c = 0; c < 10; c++)
-                        {
-                                uint8_t status = scsi_bus_read(&ncr->bus);
-                        
-                                if (status & BUS_REQ)
-                                        break;
-                        }
-                        if (c == 10)
+                        uint8_t status = scsi_bus_read(&ncr->bus);
+                
+                        if (status & BUS_REQ)
                                 break;
+                }
+                if (c == 10)
+                        break;
 
-                        /*Data ready*/
-        		bus = scsi_bus_read(&ncr->bus);
-        		temp = BUS_GETDATA(bus);
-//                        pclog(" Got data %02x %i\n", temp, scsi->buffer_pos);
-
-                	bus = get_bus_host(ncr);
-	
-                        scsi_bus_update(&ncr->bus, bus | BUS_ACK);
-                        scsi_bus_update(&ncr->bus, bus & ~BUS_ACK);
-
-                        scsi->buffer[scsi->buffer_pos++] = temp;
-                        bytes_transferred++;
-                                                
-                        if (scsi->buffer_pos == 128)
-                        {
-                                scsi->buffer_pos = 0;
-                                scsi->buffer_host_pos = 0;
-                                scsi->status_ctrl &= ~STATUS_BUFFER_NOT_READY;
-                                scsi->block_count = (scsi->block_count - 1) & 255;
-//                                pclog("Got buffer %i\n", scsi->block_count);
-                                if (!scsi->block_count)
-                                {
-                                        scsi->block_count_loaded = 0;
-                                        set_dma_enable(scsi, 0);
+                /*Data ready*/
+                bytes_transferred = scsi_bus_read_data(&ncr->bus, &scsi->buffer[scsi->buffer_pos], 128 - scsi->buffer_pos);
+//                pclog(" Got data %i %i\n", bytes_transferred, scsi->buffer_pos);
+                scsi->buffer_pos += bytes_transferred;
                                         
-//                                        output=3;
-                                        ncr->isr |= STATUS_END_OF_DMA;
-                                        if (ncr->mode & MODE_ENA_EOP_INT)
-                                                ncr->isr |= STATUS_INT;
-                                }
-                                break;
+                if (scsi->buffer_pos == 128)
+                {
+                        scsi->buffer_pos = 0;
+                        scsi->buffer_host_pos = 0;
+                        scsi->status_ctrl &= ~STATUS_BUFFER_NOT_READY;
+                        scsi->block_count = (scsi->block_count - 1) & 255;
+//                        pclog("Got buffer %i\n", scsi->block_count);
+                        if (!scsi->block_count)
+                        {
+                                scsi->block_count_loaded = 0;
+                                set_dma_enable(scsi, 0);
+                                
+//                                output=3;
+                                ncr->isr |= STATUS_END_OF_DMA;
+                                if (ncr->mode & MODE_ENA_EOP_INT)
+                                        ncr->isr |= STATUS_INT;
                         }
                 }
                 break;
                 
                 default:
                 pclog("DMA callback bad mode %i\n", scsi->ncr.dma_mode);
+                wait_for_host = 1;
                 break;
         }
 
@@ -701,6 +692,11 @@ static void ncr53c400_dma_callback(void *p)
                 	ncr->dma_changed(ncr, ncr->dma_mode, ncr->mode & MODE_DMA);
                 }
         }
+
+        /*Keep polling only while the target side can make progress. Waits on the
+          host are restarted by dma_kick()*/
+        if (!wait_for_host && scsi->ncr5380_dma_enabled && scsi->block_count_loaded)
+        	timer_advance_u64(&scsi->dma_timer, TIMER_USEC * POLL_TIME_US + (TIMER_USEC / BYTES_PER_US) * bytes_transferred);
 }
 
 static void *scsi_53c400_init(char *bios_fn)
@@ -267,7 +267,9 @@ typedef struct aha154x_t
 
 #define POLL_TIME_US 10
 #define MAX_BYTES_TRANSFERRED_PER_POLL 50
-/*10us poll period with 50 bytes transferred per poll = 5MB/sec*/
+/*Data phases move a whole segment per poll, with the next poll delayed by the
+  time the transfer would take at 5MB/sec*/
+#define BYTES_PER_US 5
 
 static void aha1542c_eeprom_save(aha154x_t *scsi);
 static void process_cmd(aha154x_t *scsi);
@@ -283,6 +285,32 @@ static void clear_irq(aha154x_t *scsi)
         picintc(1 << scsi->irq);
 }
 
+/*The firmware state machines only need to run while they have something to do.
+  Once everything is idle the timer is left disabled until the host writes a
+  register or reads a result byte*/
+static int aha154x_busy(aha154x_t *scsi)
+{
+        if (scsi->status & STATUS_CDF)
+                return 1;
+        if (scsi->cmd_state == CMD_STATE_RESET || scsi->cmd_state == CMD_STATE_CMD_IN_PROGRESS)
+                return 1;
+        if (scsi->cmd_state == CMD_STATE_SEND_RESULT && !(scsi->status & STATUS_DF))
+                return 1;
+        if (scsi->ccb_state != CCB_STATE_IDLE || scsi->scsi_state != SCSI_STATE_IDLE)
+                return 1;
+        if (!(scsi->status & STATUS_INIT) && scsi->mbo_req)
+                return 1;
+        if (scsi->bios_mbo_inited && scsi->bios_mbo_req)
+                return 1;
+        return 0;
+}
+
+static void aha154x_kick(aha154x_t *scsi)
+{
+        if (!timer_is_enabled(&scsi->timer))
+                timer_set_delay_u64(&scsi->timer, TIMER_USEC * POLL_TIME_US);
+}
+
 static void aha154x_out(uint16_t port, uint8_t val, void *p)
 {
         aha154x_t *scsi = (aha154x_t *)p;
@@ -354,6 +382,8 @@ static void aha154x_out(uint16_t port, uint8_t val, void *p)
                         scsi->isr = val;
                 break;
         }        
+        
+        aha154x_kick(scsi);
 }
 
 static uint8_t aha154x_in(uint16_t port, void *p)
@@ -376,6 +406,8 @@ static uint8_t aha154x_in(uint16_t port, void *p)
                         fatal("Read data in while empty\n");*/
                 scsi->status &= ~STATUS_DF;
                 temp = scsi->data_in;
+                if (scsi->cmd_state == CMD_STATE_SEND_RESULT)
+                        aha154x_kick(scsi);
                 break;
 
                 case 2: /*Interrupt status register*/
@@ -1784,7 +1816,70 @@ static void process_ccb(aha154x_t *scsi)
         }
 }
 
-static void process_scsi(aha154x_t *scsi)
+/*Move the rest of the current data segment in one burst, stopping early if the
+  target leaves the data phase. Returns the number of bytes transferred*/
+static int read_data_segment(aha154x_t *scsi)
+{
+        int bytes_transferred = 0;
+        
+        while (scsi->cdb.data_idx < scsi->cdb.data_len)
+        {
+                uint8_t buf[512];
+                int len = MIN(scsi->cdb.data_len - scsi->cdb.data_idx, (int)sizeof(buf));
+                int c;
+                
+                if (scsi->cdb.data_pointer == -1)
+                        len = scsi_bus_read_data(&scsi->bus, &scsi->int_buffer[scsi->cdb.data_idx], len);
+                else
+                {
+                        len = scsi_bus_read_data(&scsi->bus, buf, len);
+                        for (c = 0; c < len; c++)
+                                mem_writeb_phys(scsi->cdb.data_pointer + scsi->cdb.data_idx + c, buf[c]);
+                }
+//                pclog("Read data %i %i %06x\n", len, scsi->cdb.data_idx, scsi->cdb.data_pointer + scsi->cdb.data_idx);
+                if (!len)
+                        break;
+
+                scsi->cdb.data_idx += len;
+                scsi->cdb.bytes_transferred += len;
+                bytes_transferred += len;
+        }
+        
+        return bytes_transferred;
+}
+
+static int write_data_segment(aha154x_t *scsi)
+{
+        int bytes_transferred = 0;
+        
+        while (scsi->cdb.data_idx < scsi->cdb.data_len)
+        {
+                uint8_t buf[512];
+                int len = MIN(scsi->cdb.data_len - scsi->cdb.data_idx, (int)sizeof(buf));
+                int c;
+                
+                if (scsi->cdb.data_pointer == -1)
+                        len = scsi_bus_write_data(&scsi->bus, &scsi->int_buffer[scsi->cdb.data_idx], len);
+                else
+                {
+                        for (c = 0; c < len; c++)
+                                buf[c] = mem_readb_phys(scsi->cdb.data_pointer + scsi->cdb.data_idx + c);
+                        len = scsi_bus_write_data(&scsi->bus, buf, len);
+                }
+//                pclog("Write data %i %i\n", len, scsi->cdb.data_idx);
+                if (!len)
+                        break;
+
+                scsi->cdb.data_idx += len;
+                scsi->cdb.bytes_transferred += len;
+                bytes_transferred += len;
+        }
+        
+        return bytes_transferred;
+}
+
+/*Returns the number of data bytes moved, so the caller can time the next poll*/
+static int process_scsi(aha154x_t *scsi)
 {
         int c;
         int bytes_transferred = 0;
@@ -1935,44 +2030,25 @@ static void process_scsi(aha154x_t *scsi)
                 
                 case SCSI_STATE_READ_DATA:
 //pclog("READ_DATA %i,%i %i\n", scsi->cdb.data_idx,scsi->cdb.data_len, scsi->cdb.scatter_gather);
-                while (scsi->cdb.data_idx < scsi->cdb.data_len && scsi->scsi_state == SCSI_STATE_READ_DATA && bytes_transferred < MAX_BYTES_TRANSFERRED_PER_POLL)
+                for (c = 0; c < 20 && scsi->cdb.data_idx < scsi->cdb.data_len; c++)
                 {
-                        int d;
-                        
-                        for (d = 0; d < 20; d++)
-                        {
-                                int bus_state = scsi_bus_read(&scsi->bus);
+                        int bus_state = scsi_bus_read(&scsi->bus);
 
-                                if (!(bus_state & BUS_BSY))
-                                        fatal("READ_DATA - dropped BSY waiting\n");
+                        if (!(bus_state & BUS_BSY))
+                                fatal("READ_DATA - dropped BSY waiting\n");
 
-                                if ((bus_state & (BUS_IO | BUS_CD | BUS_MSG)) != BUS_IO)
-                                {
-                                        pclog("READ_DATA - changed phase\n");
-                                        scsi->scsi_state = SCSI_STATE_NEXT_PHASE;
-                                        break;
-                                }
-                                
-                                if (bus_state & BUS_REQ)
-                                {
-                                        uint8_t data = BUS_GETDATA(bus_state);
-                                        int bus_out = 0;
-                                
-                                        if (scsi->cdb.data_pointer == -1)
-                                                scsi->int_buffer[scsi->cdb.data_idx] = data;
-                                        else
-                                                mem_writeb_phys(scsi->cdb.data_pointer + scsi->cdb.data_idx, data);
-                                        scsi->cdb.data_idx++;
-                                        scsi->cdb.bytes_transferred++;
-                                
-//                                        pclog("Read data %02x %i %06x\n", data, scsi->cdb.data_idx, scsi->cdb.data_pointer + scsi->cdb.data_idx);
-                                        scsi_bus_update(&scsi->bus, bus_out | BUS_ACK);
-                                        scsi_bus_update(&scsi->bus, bus_out & ~BUS_ACK);
-                                        break;
-                                }
+                        if ((bus_state & (BUS_IO | BUS_CD | BUS_MSG)) != BUS_IO)
+                        {
+                                pclog("READ_DATA - changed phase\n");
+                                scsi->scsi_state = SCSI_STATE_NEXT_PHASE;
+                                break;
                         }
                         
-                        bytes_transferred++;
+                        if (bus_state & BUS_REQ)
+                        {
+                                bytes_transferred = read_data_segment(scsi);
+                                break;
+                        }
                 }
                 if (scsi->cdb.data_idx == scsi->cdb.data_len)
                 {
@@ -2010,45 +2086,25 @@ static void process_scsi(aha154x_t *scsi)
                 break;
                 
                 case SCSI_STATE_WRITE_DATA:
-                while (scsi->cdb.data_idx < scsi->cdb.data_len && bytes_transferred < MAX_BYTES_TRANSFERRED_PER_POLL)
+                for (c = 0; c < 20 && scsi->cdb.data_idx < scsi->cdb.data_len; c++)
                 {
-                        int d;
-                        
-                        for (d = 0; d < 20; d++)
-                        {
-                                int bus_state = scsi_bus_read(&scsi->bus);
+                        int bus_state = scsi_bus_read(&scsi->bus);
 
-                                if (!(bus_state & BUS_BSY))
-                                        fatal("WRITE_DATA - dropped BSY waiting\n");
+                        if (!(bus_state & BUS_BSY))
+                                fatal("WRITE_DATA - dropped BSY waiting\n");
 
-                                if ((bus_state & (BUS_IO | BUS_CD | BUS_MSG)) != 0)
-                                {
-                                        pclog("WRITE_DATA - changed phase\n");
-                                        scsi->scsi_state = SCSI_STATE_NEXT_PHASE;
-                                        break;
-                                }
-                                
-                                if (bus_state & BUS_REQ)
-                                {
-                                        uint8_t data;// = BUS_GETDATA(bus_state);
-                                        int bus_out;
-                                                                        
-                                        if (scsi->cdb.data_pointer == -1)
-                                                data = scsi->int_buffer[scsi->cdb.data_idx];
-                                        else
-                                                data = mem_readb_phys(scsi->cdb.data_pointer + scsi->cdb.data_idx);
-                                        scsi->cdb.data_idx++;
-                                        scsi->cdb.bytes_transferred++;
-                                                                        
-//                                        pclog("Write data %02x %i\n", data, scsi->cdb.data_idx);
-                                        bus_out = BUS_SETDATA(data);
-                                        scsi_bus_update(&scsi->bus, bus_out | BUS_ACK);
-                                        scsi_bus_update(&scsi->bus, bus_out & ~BUS_ACK);
-                                        break;
-                                }
+                        if ((bus_state & (BUS_IO | BUS_CD | BUS_MSG)) != 0)
+                        {
+                                pclog("WRITE_DATA - changed phase\n");
+                                scsi->scsi_state = SCSI_STATE_NEXT_PHASE;
+                                break;
                         }
                         
-                        bytes_transferred++;
+                        if (bus_state & BUS_REQ)
+                        {
+                                bytes_transferred = write_data_segment(scsi);
+                                break;
+                        }
                 }
                 if (scsi->cdb.data_idx == scsi->cdb.data_len)
                 {
@@ -2159,18 +2215,22 @@ static void process_scsi(aha154x_t *scsi)
                 default:
                 fatal("Unknown SCSI_state %d\n", scsi->scsi_state);
         }
+        
+        return bytes_transferred;
 }
 
 static void aha154x_callback(void *p)
 {
         aha154x_t *scsi = (aha154x_t *)p;
-
-        timer_advance_u64(&scsi->timer, TIMER_USEC * POLL_TIME_US);
+        int bytes_transferred;
 
 //        pclog("poll %i\n", scsi->cmd_state);
         process_cmd(scsi);
         process_ccb(scsi);
-        process_scsi(scsi);
+        bytes_transferred = process_scsi(scsi);
+
+        if (aha154x_busy(scsi))
+                timer_advance_u64(&scsi->timer, TIMER_USEC * POLL_TIME_US + (TIMER_USEC / BYTES_PER_US) * bytes_transferred);
 }
 
 static uint8_t aha1542c_read(uint32_t addr, void *p)
@@ -8,7 +8,9 @@
 #include "rom.h"
 #include "thread.h"
 #include "video.h"
+#include "vid_blit.h"
 #include "vid_ddc.h"
+#include "vid_fifo.h"
 #include "vid_svga.h"
 #include "vid_svga_render.h"
 #include "vid_ati68860_ramdac.h"
@@ -21,13 +23,9 @@
 
 //#define MACH64_DEBUG
 
-#define FIFO_SIZE 65536
-#define FIFO_MASK (FIFO_SIZE - 1)
-#define FIFO_ENTRY_SIZE (1 << 31)
-
-#define FIFO_ENTRIES (mach64->fifo_write_idx - mach64->fifo_read_idx)
-#define FIFO_FULL    ((mach64->fifo_write_idx - mach64->fifo_read_idx) >= FIFO_SIZE)
-#define FIFO_EMPTY   (mach64->fifo_read_idx == mach64->fifo_write_idx)
+#define FIFO_ENTRIES ACCEL_FIFO_ENTRIES(&mach64->fifo)
+#define FIFO_FULL    ACCEL_FIFO_FULL(&mach64->fifo)
+#define FIFO_EMPTY   ACCEL_FIFO_EMPTY(&mach64->fifo)
 
 #define FIFO_TYPE 0xff000000
 #define FIFO_ADDR 0x00ffffff
@@ -40,12 +38,6 @@ enum
         FIFO_WRITE_DWORD = (0x03 << 24)
 };
 
-typedef struct
-{
-        uint32_t addr_type;
-        uint32_t val;
-} fifo_entry_t;
-
 enum
 {
         MACH64_GX = 0,
@@ -186,12 +178,7 @@ typedef struct mach64_t
                 int poly_draw;
         } accel;
 
-        fifo_entry_t fifo[FIFO_SIZE];
-        volatile int fifo_read_idx, fifo_write_idx;
-
-        thread_t *fifo_thread;
-        event_t *wake_fifo_thread;
-        event_t *fifo_not_full_event;
+        accel_fifo_t fifo;
         
         int blitter_busy;
         uint64_t blitter_time;
@@ -304,6 +291,7 @@ void mach64_recalctimings(svga_t *svga);
 void mach64_start_fill(mach64_t *mach64);
 void mach64_start_line(mach64_t *mach64);
 void mach64_blit(uint32_t cpu_dat, int count, mach64_t *mach64);
+static int mach64_blit_fast(mach64_t *mach64);
 void mach64_load_context(mach64_t *mach64);
 
 uint8_t  mach64_ext_readb(uint32_t addr, void *priv);
@@ -570,16 +558,12 @@ static void mach64_update_irqs(mach64_t *mach64)
 
 static inline void wake_fifo_thread(mach64_t *mach64)
 {
-        thread_set_event(mach64->wake_fifo_thread); /*Wake up FIFO thread if moving from idle*/
+        accel_fifo_wake(&mach64->fifo);
 }
 
 static void mach64_wait_fifo_idle(mach64_t *mach64)
 {
-        while (!FIFO_EMPTY)
-        {
-                wake_fifo_thread(mach64);
-                thread_wait_event(mach64->fifo_not_full_event, 1);
-        }
+        accel_fifo_wait_idle(&mach64->fifo);
 }
 
 #define READ8(addr, var)        switch ((addr) & 3)                                     \
@@ -634,7 +618,7 @@ static void mach64_accel_write_fifo(mach64_t *mach64, uint32_t addr, uint8_t val
 #endif                            
                         if ((mach64->dst_height_width & 0x7ff) && (mach64->dst_height_width & 0x7ff0000) && 
                             ((mach64->dp_src & 7) != SRC_HOST) && (((mach64->dp_src >> 8) & 7) != SRC_HOST) && 
-                            (((mach64->dp_src >> 16) & 3) != MONO_SRC_HOST))
+                            (((mach64->dp_src >> 16) & 3) != MONO_SRC_HOST) && !mach64_blit_fast(mach64))
                                 mach64_blit(0, -1, mach64);
                 }
                 break;
@@ -871,15 +855,13 @@ static void fifo_thread(void *param)
         
         while (1)
         {
-                thread_set_event(mach64->fifo_not_full_event);
-                thread_wait_event(mach64->wake_fifo_thread, -1);
-                thread_reset_event(mach64->wake_fifo_thread);
+                accel_fifo_wait_for_work(&mach64->fifo);
                 mach64->blitter_busy = 1;
                 while (!FIFO_EMPTY)
                 {
                         uint64_t start_time = timer_read();
                         uint64_t end_time;
-                        fifo_entry_t *fifo = &mach64->fifo[mach64->fifo_read_idx & FIFO_MASK];
+                        accel_fifo_entry_t *fifo = ACCEL_FIFO_HEAD(&mach64->fifo);
 
                         switch (fifo->addr_type & FIFO_TYPE)
                         {
@@ -894,11 +876,8 @@ static void fifo_thread(void *param)
                                 break;
                         }
                                                 
-                        mach64->fifo_read_idx++;
                         fifo->addr_type = FIFO_INVALID;
-
-                        if (FIFO_ENTRIES > 0xe000)
-                                thread_set_event(mach64->fifo_not_full_event);
+                        accel_fifo_retire(&mach64->fifo);
 
                         end_time = timer_read();
                         mach64->blitter_time += end_time - start_time;
@@ -909,24 +888,7 @@ static void fifo_thread(void *param)
 
 static void mach64_queue(mach64_t *mach64, uint32_t addr, uint32_t val, uint32_t type)
 {
-        fifo_entry_t *fifo = &mach64->fifo[mach64->fifo_write_idx & FIFO_MASK];
-
-        if (FIFO_FULL)
-        {
-                thread_reset_event(mach64->fifo_not_full_event);
-                if (FIFO_FULL)
-                {
-                        thread_wait_event(mach64->fifo_not_full_event, -1); /*Wait for room in ringbuffer*/
-                }
-        }
-
-        fifo->val = val;
-        fifo->addr_type = (addr & FIFO_ADDR) | type;
-
-        mach64->fifo_write_idx++;
-        
-        if (FIFO_ENTRIES > 0xe000 || FIFO_ENTRIES < 8)
-                wake_fifo_thread(mach64);
+        accel_fifo_queue(&mach64->fifo, (addr & FIFO_ADDR) | type, val);
 }
 
 void mach64_cursor_dump(mach64_t *mach64)
@@ -1189,6 +1151,116 @@ void mach64_start_line(mach64_t *mach64)
                                         svga->changedvram[(((addr) >> 3) & mach64->vram_mask) >> 12] = changeframecount;        \
                                 }
 
+static void mach64_rect_end(mach64_t *mach64)
+{
+#ifdef MACH64_DEBUG
+        pclog("mach64 blit finished\n");
+#endif
+        mach64->accel.busy = 0;
+        if (mach64->dst_cntl & DST_X_TILE)
+                mach64->dst_y_x = (mach64->dst_y_x & 0xfff) | ((mach64->dst_y_x + (mach64->accel.dst_width << 16)) & 0xfff0000);
+        if (mach64->dst_cntl & DST_Y_TILE)
+                mach64->dst_y_x = (mach64->dst_y_x & 0xfff0000) | ((mach64->dst_y_x + (mach64->dst_height_width & 0x1fff)) & 0xfff);
+}
+
+/*Mach64 mixes as common blit core raster operations*/
+static const uint8_t mach64_mix_rop[16] =
+{
+        BLIT_ROP_ND,   BLIT_ROP_0,    BLIT_ROP_1,    BLIT_ROP_D,
+        BLIT_ROP_NS,   BLIT_ROP_XOR,  BLIT_ROP_XNOR, BLIT_ROP_S,
+        BLIT_ROP_NAND, BLIT_ROP_NSOD, BLIT_ROP_SOND, BLIT_ROP_OR,
+        BLIT_ROP_AND,  BLIT_ROP_SAND, BLIT_ROP_NSAD, BLIT_ROP_NOR
+};
+
+/*Rectangle fills with the foreground colour and screen to screen copies with
+  no monochrome mix, colour compare, polygon outline, 24-bit colour rotation
+  or source wrapping reduce to a single scissored rectangle for the common
+  blit core. Returns 0 if the per-pixel path must be used*/
+static int mach64_blit_fast(mach64_t *mach64)
+{
+        svga_t *svga = &mach64->svga;
+        int width = mach64->accel.dst_width, height = mach64->accel.dst_height;
+        int xinc = mach64->accel.xinc, yinc = mach64->accel.yinc;
+        int size = mach64->accel.dst_size;
+        int x_l, x_r, y_t, y_b;
+        uint32_t dst;
+        uint8_t rop;
+        
+        if (mach64->accel.op != OP_RECT || mach64->accel.source_mix != MONO_SRC_1 ||
+            mach64->accel.mix_fg > 0xf || size == WIDTH_1BIT)
+                return 0;
+        if (mach64->dst_cntl & (DST_POLYGON_EN | DST_24_ROT_EN))
+                return 0;
+        if (mach64->accel.clr_cmp_fn == 1 || mach64->accel.clr_cmp_fn == 4 || mach64->accel.clr_cmp_fn == 5)
+                return 0;
+        if (mach64->accel.source_fg != SRC_FG && mach64->accel.source_fg != SRC_BLITSRC)
+                return 0;
+        rop = mach64_mix_rop[mach64->accel.mix_fg];
+
+        /*The rectangle runs from the start point in the blit direction, and
+          must not wrap around the 12-bit coordinate space*/
+        x_l = (xinc > 0) ? mach64->accel.dst_x_start : mach64->accel.dst_x_start - (width - 1);
+        y_t = (yinc > 0) ? mach64->accel.dst_y_start : mach64->accel.dst_y_start - (height - 1);
+        x_r = x_l + width - 1;
+        y_b = y_t + height - 1;
+        if (x_l < 0 || x_r > 0xfff || y_t < 0 || y_b > 0xfff)
+                return 0;
+
+        x_l = MAX(x_l, mach64->accel.sc_left);
+        x_r = MIN(x_r, mach64->accel.sc_right);
+        y_t = MAX(y_t, mach64->accel.sc_top);
+        y_b = MIN(y_b, mach64->accel.sc_bottom);
+        if (x_l > x_r || y_t > y_b)
+        {
+                mach64_rect_end(mach64);
+                return 1;
+        }
+
+        if (mach64->accel.source_fg == SRC_FG)
+        {
+                dst = mach64->accel.dst_offset + y_t * mach64->accel.dst_pitch + x_l;
+                if (!blit_fill(svga->vram, mach64->vram_mask, svga->changedvram,
+                               dst << size, mach64->accel.dst_pitch << size,
+                               (x_r - x_l + 1) << size, y_b - y_t + 1,
+                               mach64->accel.dp_frgd_clr, 1 << size, rop))
+                        return 0;
+        }
+        else
+        {
+                int src_x_l = mach64->accel.src_x_start + (x_l - mach64->accel.dst_x_start);
+                int src_y = mach64->accel.src_y_start + (((yinc > 0) ? y_t : y_b) - mach64->accel.dst_y_start);
+                int src_pitch = mach64->accel.src_pitch << size;
+                int dst_pitch = mach64->accel.dst_pitch << size;
+                uint32_t src;
+
+                /*The source must be linear in both directions and have the
+                  same pixel size as the destination*/
+                if ((mach64->src_cntl & (SRC_LINEAR_EN | SRC_PATT_EN)) || mach64->accel.src_size != size ||
+                    mach64->accel.src_width1 < width)
+                        return 0;
+                if (src_x_l < 0 || src_x_l + (x_r - x_l) > 0xfff ||
+                    src_y < 0 || src_y > 0xfff || src_y + yinc * (y_b - y_t) < 0 || src_y + yinc * (y_b - y_t) > 0xfff)
+                        return 0;
+
+                /*Rows are done in the blit's Y direction, starting from the
+                  first row it would draw*/
+                dst = mach64->accel.dst_offset + ((yinc > 0) ? y_t : y_b) * mach64->accel.dst_pitch + x_l;
+                src = mach64->accel.src_offset + src_y * mach64->accel.src_pitch + src_x_l;
+                if (yinc < 0)
+                {
+                        dst_pitch = -dst_pitch;
+                        src_pitch = -src_pitch;
+                }
+                if (!blit_copy(svga->vram, mach64->vram_mask, svga->changedvram,
+                               dst << size, src << size, dst_pitch, src_pitch,
+                               (x_r - x_l + 1) << size, y_b - y_t + 1, xinc < 0, rop))
+                        return 0;
+        }
+        
+        mach64_rect_end(mach64);
+        return 1;
+}
+
 void mach64_blit(uint32_t cpu_dat, int count, mach64_t *mach64)
 {
         svga_t *svga = &mach64->svga;
@@ -1383,14 +1455,7 @@ void mach64_blit(uint32_t cpu_dat, int count, mach64_t *mach64)
                                 if (mach64->accel.dst_height <= 0)
                                 {
                                         /*Blit finished*/
-#ifdef MACH64_DEBUG
-                                        pclog("mach64 blit finished\n");
-#endif
-                                        mach64->accel.busy = 0;
-                                        if (mach64->dst_cntl & DST_X_TILE)
-                                                mach64->dst_y_x = (mach64->dst_y_x & 0xfff) | ((mach64->dst_y_x + (mach64->accel.dst_width << 16)) & 0xfff0000);
-                                        if (mach64->dst_cntl & DST_Y_TILE)
-                                                mach64->dst_y_x = (mach64->dst_y_x & 0xfff0000) | ((mach64->dst_y_x + (mach64->dst_height_width & 0x1fff)) & 0xfff);
+                                        mach64_rect_end(mach64);
                                         return;
                                 }
                                 if (mach64->host_cntl & HOST_BYTE_ALIGN)
@@ -3417,9 +3482,7 @@ static void *mach64_common_init()
                 
         mach64->dst_cntl = 3;
 
-        mach64->wake_fifo_thread = thread_create_event();
-        mach64->fifo_not_full_event = thread_create_event();
-        mach64->fifo_thread = thread_create(fifo_thread, mach64);
+        accel_fifo_init(&mach64->fifo, fifo_thread, mach64);
 
         ddc_init();
         
@@ -3482,9 +3545,7 @@ void mach64_close(void *p)
 
         svga_close(&mach64->svga);
         
-        thread_kill(mach64->fifo_thread);
-        thread_destroy_event(mach64->wake_fifo_thread);
-        thread_destroy_event(mach64->fifo_not_full_event);
+        accel_fifo_close(&mach64->fifo);
 
         free(mach64);
 }
@@ -0,0 +1,282 @@
+/*Common 2D blit core for the SVGA accelerators. Front-ends decode their
+  registers into rectangle copies, transparent copies and fills, and fall back
+  to their own per-pixel code for anything not handled here (pattern and
+  colour expansion, plane masks, clipping that doesn't reduce to a rectangle)*/
+#include <string.h>
+#include "ibm.h"
+#include "video.h"
+#include "vid_blit.h"
+
+typedef struct blit_trans_t
+{
+        uint32_t colour, mask;
+        int bytes_pp;
+        int flags;
+} blit_trans_t;
+
+typedef void (*blit_row_t)(uint8_t *dst, const uint8_t *src, int len);
+typedef void (*blit_fill_row_t)(uint8_t *dst, const uint8_t *pat, int len);
+typedef void (*blit_trans_row_t)(uint8_t *dst, const uint8_t *src, int len, const blit_trans_t *trans);
+
+/*Row functions, specialised per raster op. The copy functions process bytes in
+  ascending order, so overlapping source and destination behave as they would
+  in a byte-at-a-time loop. The fill functions take a 4 byte pattern that is
+  in phase with dst. The transparent copy functions work a pixel at a time,
+  and only write pixels whose source (or result) passes the colour compare.
+  Not every op uses both s and d; the unused loads are dropped by the
+  compiler*/
+#define BLIT_ROP(name, op)                                                              \
+static void blit_row_ ## name(uint8_t *dst, const uint8_t *src, int len)                \
+{                                                                                       \
+        int c;                                                                          \
+                                                                                        \
+        for (c = 0; c < len; c++)                                                       \
+        {                                                                               \
+                uint8_t s = src[c], d = dst[c];                                         \
+                (void)s; (void)d;                                                       \
+                dst[c] = op;                                                            \
+        }                                                                               \
+}                                                                                       \
+static void blit_fill_row_ ## name(uint8_t *dst, const uint8_t *pat, int len)           \
+{                                                                                       \
+        int c;                                                                          \
+                                                                                        \
+        for (c = 0; c < len; c++)                                                       \
+        {                                                                               \
+                uint8_t s = pat[c & 3], d = dst[c];                                     \
+                (void)s; (void)d;                                                       \
+                dst[c] = op;                                                            \
+        }                                                                               \
+}                                                                                       \
+static void blit_trans_row_ ## name(uint8_t *dst, const uint8_t *src, int len,          \
+                                    const blit_trans_t *trans)                          \
+{                                                                                       \
+        int c, i, match;                                                                \
+                                                                                        \
+        for (c = 0; c < len; c += trans->bytes_pp)                                      \
+        {                                                                               \
+                uint8_t out[4];                                                         \
+                uint32_t key = 0;                                                       \
+                                                                                        \
+                for (i = 0; i < trans->bytes_pp; i++)                                   \
+                {                                                                       \
+                        uint8_t s = src[c + i], d = dst[c + i];                         \
+                        (void)s; (void)d;                                               \
+                        out[i] = op;                                                    \
+                        if (trans->flags & BLIT_TRANS_RESULT)                           \
+                                key |= (uint32_t)out[i] << (i * 8);                     \
+                        else                                                            \
+                                key |= (uint32_t)s << (i * 8);                          \
+                }                                                                       \
+                match = ((key & trans->mask) == trans->colour);                         \
+                if (match == !!(trans->flags & BLIT_TRANS_MATCH))                       \
+                        memcpy(&dst[c], out, trans->bytes_pp);                          \
+        }                                                                               \
+}
+
+BLIT_ROP(0,    0)
+BLIT_ROP(nor,  ~(s | d))
+BLIT_ROP(nsad, ~s & d)
+BLIT_ROP(ns,   ~s)
+BLIT_ROP(sand, s & ~d)
+BLIT_ROP(nd,   ~d)
+BLIT_ROP(xor,  s ^ d)
+BLIT_ROP(nand, ~(s & d))
+BLIT_ROP(and,  s & d)
+BLIT_ROP(xnor, ~(s ^ d))
+BLIT_ROP(s,    s)
+BLIT_ROP(nsod, ~s | d)
+BLIT_ROP(sond, s | ~d)
+BLIT_ROP(or,   s | d)
+BLIT_ROP(1,    0xff)
+
+/*Indexed by rop >> 4. BLIT_ROP_D leaves VRAM untouched, so has no row
+  function*/
+static const blit_row_t blit_row[16] =
+{
+        blit_row_0,    blit_row_nor,  blit_row_nsad, blit_row_ns,
+        blit_row_sand, blit_row_nd,   blit_row_xor,  blit_row_nand,
+        blit_row_and,  blit_row_xnor, NULL,          blit_row_nsod,
+        blit_row_s,    blit_row_sond, blit_row_or,   blit_row_1
+};
+static const blit_fill_row_t blit_fill_row[16] =
+{
+        blit_fill_row_0,    blit_fill_row_nor,  blit_fill_row_nsad, blit_fill_row_ns,
+        blit_fill_row_sand, blit_fill_row_nd,   blit_fill_row_xor,  blit_fill_row_nand,
+        blit_fill_row_and,  blit_fill_row_xnor, NULL,               blit_fill_row_nsod,
+        blit_fill_row_s,    blit_fill_row_sond, blit_fill_row_or,   blit_fill_row_1
+};
+static const blit_trans_row_t blit_trans_row[16] =
+{
+        blit_trans_row_0,    blit_trans_row_nor,  blit_trans_row_nsad, blit_trans_row_ns,
+        blit_trans_row_sand, blit_trans_row_nd,   blit_trans_row_xor,  blit_trans_row_nand,
+        blit_trans_row_and,  blit_trans_row_xnor, NULL,                blit_trans_row_nsod,
+        blit_trans_row_s,    blit_trans_row_sond, blit_trans_row_or,   blit_trans_row_1
+};
+
+static inline int blit_row_wraps(uint32_t addr, uint32_t vram_mask, int width)
+{
+        return (addr & vram_mask) + width - 1 > vram_mask;
+}
+
+static inline void blit_mark_changed(uint8_t *changedvram, uint32_t addr, int width)
+{
+        uint32_t page;
+
+        for (page = addr >> 12; page <= (addr + width - 1) >> 12; page++)
+                changedvram[page] = changeframecount;
+}
+
+static int blit_valid_rop(uint8_t rop)
+{
+        return (rop & 0xf) == (rop >> 4);
+}
+
+/*Check that a copy can be done by the row functions. reads_src is set if the
+  result depends on the source, and plain_copy if a descending row can be done
+  with memmove()*/
+static int blit_copy_valid(uint32_t vram_mask, uint32_t dst, uint32_t src,
+                           int dst_pitch, int src_pitch, int width, int height,
+                           int descending, int reads_src, int plain_copy)
+{
+        int y;
+        
+        for (y = 0; y < height; y++, dst += dst_pitch, src += src_pitch)
+        {
+                if (blit_row_wraps(dst, vram_mask, width) || blit_row_wraps(src, vram_mask, width))
+                        return 0;
+                /*The row functions run in ascending order, so can't reproduce
+                  a descending copy where source and destination overlap. The
+                  one exception is a plain copy to a higher address, which is
+                  what memmove() does*/
+                if (descending && reads_src)
+                {
+                        uint32_t d_addr = dst & vram_mask, s_addr = src & vram_mask;
+
+                        if (d_addr < s_addr + width && s_addr < d_addr + width &&
+                            !(plain_copy && d_addr > s_addr))
+                                return 0;
+                }
+        }
+        
+        return 1;
+}
+
+int blit_copy(uint8_t *vram, uint32_t vram_mask, uint8_t *changedvram,
+              uint32_t dst, uint32_t src, int dst_pitch, int src_pitch,
+              int width, int height, int descending, uint8_t rop)
+{
+        blit_row_t row_func;
+        int y;
+        
+        if (width <= 0 || height <= 0 || !blit_valid_rop(rop))
+                return 0;
+        if (!blit_copy_valid(vram_mask, dst, src, dst_pitch, src_pitch, width, height,
+                             descending, (rop & 0x33) != (rop & 0xcc) >> 2, rop == BLIT_ROP_S))
+                return 0;
+
+        if (rop == BLIT_ROP_D)
+                return 1;
+        row_func = blit_row[rop >> 4];
+        
+        for (y = 0; y < height; y++, dst += dst_pitch, src += src_pitch)
+        {
+                uint32_t d_addr = dst & vram_mask, s_addr = src & vram_mask;
+
+                /*memmove() matches a byte loop in the blit's direction unless
+                  an ascending loop would run into bytes it has just written*/
+                if (rop == BLIT_ROP_S && (descending || d_addr <= s_addr || d_addr >= s_addr + width))
+                        memmove(&vram[d_addr], &vram[s_addr], width);
+                else
+                        row_func(&vram[d_addr], &vram[s_addr], width);
+                blit_mark_changed(changedvram, d_addr, width);
+        }
+        
+        return 1;
+}
+
+int blit_copy_trans(uint8_t *vram, uint32_t vram_mask, uint8_t *changedvram,
+                    uint32_t dst, uint32_t src, int dst_pitch, int src_pitch,
+                    int width, int height, int descending, uint8_t rop,
+                    int bytes_pp, uint32_t trans_colour, uint32_t trans_mask, int trans_flags)
+{
+        blit_trans_row_t row_func;
+        blit_trans_t trans;
+        int y;
+        
+        if (width <= 0 || height <= 0 || !blit_valid_rop(rop) || (width % bytes_pp))
+                return 0;
+        /*The compare always reads the source, even if the op doesn't*/
+        if (!blit_copy_valid(vram_mask, dst, src, dst_pitch, src_pitch, width, height,
+                             descending, 1, 0))
+                return 0;
+
+        if (rop == BLIT_ROP_D)
+                return 1;
+        row_func = blit_trans_row[rop >> 4];
+        
+        trans.colour = trans_colour;
+        trans.mask = trans_mask;
+        trans.bytes_pp = bytes_pp;
+        trans.flags = trans_flags;
+
+        for (y = 0; y < height; y++, dst += dst_pitch, src += src_pitch)
+        {
+                uint32_t d_addr = dst & vram_mask, s_addr = src & vram_mask;
+
+                row_func(&vram[d_addr], &vram[s_addr], width, &trans);
+                blit_mark_changed(changedvram, d_addr, width);
+        }
+        
+        return 1;
+}
+
+int blit_fill(uint8_t *vram, uint32_t vram_mask, uint8_t *changedvram,
+              uint32_t dst, int dst_pitch, int width, int height,
+              uint32_t colour, int bytes_pp, uint8_t rop)
+{
+        blit_fill_row_t row_func;
+        uint8_t pat[8];
+        uint32_t d;
+        int y;
+        
+        if (width <= 0 || height <= 0 || !blit_valid_rop(rop))
+                return 0;
+
+        for (y = 0, d = dst; y < height; y++, d += dst_pitch)
+        {
+                if (blit_row_wraps(d, vram_mask, width))
+                        return 0;
+        }
+        
+        if (rop == BLIT_ROP_D)
+                return 1;
+        row_func = blit_fill_row[rop >> 4];
+
+        switch (bytes_pp)
+        {
+                case 1:
+                colour = (colour & 0xff) * 0x01010101;
+                break;
+                case 2:
+                colour = (colour & 0xffff) * 0x00010001;
+                break;
+        }
+        /*Two copies of the pattern, so a row starting at any byte phase can
+          use &pat[phase]*/
+        memcpy(pat, &colour, 4);
+        memcpy(&pat[4], &colour, 4);
+
+        for (y = 0; y < height; y++, dst += dst_pitch)
+        {
+                uint32_t d_addr = dst & vram_mask;
+
+                if (rop == BLIT_ROP_S && bytes_pp == 1)
+                        memset(&vram[d_addr], colour & 0xff, width);
+                else
+                        row_func(&vram[d_addr], &pat[d_addr & 3], width);
+                blit_mark_changed(changedvram, d_addr, width);
+        }
+        
+        return 1;
+}
@@ -0,0 +1,57 @@
+/*Raster operations on source (S) and destination (D), encoded as the result
+  of the operation with S = 0xcc and D = 0xaa (as in the S and D terms of a
+  Windows ROP3 code)*/
+#define BLIT_ROP_0      0x00
+#define BLIT_ROP_NOR    0x11 /*~(S | D)*/
+#define BLIT_ROP_NSAD   0x22 /*~S & D*/
+#define BLIT_ROP_NS     0x33 /*~S*/
+#define BLIT_ROP_SAND   0x44 /*S & ~D*/
+#define BLIT_ROP_ND     0x55 /*~D*/
+#define BLIT_ROP_XOR    0x66 /*S ^ D*/
+#define BLIT_ROP_NAND   0x77 /*~(S & D)*/
+#define BLIT_ROP_AND    0x88 /*S & D*/
+#define BLIT_ROP_XNOR   0x99 /*~(S ^ D)*/
+#define BLIT_ROP_D      0xaa /*D*/
+#define BLIT_ROP_NSOD   0xbb /*~S | D*/
+#define BLIT_ROP_S      0xcc /*S*/
+#define BLIT_ROP_SOND   0xdd /*S | ~D*/
+#define BLIT_ROP_OR     0xee /*S | D*/
+#define BLIT_ROP_1      0xff
+
+/*Copy a rectangle within VRAM, applying rop to each byte. dst and src are the
+  lowest byte addresses of the first row, pitches are signed and in bytes.
+  Rows are processed in order. Within a row, bytes are processed in ascending
+  order, or in descending order if descending is set. VRAM addresses are
+  masked with vram_mask (which must be 2^n-1) and written pages are marked in
+  changedvram.
+
+  Returns 1 if the blit was done. Returns 0 without writing anything if a row
+  would wrap around the end of VRAM, or if a descending row overlaps its own
+  source in a way the row functions can't reproduce. The caller should then
+  use its own per-pixel path*/
+int blit_copy(uint8_t *vram, uint32_t vram_mask, uint8_t *changedvram,
+              uint32_t dst, uint32_t src, int dst_pitch, int src_pitch,
+              int width, int height, int descending, uint8_t rop);
+
+/*Transparency compare flags for blit_copy_trans()*/
+#define BLIT_TRANS_MATCH  1 /*Write pixels that match the colour, rather than those that don't*/
+#define BLIT_TRANS_RESULT 2 /*Compare the result of rop rather than the source*/
+
+/*As blit_copy(), but a pixel of bytes_pp bytes (1, 2 or 4) is only written if
+  its source (or result, with BLIT_TRANS_RESULT) ANDed with trans_mask doesn't
+  equal trans_colour (or does, with BLIT_TRANS_MATCH). Pixels are taken as
+  little endian. width must be a multiple of bytes_pp. Any descending blit
+  where a row overlaps its own source falls back*/
+int blit_copy_trans(uint8_t *vram, uint32_t vram_mask, uint8_t *changedvram,
+                    uint32_t dst, uint32_t src, int dst_pitch, int src_pitch,
+                    int width, int height, int descending, uint8_t rop,
+                    int bytes_pp, uint32_t trans_colour, uint32_t trans_mask, int trans_flags);
+
+/*Fill a rectangle in VRAM with a solid colour, applying rop with the colour
+  as the source. bytes_pp is the pixel size (1, 2 or 4). The colour is laid
+  out in phase with 4 byte aligned addresses, so a dst that isn't pixel
+  aligned starts part way through a pixel. Returns 0 without writing anything
+  if a row would wrap*/
+int blit_fill(uint8_t *vram, uint32_t vram_mask, uint8_t *changedvram,
+              uint32_t dst, int dst_pitch, int width, int height,
+              uint32_t colour, int bytes_pp, uint8_t rop);
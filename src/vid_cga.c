@@ -127,6 +127,32 @@ void cga_recalctimings(cga_t *cga)
 	cga->dispofftime = (uint64_t)_dispofftime;
 }
 
+/*Returns 1 if the current text line is unchanged since it was last drawn*/
+static int cga_line_unchanged(cga_t *cga, uint16_t ca)
+{
+        uint32_t key[TEXT_LINE_KEY_SIZE];
+        uint16_t cursor_pos = ca - cga->ma;
+        
+        if (!cga->line_cache)
+                return 0;
+        if (!cga->cgadispon || (cga->cgamode & 2))
+        {
+                text_line_cache_invalidate(cga->line_cache, cga->displine);
+                return 0;
+        }
+
+        key[0] = cga->cgamode | (cga->cgacol << 8) | (cga->crtc[1] << 16) | ((cga->sc & 7) << 24);
+        key[1] = cga->fontbase;
+        key[2] = (cga->con && cga->cursoron && cursor_pos < cga->crtc[1]) ? cursor_pos : 0xffff;
+        key[3] = (cga->cgamode & 0x20) ? ((cga->cgablink & 8) | (cga->drawcursor ? 0x10 : 0)) : 0;
+        key[4] = cga->composite;
+        key[5] = 0;
+        
+        if (cga->cgamode & 1)
+                return text_line_cache_check(cga->line_cache, cga->displine, key, cga->charbuffer, 0, 0xff, cga->crtc[1] << 1);
+        return text_line_cache_check(cga->line_cache, cga->displine, key, cga->vram, cga->ma << 1, 0x3fff, cga->crtc[1] << 1);
+}
+
 void cga_poll(void *p)
 {
         cga_t *cga = (cga_t *)p;
@@ -158,6 +184,12 @@ void cga_poll(void *p)
                         }
                         cga->lastline = cga->displine;
                         
+                        if (cga_line_unchanged(cga, ca))
+                        {
+                                cga->ma += cga->crtc[1];
+                                goto line_done;
+                        }
+
                         cols[0] = ((cga->cgamode & 0x12) == 0x12) ? 0 : (cga->cgacol & 15);
                         for (c = 0; c < 8; c++)
                         {
@@ -192,15 +224,9 @@ void cga_poll(void *p)
                                                 cols[0] = attr >> 4;
                                         }
                                         if (drawcursor)
-                                        {
-                                                for (c = 0; c < 8; c++)
-                                                        ((uint32_t *)buffer32->line[cga->displine])[(x << 3) + c + 8] = cols[(fontdat[chr + cga->fontbase][cga->sc & 7] & (1 << (c ^ 7))) ? 1 : 0] ^ 0xffffff;
-                                        }
+                                                video_expand_glyph(&((uint32_t *)buffer32->line[cga->displine])[(x << 3) + 8], fontdat[chr + cga->fontbase][cga->sc & 7], cols[1] ^ 0xffffff, cols[0] ^ 0xffffff);
                                         else
-                                        {
-                                                for (c = 0; c < 8; c++)
-                                                        ((uint32_t *)buffer32->line[cga->displine])[(x << 3) + c + 8] = cols[(fontdat[chr + cga->fontbase][cga->sc & 7] & (1 << (c ^ 7))) ? 1 : 0];
-                                        }
+                                                video_expand_glyph(&((uint32_t *)buffer32->line[cga->displine])[(x << 3) + 8], fontdat[chr + cga->fontbase][cga->sc & 7], cols[1], cols[0]);
                                         cga->ma++;
                                 }
                         }
@@ -230,17 +256,9 @@ void cga_poll(void *p)
                                         }
                                         cga->ma++;
                                         if (drawcursor)
-                                        {
-                                                for (c = 0; c < 8; c++)
-                                                        ((uint32_t *)buffer32->line[cga->displine])[(x << 4)+(c << 1) + 8] =
-                                                        ((uint32_t *)buffer32->line[cga->displine])[(x << 4) + (c << 1) + 1 + 8] = cols[(fontdat[chr + cga->fontbase][cga->sc & 7] & (1 << (c ^ 7))) ? 1 : 0] ^ 0xffffff;
-                                        }
+                                                video_expand_glyph_double(&((uint32_t *)buffer32->line[cga->displine])[(x << 4) + 8], fontdat[chr + cga->fontbase][cga->sc & 7], cols[1] ^ 0xffffff, cols[0] ^ 0xffffff);
                                         else
-                                        {
-                                                for (c = 0; c < 8; c++)
-                                                        ((uint32_t *)buffer32->line[cga->displine])[(x << 4) + (c << 1) + 8] =
-                                                        ((uint32_t *)buffer32->line[cga->displine])[(x << 4) + (c << 1) + 1 + 8] = cols[(fontdat[chr + cga->fontbase][cga->sc & 7] & (1 << (c ^ 7))) ? 1 : 0];
-                                        }
+                                                video_expand_glyph_double(&((uint32_t *)buffer32->line[cga->displine])[(x << 4) + 8], fontdat[chr + cga->fontbase][cga->sc & 7], cols[1], cols[0]);
                                 }
                         }
                         else if (!(cga->cgamode & 16))
@@ -301,6 +319,7 @@ void cga_poll(void *p)
                 }
                 else
                 {
+                        text_line_cache_invalidate(cga->line_cache, cga->displine);
                         cols[0] = ((cga->cgamode & 0x12) == 0x12) ? 0 : (cga->cgacol & 15);
                         if (cga->cgamode & 1) hline(buffer32, 0, cga->displine, (cga->crtc[1] << 3) + 16, cols[0]);
                         else                  hline(buffer32, 0, cga->displine, (cga->crtc[1] << 4) + 16, cols[0]);
@@ -322,6 +341,7 @@ void cga_poll(void *p)
 				((uint32_t *)buffer32->line[cga->displine])[c] = cgapal[((uint32_t *)buffer32->line[cga->displine])[c] & 0xf];
                 }                        
 
+line_done:
                 cga->sc = oldsc;
                 if (cga->vc == cga->crtc[7] && !cga->sc)
                    cga->cgastat |= 8;
@@ -469,6 +489,7 @@ void *cga_standalone_init()
         contrast = device_get_config_int("contrast");
 
         cga->vram = malloc(0x4000);
+        cga->line_cache = text_line_cache_alloc(360);
                 
 	cga_comp_init(cga->revision);
 
@@ -485,6 +506,7 @@ void cga_close(void *p)
 {
         cga_t *cga = (cga_t *)p;
 
+        free(cga->line_cache);
         free(cga->vram);
         free(cga);
 }
@@ -32,6 +32,10 @@ typedef struct cga_t
 	int revision;
 	int composite;
 	int snow_enabled;
+
+	/*Only allocated by the standalone CGA device - boards that embed the
+	  CGA may draw over its lines with their own renderers*/
+	struct text_line_cache_t *line_cache;
 } cga_t;
 
 void    cga_init(cga_t *cga);
@@ -9,6 +9,7 @@
 #include "pci.h"
 #include "rom.h"
 #include "video.h"
+#include "vid_blit.h"
 #include "vid_cl5429.h"
 #include "vid_svga.h"
 #include "vid_svga_render.h"
@@ -178,6 +179,7 @@ void gd5429_out(uint16_t addr, uint8_t val, void *p)
                                 
                                 case 0x07:
                                 svga->set_reset_disabled = svga->seqregs[7] & 1;
+                                svga_recalc_write(svga);
                                 case 0x17:
                                 if (gd5429->type >= CL_TYPE_GD5429)
                                         gd5429_recalc_mapping(gd5429);
@@ -218,6 +220,7 @@ void gd5429_out(uint16_t addr, uint8_t val, void *p)
                         svga->readmode = val & 8;
                         svga->chain2_read = val & 0x10;
 //                        pclog("writemode = %i\n", svga->writemode);
+                        svga_recalc_write(svga);
                         return;
                 }
                 if (svga->gdcaddr == 6)
@@ -257,6 +260,7 @@ void gd5429_out(uint16_t addr, uint8_t val, void *p)
                                         svga->writemode = svga->gdcreg[5] & 7;
                                 else
                                         svga->writemode = svga->gdcreg[5] & 3;
+                                svga_recalc_write(svga);
                                 break;
 
                                 case 0x10:
@@ -1327,6 +1331,80 @@ static uint32_t gd5429_readl_linear(uint32_t addr, void *p)
 }
 
 
+/*VRAM to VRAM blits with no pixel skipping or pattern/colour expansion are
+  plain rectangle copies, so are handed to the common blit core in one go.
+  Transparency on the GD5428 and earlier compares each result byte against
+  the transparent colour; on later chips it only applies to expanded colour,
+  so doesn't affect a plain copy. Returns 0 if the blit has to go through the
+  per-pixel path*/
+static int gd5429_blit_fast(gd5429_t *gd5429)
+{
+        svga_t *svga = &gd5429->svga;
+        int width = gd5429->blt.width + 1;
+        int height = gd5429->blt.height + 1;
+        int dst_pitch = gd5429->blt.dst_pitch;
+        int src_pitch = gd5429->blt.src_pitch;
+        uint32_t dst = gd5429->blt.dst_addr;
+        uint32_t src = gd5429->blt.src_addr;
+        int descending = gd5429->blt.mode & 0x01;
+        uint32_t first_dst = dst, first_src = src;
+        uint8_t rop;
+        int done;
+
+        if ((gd5429->blt.mode & 0xc4) || (gd5429->blt.mask & 7))
+                return 0;
+
+        switch (gd5429->blt.rop)
+        {
+                case 0x00: rop = BLIT_ROP_0;    break;
+                case 0x05: rop = BLIT_ROP_AND;  break;
+                case 0x09: rop = BLIT_ROP_SAND; break;
+                case 0x0b: rop = BLIT_ROP_ND;   break;
+                case 0x0d: rop = BLIT_ROP_S;    break;
+                case 0x0e: rop = BLIT_ROP_1;    break;
+                case 0x50: rop = BLIT_ROP_NSAD; break;
+                case 0x59: rop = BLIT_ROP_XOR;  break;
+                case 0x6d: rop = BLIT_ROP_OR;   break;
+                case 0x90: rop = BLIT_ROP_NOR;  break;
+                case 0x95: rop = BLIT_ROP_XNOR; break;
+                case 0xad: rop = BLIT_ROP_SOND; break;
+                case 0xd0: rop = BLIT_ROP_NS;   break;
+                case 0xd6: rop = BLIT_ROP_NSOD; break;
+                case 0xda: rop = BLIT_ROP_NAND; break;
+                default:   rop = BLIT_ROP_D;    break;
+        }
+
+        if (descending)
+        {
+                dst_pitch = -dst_pitch;
+                src_pitch = -src_pitch;
+                first_dst = dst - (width - 1);
+                first_src = src - (width - 1);
+        }
+        if ((gd5429->blt.mode & 0x08) && gd5429->type <= CL_TYPE_GD5428)
+                done = blit_copy_trans(svga->vram, svga->vram_mask, svga->changedvram,
+                                       first_dst, first_src, dst_pitch, src_pitch,
+                                       width, height, descending, rop,
+                                       1, gd5429->blt.trans_col, gd5429->blt.trans_mask, BLIT_TRANS_RESULT);
+        else
+                done = blit_copy(svga->vram, svga->vram_mask, svga->changedvram,
+                                 first_dst, first_src, dst_pitch, src_pitch,
+                                 width, height, descending, rop);
+        if (!done)
+                return 0;
+
+        /*Leave the registers as the per-pixel path would at the end of the
+          blit*/
+        gd5429->blt.dst_addr = gd5429->blt.dst_addr_backup = dst + dst_pitch * height;
+        gd5429->blt.src_addr = gd5429->blt.src_addr_backup = src + src_pitch * height;
+        gd5429->blt.width = gd5429->blt.width_backup;
+        gd5429->blt.height_internal = 0xffff;
+        gd5429->blt.x_count = 0;
+        gd5429->blt.y_count = (gd5429->blt.y_count + (descending ? -height : height)) & 7;
+        
+        return 1;
+}
+
 void gd5429_start_blit(uint32_t cpu_dat, int count, void *p)
 {
         gd5429_t *gd5429 = (gd5429_t *)p;
@@ -1386,6 +1464,9 @@ void gd5429_start_blit(uint32_t cpu_dat, int count, void *p)
                         else
                                 mem_mapping_set_handler(&gd5429->linear_mapping, gd5429_readb_linear, gd5429_readw_linear, gd5429_readl_linear, gd5429_writeb_linear, gd5429_writew_linear, gd5429_writel_linear);
                         gd5429_recalc_mapping(gd5429);
+
+                        if (gd5429_blit_fast(gd5429))
+                                return;
                 }                
         }
         else if (gd5429->blt.height_internal == 0xffff)
@@ -12,17 +12,15 @@
 #include "rom.h"
 #include "thread.h"
 #include "video.h"
+#include "vid_blit.h"
+#include "vid_fifo.h"
 #include "vid_svga.h"
 #include "vid_icd2061.h"
 #include "vid_stg_ramdac.h"
 
-#define FIFO_SIZE 65536
-#define FIFO_MASK (FIFO_SIZE - 1)
-#define FIFO_ENTRY_SIZE (1 << 31)
-
-#define FIFO_ENTRIES (et4000->fifo_write_idx - et4000->fifo_read_idx)
-#define FIFO_FULL    ((et4000->fifo_write_idx - et4000->fifo_read_idx) >= (FIFO_SIZE-1))
-#define FIFO_EMPTY   (et4000->fifo_read_idx == et4000->fifo_write_idx)
+#define FIFO_ENTRIES ACCEL_FIFO_ENTRIES(&et4000->fifo)
+#define FIFO_FULL    ACCEL_FIFO_FULL(&et4000->fifo)
+#define FIFO_EMPTY   ACCEL_FIFO_EMPTY(&et4000->fifo)
 
 #define FIFO_TYPE 0xff000000
 #define FIFO_ADDR 0x00ffffff
@@ -34,12 +32,6 @@ enum
         FIFO_WRITE_MMU  = (0x02 << 24)
 };
 
-typedef struct
-{
-        uint32_t addr_type;
-        uint32_t val;
-} fifo_entry_t;
-
 typedef struct et4000w32p_t
 {
         mem_mapping_t linear_mapping;
@@ -94,12 +86,7 @@ typedef struct et4000w32p_t
                 uint8_t ctrl;
         } mmu;
 
-        fifo_entry_t fifo[FIFO_SIZE];
-        volatile int fifo_read_idx, fifo_write_idx;
-
-        thread_t *fifo_thread;
-        event_t *wake_fifo_thread;
-        event_t *fifo_not_full_event;
+        accel_fifo_t fifo;
         
         int blitter_busy;
         uint64_t blitter_time;
@@ -115,6 +102,7 @@ void et4000w32p_mmu_write(uint32_t addr, uint8_t val, void *p);
 
 void et4000w32_blit_start(et4000w32p_t *et4000);
 void et4000w32_blit(int count, uint32_t mix, uint32_t sdat, int cpu_input, et4000w32p_t *et4000);
+static int et4000w32_blit_fast(et4000w32p_t *et4000);
 
 void et4000w32p_out(uint16_t addr, uint8_t val, void *p)
 {
@@ -423,7 +411,8 @@ static void et4000w32p_accel_write_fifo(et4000w32p_t *et4000, uint32_t addr, uin
                 et4000w32_blit_start(et4000);
                 if (!(et4000->acl.queued.ctrl_routing & 0x43))
                 {
-                        et4000w32_blit(0xFFFFFF, ~0, 0, 0, et4000);
+                        if (!et4000w32_blit_fast(et4000))
+                                et4000w32_blit(0xFFFFFF, ~0, 0, 0, et4000);
                 }
                 if ((et4000->acl.queued.ctrl_routing & 0x40) && !(et4000->acl.internal.ctrl_routing & 3))
                         et4000w32_blit(4, ~0, 0, 0, et4000);
@@ -466,15 +455,13 @@ static void fifo_thread(void *param)
         
         while (1)
         {
-                thread_set_event(et4000->fifo_not_full_event);
-                thread_wait_event(et4000->wake_fifo_thread, -1);
-                thread_reset_event(et4000->wake_fifo_thread);
+                accel_fifo_wait_for_work(&et4000->fifo);
                 et4000->blitter_busy = 1;
                 while (!FIFO_EMPTY)
                 {
                         uint64_t start_time = timer_read();
                         uint64_t end_time;
-                        fifo_entry_t *fifo = &et4000->fifo[et4000->fifo_read_idx & FIFO_MASK];
+                        accel_fifo_entry_t *fifo = ACCEL_FIFO_HEAD(&et4000->fifo);
 
                         switch (fifo->addr_type & FIFO_TYPE)
                         {
@@ -486,11 +473,8 @@ static void fifo_thread(void *param)
                                 break;
                         }
                                                 
-                        et4000->fifo_read_idx++;
                         fifo->addr_type = FIFO_INVALID;
-
-                        if (FIFO_ENTRIES > 0xe000)
-                                thread_set_event(et4000->fifo_not_full_event);
+                        accel_fifo_retire(&et4000->fifo);
 
                         end_time = timer_read();
                         et4000->blitter_time += end_time - start_time;
@@ -501,38 +485,17 @@ static void fifo_thread(void *param)
 
 static inline void wake_fifo_thread(et4000w32p_t *et4000)
 {
-        thread_set_event(et4000->wake_fifo_thread); /*Wake up FIFO thread if moving from idle*/
+        accel_fifo_wake(&et4000->fifo);
 }
 
 static void et4000w32p_wait_fifo_idle(et4000w32p_t *et4000)
 {
-        while (!FIFO_EMPTY)
-        {
-                wake_fifo_thread(et4000);
-                thread_wait_event(et4000->fifo_not_full_event, 1);
-        }
+        accel_fifo_wait_idle(&et4000->fifo);
 }
 
 static void et4000w32p_queue(et4000w32p_t *et4000, uint32_t addr, uint32_t val, uint32_t type)
 {
-        fifo_entry_t *fifo = &et4000->fifo[et4000->fifo_write_idx & FIFO_MASK];
-
-        if (FIFO_FULL)
-        {
-                thread_reset_event(et4000->fifo_not_full_event);
-                if (FIFO_FULL)
-                {
-                        thread_wait_event(et4000->fifo_not_full_event, -1); /*Wait for room in ringbuffer*/
-                }
-        }
-
-        fifo->val = val;
-        fifo->addr_type = (addr & FIFO_ADDR) | type;
-
-        et4000->fifo_write_idx++;
-        
-        if (FIFO_ENTRIES > 0xe000 || FIFO_ENTRIES < 8)
-                wake_fifo_thread(et4000);
+        accel_fifo_queue(&et4000->fifo, (addr & FIFO_ADDR) | type, val);
 }
 
 void et4000w32p_mmu_write(uint32_t addr, uint8_t val, void *p)
@@ -1027,6 +990,84 @@ void et4000w32_blit(int count, uint32_t mix, uint32_t sdat, int cpu_input, et400
 }
 
 
+/*Rectangle blits where the ROP ignores either the pattern or the source
+  reduce to a plain copy, or a fill from a single 4 byte pattern line, for
+  the common blit core. The mix map, source wrapping and multi-line patterns
+  aren't handled. Returns 0 if the per-byte path must be used*/
+static int et4000w32_blit_fast(et4000w32p_t *et4000)
+{
+        svga_t *svga = &et4000->svga;
+        uint8_t rop3 = et4000->acl.internal.rop_fg;
+        int width = et4000->acl.internal.count_x + 1;
+        int height = et4000->acl.internal.count_y + 1;
+        int descending = et4000->acl.internal.xy_dir & 1;
+        int dst_pitch = et4000->acl.internal.dest_off + 1;
+        uint32_t dst = et4000->acl.dest_addr;
+        
+        if (!(et4000->acl.status & ACL_XYST) || (et4000->acl.internal.xy_dir & 0x80) ||
+            (et4000->acl.internal.ctrl_routing & 0xa) == 8)
+                return 0;
+        /*The per-byte path stops after 0xffffff bytes*/
+        if ((uint64_t)width * height > 0xffffff)
+                return 0;
+        if (descending)
+                dst -= width - 1;
+        if (et4000->acl.internal.xy_dir & 2)
+                dst_pitch = -dst_pitch;
+
+        if ((rop3 >> 4) == (rop3 & 0xf))
+        {
+                /*Source and destination only. The source is linear if it
+                  doesn't wrap in X, and never reaches a Y wrap*/
+                int src_pitch = et4000->acl.internal.source_off + 1;
+                uint32_t src = et4000->acl.source_addr + et4000->acl.source_x;
+
+                if (et4000w32_wrap_x[et4000->acl.internal.source_wrap & 7] ||
+                    ((et4000->acl.internal.source_wrap >> 4) & 7) < 4)
+                        return 0;
+                if ((et4000->acl.internal.xy_dir & 2) && !(et4000->acl.internal.source_wrap & 0x40) &&
+                    et4000->acl.source_y < height - 1)
+                        return 0;
+                if (descending)
+                        src -= width - 1;
+                if (et4000->acl.internal.xy_dir & 2)
+                        src_pitch = -src_pitch;
+                if (!blit_copy(svga->vram, svga->vram_mask, svga->changedvram,
+                               dst, src, dst_pitch, src_pitch,
+                               width, height, descending, rop3))
+                        return 0;
+        }
+        else if (((rop3 >> 2) & 0x33) == (rop3 & 0x33))
+        {
+                /*Pattern and destination only, with the pattern a single
+                  4 byte line. Each row reads the pattern from the same
+                  pattern_x at its first byte, so with a pitch that's a
+                  multiple of 4 it can be rotated into phase with the
+                  address*/
+                uint8_t rop = (rop3 & 0x03) | ((rop3 >> 2) & 0x0c);
+                int phase = (et4000->acl.pattern_x - et4000->acl.dest_addr) & 3;
+                uint32_t colour = 0;
+                int c;
+
+                if ((et4000->acl.internal.pattern_wrap & 0x77) != 0x02 || et4000w32_max_x[2] != 4 ||
+                    (dst_pitch & 3))
+                        return 0;
+                for (c = 0; c < 4; c++)
+                        colour |= (uint32_t)svga->vram[(et4000->acl.pattern_addr + ((c + phase) & 3)) & svga->vram_mask] << (c * 8);
+                if (!blit_fill(svga->vram, svga->vram_mask, svga->changedvram,
+                               dst, dst_pitch, width, height,
+                               colour, 4, rop | (rop << 4)))
+                        return 0;
+        }
+        else
+                return 0;
+
+        et4000->acl.internal.pos_x = 0;
+        et4000->acl.internal.pos_y = et4000->acl.internal.count_y + 1;
+        et4000->acl.status &= ~(ACL_XYST | ACL_SSO);
+        return 1;
+}
+
 void et4000w32p_hwcursor_draw(svga_t *svga, int displine)
 {
         int x, offset;
@@ -1203,9 +1244,7 @@ void *et4000w32p_init()
         et4000->pci_regs[0x32] = 0x0c;
         et4000->pci_regs[0x33] = 0x00;
         
-        et4000->wake_fifo_thread = thread_create_event();
-        et4000->fifo_not_full_event = thread_create_event();
-        et4000->fifo_thread = thread_create(fifo_thread, et4000);
+        accel_fifo_init(&et4000->fifo, fifo_thread, et4000);
 
         return et4000;
 }
@@ -1221,9 +1260,7 @@ void et4000w32p_close(void *p)
 
         svga_close(&et4000->svga);
         
-        thread_kill(et4000->fifo_thread);
-        thread_destroy_event(et4000->wake_fifo_thread);
-        thread_destroy_event(et4000->fifo_not_full_event);
+        accel_fifo_close(&et4000->fifo);
 
         free(et4000);
 }
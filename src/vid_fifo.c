@@ -0,0 +1,95 @@
+#include <string.h>
+#include "ibm.h"
+#include "thread.h"
+#include "vid_fifo.h"
+
+#define SPIN_MIN 16
+#define SPIN_MAX 4096
+
+void accel_fifo_init(accel_fifo_t *fifo, void (*thread_rout)(void *param), void *param)
+{
+        memset(fifo, 0, sizeof(accel_fifo_t));
+
+        fifo->wait_level = -1;
+        fifo->producer_spin = SPIN_MIN;
+        fifo->consumer_spin = SPIN_MIN;
+
+        fifo->wake_event = thread_create_event();
+        fifo->not_full_event = thread_create_event();
+        fifo->thread = thread_create(thread_rout, param);
+}
+
+void accel_fifo_close(accel_fifo_t *fifo)
+{
+        thread_kill(fifo->thread);
+        thread_destroy_event(fifo->wake_event);
+        thread_destroy_event(fifo->not_full_event);
+}
+
+/*Wake the FIFO thread even if there is nothing new in the ring, eg because
+  the card has other work for it*/
+void accel_fifo_wake(accel_fifo_t *fifo)
+{
+        thread_set_event(fifo->wake_event);
+}
+
+/*Wait until the FIFO holds at most level entries*/
+void accel_fifo_wait_level(accel_fifo_t *fifo, int level)
+{
+        int c;
+
+        for (c = 0; c < fifo->producer_spin; c++)
+        {
+                if (ACCEL_FIFO_ENTRIES(fifo) <= level)
+                {
+                        if (fifo->producer_spin < SPIN_MAX)
+                                fifo->producer_spin <<= 1;
+                        return;
+                }
+        }
+        if (fifo->producer_spin > SPIN_MIN)
+                fifo->producer_spin >>= 1;
+
+        while (ACCEL_FIFO_ENTRIES(fifo) > level)
+        {
+                thread_reset_event(fifo->not_full_event);
+                fifo->wait_level = level;
+                accel_fifo_barrier();
+                if (ACCEL_FIFO_ENTRIES(fifo) > level)
+                {
+                        thread_set_event(fifo->wake_event);
+                        thread_wait_event(fifo->not_full_event, 1);
+                }
+                fifo->wait_level = -1;
+        }
+}
+
+/*Returns once the ring is not empty, or the FIFO thread has been woken by
+  accel_fifo_wake()*/
+void accel_fifo_wait_for_work(accel_fifo_t *fifo)
+{
+        int c;
+
+        for (c = 0; c < fifo->consumer_spin; c++)
+        {
+                if (!ACCEL_FIFO_EMPTY(fifo))
+                {
+                        if (fifo->consumer_spin < SPIN_MAX)
+                                fifo->consumer_spin <<= 1;
+                        return;
+                }
+        }
+        if (fifo->consumer_spin > SPIN_MIN)
+                fifo->consumer_spin >>= 1;
+
+        /*Sequence number is never 0, so the producer can tell we're asleep*/
+        fifo->sleep_count++;
+        if (!fifo->sleep_count)
+                fifo->sleep_count++;
+        fifo->consumer_sleep_seq = fifo->sleep_count;
+        accel_fifo_barrier();
+        if (ACCEL_FIFO_EMPTY(fifo))
+                thread_wait_event(fifo->wake_event, -1);
+        thread_reset_event(fifo->wake_event);
+        fifo->consumer_sleep_seq = 0;
+}
@@ -0,0 +1,124 @@
+/*Single producer, single consumer ring of writes queued to an accelerator
+  and processed by the card's FIFO thread.
+
+  The emulation thread is the only writer of write_idx and the FIFO thread
+  the only writer of read_idx, so the ring itself needs no lock. Neither
+  side signals the other's event unless the other side has said it is about
+  to sleep, so while both threads are busy queueing and draining writes no
+  event calls are made at all. Both sides spin for a while before sleeping,
+  with the spin length adapting to whether spinning paid off last time.*/
+
+#define ACCEL_FIFO_SIZE 65536
+#define ACCEL_FIFO_MASK (ACCEL_FIFO_SIZE - 1)
+
+/*Indices are read with acquire ordering, so that once the consumer has seen
+  write_idx move it also sees the entry written before it, and once the
+  producer has seen read_idx move the consumer has finished with the slot*/
+#define ACCEL_FIFO_LOAD_IDX(idx) __atomic_load_n(&(idx), __ATOMIC_ACQUIRE)
+
+#define ACCEL_FIFO_ENTRIES(fifo) (ACCEL_FIFO_LOAD_IDX((fifo)->write_idx) - ACCEL_FIFO_LOAD_IDX((fifo)->read_idx))
+#define ACCEL_FIFO_FULL(fifo)    (ACCEL_FIFO_ENTRIES(fifo) >= (ACCEL_FIFO_SIZE - 1))
+#define ACCEL_FIFO_EMPTY(fifo)   (ACCEL_FIFO_LOAD_IDX((fifo)->read_idx) == ACCEL_FIFO_LOAD_IDX((fifo)->write_idx))
+
+/*Entry at the head of the ring, valid when the FIFO is not empty*/
+#define ACCEL_FIFO_HEAD(fifo)    (&(fifo)->entries[(fifo)->read_idx & ACCEL_FIFO_MASK])
+
+#define ACCEL_FIFO_CACHE_LINE 64
+
+typedef struct accel_fifo_entry_t
+{
+        uint32_t addr_type;
+        uint32_t val;
+} accel_fifo_entry_t;
+
+typedef struct accel_fifo_t
+{
+        /*Written by the emulation thread*/
+        volatile int write_idx;
+        volatile int wait_level;        /*Producer is waiting for the FIFO to drain to this many entries, -1 if not waiting*/
+        int woken_seq;                  /*consumer_sleep_seq the producer last woke*/
+        int producer_spin;
+        uint8_t pad0[ACCEL_FIFO_CACHE_LINE - 4*sizeof(int)];
+
+        /*Written by the FIFO thread*/
+        volatile int read_idx;
+        volatile int consumer_sleep_seq; /*Non-zero while the FIFO thread is about to sleep*/
+        int sleep_count;
+        int consumer_spin;
+        uint8_t pad1[ACCEL_FIFO_CACHE_LINE - 4*sizeof(int)];
+
+        thread_t *thread;
+        event_t *wake_event;            /*Wakes the FIFO thread*/
+        event_t *not_full_event;        /*Wakes the emulation thread*/
+
+        accel_fifo_entry_t entries[ACCEL_FIFO_SIZE];
+} accel_fifo_t;
+
+/*Full memory barrier. Each side stores its index or sleep flag and then
+  reads the other side's, which needs store-load ordering*/
+#define accel_fifo_barrier() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+/*Orders accesses to an entry before the index update that hands it over to
+  the other side. Free on x86*/
+#define accel_fifo_release() __atomic_thread_fence(__ATOMIC_RELEASE)
+
+void accel_fifo_init(accel_fifo_t *fifo, void (*thread_rout)(void *param), void *param);
+void accel_fifo_close(accel_fifo_t *fifo);
+
+/*Emulation thread*/
+void accel_fifo_wait_level(accel_fifo_t *fifo, int level);
+void accel_fifo_wake(accel_fifo_t *fifo);
+
+static inline void accel_fifo_wait_idle(accel_fifo_t *fifo)
+{
+        if (!ACCEL_FIFO_EMPTY(fifo))
+                accel_fifo_wait_level(fifo, 0);
+}
+
+/*Add an entry without waking the FIFO thread. The caller is responsible for
+  waking it, eg via a timer if it wants to batch up work*/
+static inline void accel_fifo_push(accel_fifo_t *fifo, uint32_t addr_type, uint32_t val)
+{
+        accel_fifo_entry_t *entry;
+
+        if (ACCEL_FIFO_FULL(fifo))
+                accel_fifo_wait_level(fifo, ACCEL_FIFO_SIZE - 4096);
+
+        entry = &fifo->entries[fifo->write_idx & ACCEL_FIFO_MASK];
+        entry->val = val;
+        entry->addr_type = addr_type;
+        accel_fifo_release();
+        fifo->write_idx++;
+        accel_fifo_barrier();
+}
+
+/*Non-zero if the FIFO thread has gone, or is about to go, to sleep. Only
+  valid after accel_fifo_push()*/
+#define ACCEL_FIFO_SLEEPING(fifo) ((fifo)->consumer_sleep_seq != 0)
+
+static inline void accel_fifo_queue(accel_fifo_t *fifo, uint32_t addr_type, uint32_t val)
+{
+        int sleep_seq;
+
+        accel_fifo_push(fifo, addr_type, val);
+
+        /*Only wake the FIFO thread once for each time it goes to sleep*/
+        sleep_seq = fifo->consumer_sleep_seq;
+        if (sleep_seq && sleep_seq != fifo->woken_seq)
+        {
+                fifo->woken_seq = sleep_seq;
+                thread_set_event(fifo->wake_event);
+        }
+}
+
+/*FIFO thread*/
+void accel_fifo_wait_for_work(accel_fifo_t *fifo);
+
+/*Remove the entry at the head of the ring once it has been processed*/
+static inline void accel_fifo_retire(accel_fifo_t *fifo)
+{
+        accel_fifo_release();
+        fifo->read_idx++;
+        accel_fifo_barrier();
+        if (ACCEL_FIFO_ENTRIES(fifo) <= fifo->wait_level)
+                thread_set_event(fifo->not_full_event);
+}
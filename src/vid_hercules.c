@@ -30,6 +30,8 @@ typedef struct hercules_t
         int vsynctime, vadj;
 
         uint8_t *vram;
+
+        text_line_cache_t *line_cache;
 } hercules_t;
 
 static uint32_t mdacols[256][2][2];
@@ -114,6 +116,20 @@ void hercules_recalctimings(hercules_t *hercules)
 	hercules->dispofftime = (uint64_t)_dispofftime;
 }
 
+/*Returns 1 if the current text line is unchanged since it was last drawn*/
+static int hercules_line_unchanged(hercules_t *hercules, uint16_t ca)
+{
+        uint32_t key[TEXT_LINE_KEY_SIZE];
+        uint16_t cursor_pos = ca - hercules->ma;
+        
+        key[0] = hercules->crtc[1] | (hercules->sc << 8) | (hercules->ctrl << 16) | (hercules->ctrl2 << 24);
+        key[1] = (hercules->con && hercules->cursoron && cursor_pos < hercules->crtc[1]) ? cursor_pos : 0xffff;
+        key[2] = (hercules->ctrl & 0x20) ? (hercules->blink & 16) : 0;
+        key[3] = key[4] = key[5] = 0;
+        
+        return text_line_cache_check(hercules->line_cache, hercules->displine, key, hercules->vram, hercules->ma << 1, 0xfff, hercules->crtc[1] << 1);
+}
+
 void hercules_poll(void *p)
 {
         hercules_t *hercules = (hercules_t *)p;
@@ -148,6 +164,7 @@ void hercules_poll(void *p)
                                 if ((hercules->ctrl & 0x80) && (hercules->ctrl2 & 2)) 
                                         ca += 0x8000;
 //                                printf("Draw herc %04X\n",ca);
+                                text_line_cache_invalidate(hercules->line_cache, hercules->displine);
                                 for (x = 0; x < hercules->crtc[1]; x++)
                                 {
                                         dat = (hercules->vram[((hercules->ma << 1) & 0x1fff) + ca] << 8) | hercules->vram[((hercules->ma << 1) & 0x1fff) + ca + 1];
@@ -156,6 +173,8 @@ void hercules_poll(void *p)
                                                 ((uint32_t *)buffer32->line[hercules->displine])[(x << 4) + c] = (dat & (32768 >> c)) ? cgapal[0x7] : 0;
                                 }
                         }
+                        else if (hercules_line_unchanged(hercules, ca))
+                                hercules->ma += hercules->crtc[1];
                         else
                         {
                                 for (x = 0; x < hercules->crtc[1]; x++)
@@ -171,8 +190,7 @@ void hercules_poll(void *p)
                                         }
                                         else
                                         {
-                                                for (c = 0; c < 8; c++)
-                                                        ((uint32_t *)buffer32->line[hercules->displine])[(x * 9) + c] = mdacols[attr][blink][(fontdatm[chr][hercules->sc] & (1 << (c ^ 7))) ? 1 : 0];
+                                                video_expand_glyph(&((uint32_t *)buffer32->line[hercules->displine])[x * 9], fontdatm[chr][hercules->sc], mdacols[attr][blink][1], mdacols[attr][blink][0]);
                                                 if ((chr & ~0x1f) == 0xc0)
                                                         ((uint32_t *)buffer32->line[hercules->displine])[(x * 9) + 8] = mdacols[attr][blink][fontdatm[chr][hercules->sc] & 1];
                                                 else
@@ -313,6 +331,7 @@ void *hercules_init()
         memset(hercules, 0, sizeof(hercules_t));
 
         hercules->vram = malloc(0x10000);
+        hercules->line_cache = text_line_cache_alloc(500);
 
         timer_add(&hercules->timer, hercules_poll, hercules, 1);
         mem_mapping_add(&hercules->mapping, 0xb0000, 0x08000, hercules_read, NULL, NULL, hercules_write, NULL, NULL,  NULL, MEM_MAPPING_EXTERNAL, hercules);
@@ -347,6 +366,7 @@ void hercules_close(void *p)
 {
         hercules_t *hercules = (hercules_t *)p;
 
+        free(hercules->line_cache);
         free(hercules->vram);
         free(hercules);
 }
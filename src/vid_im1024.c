@@ -522,8 +522,9 @@ static void hndl_rect(pgc_core_t *pgc)
 	{
 		for (p = y0; p <= y1; p++)
 		{
-			pgc_fill_line_r(pgc, x0, x1, p);
+			pgc_fill_span_r(pgc, x0, x1, p);
 		}
+		pgc_fill_flush(pgc);
 	}
 	else	/* Outline: 4 lines */
 	{
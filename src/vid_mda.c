@@ -77,6 +77,23 @@ void mda_recalctimings(mda_t *mda)
 	mda->dispofftime = (uint64_t)_dispofftime;
 }
 
+/*Returns 1 if the current line is unchanged since it was last drawn*/
+static int mda_line_unchanged(mda_t *mda, uint16_t ca)
+{
+        uint32_t key[TEXT_LINE_KEY_SIZE];
+        uint16_t cursor_pos = ca - mda->ma;
+        
+        if (!mda->line_cache)
+                return 0;
+
+        key[0] = mda->crtc[1] | (mda->sc << 8) | (mda->ctrl << 16);
+        key[1] = (mda->con && mda->cursoron && cursor_pos < mda->crtc[1]) ? cursor_pos : 0xffff;
+        key[2] = (mda->ctrl & 0x20) ? (mda->blink & 16) : 0;
+        key[3] = key[4] = key[5] = 0;
+        
+        return text_line_cache_check(mda->line_cache, mda->displine, key, mda->vram, mda->ma << 1, 0xfff, mda->crtc[1] << 1);
+}
+
 void mda_poll(void *p)
 {
         mda_t *mda = (mda_t *)p;
@@ -103,31 +120,35 @@ void mda_poll(void *p)
                                 video_wait_for_buffer();
                         }
                         mda->lastline = mda->displine;
-                        for (x = 0; x < mda->crtc[1]; x++)
+                        if (mda_line_unchanged(mda, ca))
+                                mda->ma += mda->crtc[1];
+                        else
                         {
-                                chr  = mda->vram[(mda->ma << 1) & 0xfff];
-                                attr = mda->vram[((mda->ma << 1) + 1) & 0xfff];
-                                drawcursor = ((mda->ma == ca) && mda->con && mda->cursoron);
-                                blink = ((mda->blink & 16) && (mda->ctrl & 0x20) && (attr & 0x80) && !drawcursor);
-                                if (mda->sc == 12 && ((attr & 7) == 1))
-                                {
-                                        for (c = 0; c < 9; c++)
-                                                ((uint32_t *)buffer32->line[mda->displine])[(x * 9) + c] = mdacols[attr][blink][1];
-                                }
-                                else
+                                for (x = 0; x < mda->crtc[1]; x++)
                                 {
-                                        for (c = 0; c < 8; c++)
-                                                ((uint32_t *)buffer32->line[mda->displine])[(x * 9) + c] = mdacols[attr][blink][(fontdatm[chr][mda->sc] & (1 << (c ^ 7))) ? 1 : 0];
-                                        if ((chr & ~0x1f) == 0xc0)
-                                                ((uint32_t *)buffer32->line[mda->displine])[(x * 9) + 8] = mdacols[attr][blink][fontdatm[chr][mda->sc] & 1];
+                                        chr  = mda->vram[(mda->ma << 1) & 0xfff];
+                                        attr = mda->vram[((mda->ma << 1) + 1) & 0xfff];
+                                        drawcursor = ((mda->ma == ca) && mda->con && mda->cursoron);
+                                        blink = ((mda->blink & 16) && (mda->ctrl & 0x20) && (attr & 0x80) && !drawcursor);
+                                        if (mda->sc == 12 && ((attr & 7) == 1))
+                                        {
+                                                for (c = 0; c < 9; c++)
+                                                        ((uint32_t *)buffer32->line[mda->displine])[(x * 9) + c] = mdacols[attr][blink][1];
+                                        }
                                         else
-                                                ((uint32_t *)buffer32->line[mda->displine])[(x * 9) + 8] = mdacols[attr][blink][0];
-                                }
-                                mda->ma++;
-                                if (drawcursor)
-                                {
-                                        for (c = 0; c < 9; c++)
-                                                ((uint32_t *)buffer32->line[mda->displine])[(x * 9) + c] ^= mdacols[attr][0][1];
+                                        {
+                                                video_expand_glyph(&((uint32_t *)buffer32->line[mda->displine])[x * 9], fontdatm[chr][mda->sc], mdacols[attr][blink][1], mdacols[attr][blink][0]);
+                                                if ((chr & ~0x1f) == 0xc0)
+                                                        ((uint32_t *)buffer32->line[mda->displine])[(x * 9) + 8] = mdacols[attr][blink][fontdatm[chr][mda->sc] & 1];
+                                                else
+                                                        ((uint32_t *)buffer32->line[mda->displine])[(x * 9) + 8] = mdacols[attr][blink][0];
+                                        }
+                                        mda->ma++;
+                                        if (drawcursor)
+                                        {
+                                                for (c = 0; c < 9; c++)
+                                                        ((uint32_t *)buffer32->line[mda->displine])[(x * 9) + c] ^= mdacols[attr][0][1];
+                                        }
                                 }
                         }
                 }
@@ -246,6 +267,7 @@ void *mda_standalone_init()
 	mda_init(mda);
 
         mda->vram = malloc(0x1000);
+        mda->line_cache = text_line_cache_alloc(500);
         mem_mapping_add(&mda->mapping, 0xb0000, 0x08000, mda_read, NULL, NULL, mda_write, NULL, NULL,  NULL, MEM_MAPPING_EXTERNAL, mda);
         io_sethandler(0x03b0, 0x0010, mda_in, NULL, NULL, mda_out, NULL, NULL, mda);
 
@@ -292,6 +314,7 @@ void mda_close(void *p)
 {
         mda_t *mda = (mda_t *)p;
 
+        free(mda->line_cache);
         free(mda->vram);
         free(mda);
 }
@@ -21,6 +21,9 @@ typedef struct mda_t
         int vsynctime, vadj;
 
         uint8_t *vram;
+
+        /*Only allocated by the standalone MDA device*/
+        struct text_line_cache_t *line_cache;
 } mda_t;
 
 void mda_init(mda_t *mda);
@@ -8,20 +8,17 @@
 #include "rom.h"
 #include "thread.h"
 #include "video.h"
+#include "vid_fifo.h"
 #include "vid_mga.h"
 #include "vid_svga.h"
 #include "vid_svga_render.h"
-
-#define FIFO_SIZE 65536
-#define FIFO_MASK (FIFO_SIZE - 1)
-#define FIFO_ENTRY_SIZE (1 << 31)
-#define FIFO_THRESHOLD 0xe000
+#include "vid_trace.h"
 
 #define WAKE_DELAY (100 * TIMER_USEC) /*100us*/
 
-#define FIFO_ENTRIES (mystique->fifo_write_idx - mystique->fifo_read_idx)
-#define FIFO_FULL    ((mystique->fifo_write_idx - mystique->fifo_read_idx) >= (FIFO_SIZE-1))
-#define FIFO_EMPTY   (mystique->fifo_read_idx == mystique->fifo_write_idx)
+#define FIFO_ENTRIES ACCEL_FIFO_ENTRIES(&mystique->fifo)
+#define FIFO_FULL    ACCEL_FIFO_FULL(&mystique->fifo)
+#define FIFO_EMPTY   ACCEL_FIFO_EMPTY(&mystique->fifo)
 
 #define FIFO_TYPE 0xff000000
 #define FIFO_ADDR 0x00ffffff
@@ -31,15 +28,10 @@ enum
         FIFO_INVALID          = (0x00 << 24),
         FIFO_WRITE_CTRL_BYTE  = (0x01 << 24),
         FIFO_WRITE_CTRL_LONG  = (0x02 << 24),
-        FIFO_WRITE_ILOAD_LONG = (0x03 << 24)
+        FIFO_WRITE_ILOAD_LONG = (0x03 << 24),
+        FIFO_TRACE_DMA_ILOAD  = (0x04 << 24)  /*Only used in traces, ILOAD data fetched by secondary DMA*/
 };
 
-typedef struct
-{
-        uint32_t addr_type;
-        uint32_t val;
-} fifo_entry_t;
-
 typedef struct mystique_t
 {
         svga_t svga;
@@ -208,14 +200,11 @@ typedef struct mystique_t
         
         int pixel_count, trap_count;
 
-        fifo_entry_t fifo[FIFO_SIZE];
-        volatile int fifo_read_idx, fifo_write_idx;
-
-        thread_t *fifo_thread;
-        event_t *wake_fifo_thread;
-        event_t *fifo_not_full_event;
+        accel_fifo_t fifo;
         
         pc_timer_t wake_timer;
+
+        vid_trace_t *trace; /*Commands executed by the FIFO thread, NULL if not recording*/
 } mystique_t;
 
 static void mystique_start_blit(mystique_t *mystique);
@@ -1296,7 +1285,7 @@ static uint8_t mystique_ctrl_read_b(uint32_t addr, void *p)
         switch (addr & 0x3fff)
         {
                 case REG_FIFOSTATUS:
-                fifocount = FIFO_SIZE - FIFO_ENTRIES;
+                fifocount = ACCEL_FIFO_SIZE - FIFO_ENTRIES;
                 if (fifocount > 64)
                         fifocount = 64;
                 ret = fifocount;
@@ -2395,6 +2384,8 @@ static void run_dma(mystique_t *mystique)
                                         if ((reg_addr & 0x300) == 0x100)
                                                 mystique->blitter_submit_dma_refcount++;
 
+                                        if (mystique->trace)
+                                                vid_trace_record(mystique->trace, reg_addr | FIFO_WRITE_CTRL_LONG, val);
                                         mystique_accel_ctrl_write_l(reg_addr, val, mystique);
                                 }
 
@@ -2445,6 +2436,8 @@ static void run_dma(mystique_t *mystique)
                                         if ((reg_addr & 0x300) == 0x100)
                                                 mystique->blitter_submit_dma_refcount++;
 
+                                        if (mystique->trace)
+                                                vid_trace_record(mystique->trace, reg_addr | FIFO_WRITE_CTRL_LONG, val);
                                         mystique_accel_ctrl_write_l(reg_addr, val, mystique);
                                 }
 
@@ -2476,7 +2469,11 @@ static void run_dma(mystique_t *mystique)
                                         mystique->dma.secaddress += 4;
 
                                         if (mystique->busy)
+                                        {
+                                                if (mystique->trace)
+                                                        vid_trace_record(mystique->trace, FIFO_TRACE_DMA_ILOAD, val);
                                                 blit_iload_write(mystique, val, 32);
+                                        }
 
                                         words_transferred++;
                                         if ((mystique->dma.secaddress & DMA_ADDR_MASK) == (mystique->dma.secend & DMA_ADDR_MASK))
@@ -2512,9 +2509,7 @@ static void fifo_thread(void *p)
         
         while (1)
         {
-                thread_set_event(mystique->fifo_not_full_event);
-                thread_wait_event(mystique->wake_fifo_thread, -1);
-                thread_reset_event(mystique->wake_fifo_thread);
+                accel_fifo_wait_for_work(&mystique->fifo);
 
                 while (!FIFO_EMPTY || mystique->dma.state != DMA_STATE_IDLE)
                 {
@@ -2522,8 +2517,11 @@ static void fifo_thread(void *p)
 
                         while (!FIFO_EMPTY && words_transferred < 100)
                         {
-                                fifo_entry_t *fifo = &mystique->fifo[mystique->fifo_read_idx & FIFO_MASK];
+                                accel_fifo_entry_t *fifo = ACCEL_FIFO_HEAD(&mystique->fifo);
                                 
+                                if (mystique->trace)
+                                        vid_trace_record(mystique->trace, fifo->addr_type, fifo->val);
+
                                 switch (fifo->addr_type & FIFO_TYPE)
                                 {
                                         case FIFO_WRITE_CTRL_BYTE:
@@ -2538,10 +2536,7 @@ static void fifo_thread(void *p)
                                 }
 
                                 fifo->addr_type = FIFO_INVALID;
-                                mystique->fifo_read_idx++;
-
-                                if (FIFO_ENTRIES > FIFO_THRESHOLD)
-                                        thread_set_event(mystique->fifo_not_full_event);
+                                accel_fifo_retire(&mystique->fifo);
 
                                 words_transferred++;
                         }
@@ -2566,25 +2561,16 @@ static void wake_fifo_thread(mystique_t *mystique)
         }
 }
 
-static void wake_fifo_thread_now(mystique_t *mystique)
-{
-        thread_set_event(mystique->wake_fifo_thread);
-}
-
 static void mystique_wake_timer(void *p)
 {
         mystique_t *mystique = (mystique_t *)p;
 
-        thread_set_event(mystique->wake_fifo_thread); /*Wake up FIFO thread if moving from idle*/
+        accel_fifo_wake(&mystique->fifo); /*Wake up FIFO thread if moving from idle*/
 }
 
 static void wait_fifo_idle(mystique_t *mystique)
 {
-        while (!FIFO_EMPTY)
-        {
-                wake_fifo_thread_now(mystique);
-                thread_wait_event(mystique->fifo_not_full_event, 1);
-        }
+        accel_fifo_wait_idle(&mystique->fifo);
 }
 
 /*IRQ code (PCI & PIC) is not currently thread safe. SOFTRAP IRQ requests must
@@ -2616,23 +2602,10 @@ static void mystique_softrap_pending_timer(void *p)
 
 static void mystique_queue(mystique_t *mystique, uint32_t addr, uint32_t val, uint32_t type)
 {
-        fifo_entry_t *fifo = &mystique->fifo[mystique->fifo_write_idx & FIFO_MASK];
+        accel_fifo_push(&mystique->fifo, (addr & FIFO_ADDR) | type, val);
 
-        if (FIFO_FULL)
-        {
-                thread_reset_event(mystique->fifo_not_full_event);
-                if (FIFO_FULL)
-                {
-                        thread_wait_event(mystique->fifo_not_full_event, -1); /*Wait for room in ringbuffer*/
-                }
-        }
-
-        fifo->val = val;
-        fifo->addr_type = (addr & FIFO_ADDR) | type;
-
-        mystique->fifo_write_idx++;
-
-        if (FIFO_ENTRIES > FIFO_THRESHOLD || FIFO_ENTRIES < 8)
+        /*A busy FIFO thread will find the new entry itself*/
+        if (ACCEL_FIFO_SLEEPING(&mystique->fifo))
                 wake_fifo_thread(mystique);
 
 //        wait_fifo_idle(mystique);
@@ -5263,6 +5236,12 @@ void *mystique_init()
         rom_init(&mystique->bios_rom, "MYSTIQUE.VBI", 0xc0000, 0x8000, 0x7fff, 0, MEM_MAPPING_EXTERNAL);
 
         mystique->vram_size = device_get_config_int("memory");
+        if (device_get_config_int("trace"))
+        {
+                uint32_t config[1] = {mystique->vram_size};
+
+                mystique->trace = vid_trace_open("mystique.trc", VID_TRACE_MYSTIQUE, config, 1);
+        }
         mystique->vram_mask = (mystique->vram_size << 20) - 1;
         mystique->vram_mask_w = mystique->vram_mask >> 1;
         mystique->vram_mask_l = mystique->vram_mask >> 2;
@@ -5326,9 +5305,7 @@ void *mystique_init()
                         dither6[c][0][1] = 63;
         }
 
-        mystique->wake_fifo_thread = thread_create_event();
-        mystique->fifo_not_full_event = thread_create_event();
-        mystique->fifo_thread = thread_create(fifo_thread, mystique);
+        accel_fifo_init(&mystique->fifo, fifo_thread, mystique);
         mystique->dma.lock = thread_create_mutex();
 
         timer_add(&mystique->wake_timer, mystique_wake_timer, (void *)mystique, 0);
@@ -5350,11 +5327,12 @@ static void mystique_close(void *p)
 {
         mystique_t *mystique = (mystique_t *)p;
 
-        thread_kill(mystique->fifo_thread);
-        thread_destroy_event(mystique->wake_fifo_thread);
-        thread_destroy_event(mystique->fifo_not_full_event);
+        accel_fifo_close(&mystique->fifo);
         thread_destroy_mutex(mystique->dma.lock);
 
+        if (mystique->trace)
+                vid_trace_close(mystique->trace);
+
         svga_close(&mystique->svga);
 
         free(mystique);
@@ -5420,6 +5398,12 @@ static device_config_t mystique_config[] =
                 },
                 .default_int = 4
         },
+        {
+                .name = "trace",
+                .description = "Record command trace to logs directory",
+                .type = CONFIG_BINARY,
+                .default_int = 0
+        },
         {
                 .type = -1
         }
@@ -505,22 +505,187 @@ uint16_t pgc_draw_line_r(pgc_core_t *pgc, int32_t x0, int32_t y0, int32_t x1, in
 	return linemask;
 }
 
+/* Draw part of a row that is known to lie within the viewport. pattern has
+ * the bit for the first pixel in bit 15 */
+static void pgc_fill_row(pgc_core_t *pgc, uint8_t *row, int32_t x0, int32_t x1,
+		uint16_t pattern)
+{
+	int32_t x;
+
+	if (pattern == 0xFFFF && (pgc->draw_mode == 0 || pgc->draw_mode > 3))
+	{
+		memset(row + x0, pgc->colour, x1 - x0 + 1);
+		return;
+	}
+	for (x = x0; x <= x1; x++)
+	{
+		if (pattern & 0x8000)
+		{
+			switch (pgc->draw_mode)
+			{
+				default:
+				case 0: row[x] = pgc->colour; break;
+				case 1: row[x] ^= 0xFF; break;
+				case 2: row[x] ^= pgc->colour; break;
+				case 3: row[x] &= pgc->colour; break;
+			}
+		}
+		pattern = (pattern << 1) | (pattern >> 15);
+	}
+}
+
 /* Draw a horizontal line in the current fill pattern 
- * (using raster coordinates) */
+ * (using raster coordinates) 
+ *
+ * This has the same effect as calling pgc_plot() for each pixel set in the
+ * pattern, but clips the whole line against the viewport at once. */
 void pgc_fill_line_r(pgc_core_t *pgc, int32_t x0, int32_t x1, int32_t y0)
 {
-	int32_t x;
-	int32_t mask = 0x8000 >> (x0 & 0x0F);
+	uint16_t pattern = pgc->fill_pattern[y0 & 0x0F];
+	uint16_t y = y0;	/* pgc_plot() takes 16-bit coordinates */
+	int32_t clip_x1 = pgc->vp_x1;
+	int32_t clip_x2 = MIN(pgc->vp_x2, (int32_t)pgc->maxw - 1);
+	int32_t bit = x0 & 0x0F;
+	int64_t base, start, end;
+	uint8_t *row;
+
+	/* The pattern is aligned to the first point passed in, even if the 
+	 * line is drawn from right to left */
+	if (x0 > x1) { start = x1; x1 = x0; x0 = start; }
+	bit -= x0;
+
+	if (y < pgc->vp_y1 || y > pgc->vp_y2 || y >= pgc->maxh ||
+	    clip_x1 > clip_x2)
+		return;
+	row = pgc->vram + (pgc->maxh - 1 - y) * pgc->maxw;
 
-	if (x0 > x1) { x = x1; x1 = x0; x0 = x; }
+	/* x wraps at 16 bits too, so very long lines can cross the viewport 
+	 * more than once */
+	for (base = (int64_t)x0 & ~0xFFFF; base <= x1; base += 0x10000)
+	{
+		start = MAX(x0, base + clip_x1);
+		end   = MIN(x1, base + clip_x2);
+		if (start <= end)
+		{
+			int rot = (bit + start) & 0x0F;
 
-	for (x = x0; x <= x1; x++)
+			pgc_fill_row(pgc, row, start - base, end - base,
+				(pattern << rot) | (pattern >> ((16 - rot) & 0x0F)));
+		}
+	}
+}
+
+/* Draw the queued spans that fall in rows y1 to y2, in the order they were 
+ * queued */
+static void pgc_fill_band(pgc_core_t *pgc, uint16_t y1, uint16_t y2)
+{
+	int n;
+
+	for (n = 0; n < pgc->nr_spans; n++)
 	{
-		if (pgc->fill_pattern[y0 & 0x0F] & mask)
-			pgc_plot(pgc, x, y0);
-		mask = mask >> 1;
-		if (mask == 0) mask = 0x8000; 
-	} 
+		pgc_span_t *span = &pgc->spans[n];
+		uint16_t y = span->y;
+
+		if (y >= y1 && y <= y2)
+			pgc_fill_line_r(pgc, span->x0, span->x1, span->y);
+	}
+}
+
+static void pgc_band_thread(void *p)
+{
+	pgc_band_t *band = (pgc_band_t *)p;
+
+	while (1)
+	{
+		thread_wait_event(band->wake, -1);
+		thread_reset_event(band->wake);
+
+		pgc_fill_band(band->pgc, band->y1, band->y2);
+
+		thread_set_event(band->done);
+	}
+}
+
+/* Queue a horizontal line in the current fill pattern (using raster 
+ * coordinates) */
+void pgc_fill_span_r(pgc_core_t *pgc, int32_t x0, int32_t x1, int32_t y0)
+{
+	pgc_span_t *span;
+
+	if (pgc->nr_spans == pgc->max_spans)
+	{
+		int max_spans = pgc->max_spans ? (pgc->max_spans * 2) : 1024;
+		pgc_span_t *spans = realloc(pgc->spans, max_spans * sizeof(pgc_span_t));
+
+		if (!spans)
+		{
+			/* Draw what we have, then carry on one span at a time */
+			pgc_fill_flush(pgc);
+			pgc_fill_line_r(pgc, x0, x1, y0);
+			return;
+		}
+		pgc->spans = spans;
+		pgc->max_spans = max_spans;
+	}
+	span = &pgc->spans[pgc->nr_spans++];
+	span->x0 = x0;
+	span->x1 = x1;
+	span->y = y0;
+	pgc->span_pixels += MIN(abs(x1 - x0), pgc->maxw) + 1;
+}
+
+/* Fills smaller than this aren't worth waking the band threads for */
+#define PGC_FILL_PARALLEL_MIN 16384
+
+/* Draw all queued spans. Each band draws only its own rows, keeping the 
+ * order spans were queued in, so the result is the same as drawing them
+ * one at a time whatever the draw mode */
+void pgc_fill_flush(pgc_core_t *pgc)
+{
+	uint16_t y1 = 0xFFFF, y2 = 0;
+	int rows, n;
+
+	if (!pgc->nr_spans)
+		return;
+
+	if (pgc->span_pixels < PGC_FILL_PARALLEL_MIN)
+	{
+		pgc_fill_band(pgc, 0, 0xFFFF);
+		pgc->nr_spans = pgc->span_pixels = 0;
+		return;
+	}
+
+	for (n = 0; n < pgc->nr_spans; n++)
+	{
+		uint16_t y = pgc->spans[n].y;
+
+		if (y < pgc->maxh)
+		{
+			if (y < y1) y1 = y;
+			if (y > y2) y2 = y;
+		}
+	}
+	if (y1 > y2)	/* Nothing on screen */
+	{
+		pgc->nr_spans = pgc->span_pixels = 0;
+		return;
+	}
+
+	rows = (y2 - y1 + PGC_FILL_BANDS) / PGC_FILL_BANDS;
+	for (n = 0; n < PGC_FILL_BANDS - 1; n++)
+	{
+		pgc_band_t *band = &pgc->bands[n];
+
+		band->y1 = y1 + (n + 1) * rows;
+		band->y2 = MIN(y1 + (n + 2) * rows - 1, y2);
+		thread_reset_event(band->done);
+		thread_set_event(band->wake);
+	}
+	pgc_fill_band(pgc, y1, MIN(y1 + rows - 1, y2));
+	for (n = 0; n < PGC_FILL_BANDS - 1; n++)
+		thread_wait_event(pgc->bands[n].done, -1);
+
+	pgc->nr_spans = pgc->span_pixels = 0;
 }
 
 /* For sorting polygon nodes */
@@ -598,9 +763,10 @@ void pgc_fill_polygon(pgc_core_t *pgc,
 			pgc_sto_raster(pgc, &x2, &y2);
 /*			PGCLOG(("pgc_fill_polygon raster %d,%d to %d,%d\n", 
 				x1, y1, x2, y2)); */
-			pgc_fill_line_r(pgc, x1, x2, y1);
+			pgc_fill_span_r(pgc, x1, x2, y1);
 		}
 	}
+	pgc_fill_flush(pgc);
 	free(nodex); 
 	free(dx);
 	free(dy);
@@ -624,14 +790,29 @@ void pgc_draw_ellipse(pgc_core_t *pgc, int32_t x, int32_t y)
 	pgc_dto_raster(pgc, &x0, &y0);
 	PGCLOG(("Ellipse: Colour=%d Drawmode=%d fill=%d\n", pgc->colour, 
 		pgc->draw_mode, pgc->fill_mode));
-	for (ypos = 0; ypos <= h; ypos++)
+	/* Fill the interior first, so it can be drawn as one batch of spans,
+	 * then draw the border over it */
+	if (pgc->fill_mode)
 	{
-		if (ypos == 0)
+		for (ypos = 0; ypos <= h; ypos++)
 		{
-			if (pgc->fill_mode)
+			if (ypos == 0)
+			{
+				pgc_fill_span_r(pgc, x0 - w, x0 + w, y0);
+			}
+			else
 			{
-				pgc_fill_line_r(pgc, x0 - w, x0 + w, y0);
+				x1 = sqrt((h * h) - (ypos * ypos)) * w / h;
+				pgc_fill_span_r(pgc, x0 - x1, x0 + x1, y0 + ypos);
+				pgc_fill_span_r(pgc, x0 - x1, x0 + x1, y0 - ypos);
 			}
+		}
+		pgc_fill_flush(pgc);
+	}
+	for (ypos = 0; ypos <= h; ypos++)
+	{
+		if (ypos == 0)
+		{
 			if (linemask & 0x8000)
 			{
 				pgc_plot(pgc, x0 + w, y0);
@@ -648,12 +829,6 @@ void pgc_draw_ellipse(pgc_core_t *pgc, int32_t x, int32_t y)
 		{
 			x1 = sqrt((h * h) - (ypos * ypos)) * w / h;
 
-			if (pgc->fill_mode)
-			{
-				pgc_fill_line_r(pgc, x0 - x1, x0 + x1, y0 + ypos);
-				pgc_fill_line_r(pgc, x0 - x1, x0 + x1, y0 - ypos);
-			}
-
 			/* Draw border */
 			for (xpos = xlast; xpos >= x1; xpos--)
 			{
@@ -2410,6 +2585,16 @@ void pgc_core_init(pgc_core_t *pgc, int maxw, int maxh, int visw, int vish,
 	pgc->pgc_commands = pgc_core_commands;
 	pgc->pgc_wake_thread = thread_create_event();
 	pgc->pgc_thread = thread_create(pgc_core_thread, pgc);
+	/* Threads that help the drawing thread with large fills */
+	for (n = 0; n < PGC_FILL_BANDS - 1; n++)
+	{
+		pgc_band_t *band = &pgc->bands[n];
+
+		band->pgc = pgc;
+		band->wake = thread_create_event();
+		band->done = thread_create_event();
+		band->thread = thread_create(pgc_band_thread, band);
+	}
 
         timer_add(&pgc->timer, pgc_poll, (void *)pgc, 1);
 
@@ -2432,9 +2617,20 @@ void *pgc_standalone_init()
 void pgc_close(void *p)
 {
         pgc_core_t *pgc = (pgc_core_t *)p;
+	int n;
         
         thread_kill(pgc->pgc_thread);
         thread_destroy_event(pgc->pgc_wake_thread);
+	for (n = 0; n < PGC_FILL_BANDS - 1; n++)
+	{
+		thread_kill(pgc->bands[n].thread);
+		thread_destroy_event(pgc->bands[n].wake);
+		thread_destroy_event(pgc->bands[n].done);
+	}
+	if (pgc->spans)
+	{
+		free(pgc->spans);
+	}
 
 	if (pgc->cga_vram)
 	{
@@ -25,6 +25,24 @@ typedef struct pgc_command_t
 } pgc_command_t;
 
 
+/* Large fills are queued as spans and then drawn in this many horizontal
+ * bands in parallel */
+#define PGC_FILL_BANDS 4
+
+typedef struct pgc_span_t
+{
+	int32_t x0, x1, y;	/* Raster coordinates, as passed to pgc_fill_span_r() */
+} pgc_span_t;
+
+typedef struct pgc_band_t
+{
+	struct pgc_core_t *pgc;
+	uint16_t y1, y2;	/* Rows drawn by this band */
+	thread_t *thread;
+	event_t  *wake;
+	event_t  *done;
+} pgc_band_t;
+
 typedef struct pgc_core_t
 {
         mem_mapping_t mapping;
@@ -88,6 +106,10 @@ typedef struct pgc_core_t
         
 	int (*inputbyte)(struct pgc_core_t *pgc, uint8_t *result); 
 
+	pgc_span_t *spans;	/* Fill spans queued by the current command */
+	int	nr_spans, max_spans;
+	int	span_pixels;
+	pgc_band_t bands[PGC_FILL_BANDS - 1]; /* Band 0 is drawn by pgc_thread */
 } pgc_core_t;
 
 void    pgc_init(pgc_core_t *pgc);
@@ -112,6 +134,10 @@ void    pgc_draw_ellipse(pgc_core_t *pgc, int32_t x, int32_t y);
 void	pgc_fill_polygon(pgc_core_t *pgc, unsigned corners, int32_t *x, int32_t *y);
 /* Horizontal line in fill pattern (raster coordinates) */
 void    pgc_fill_line_r(pgc_core_t *pgc, int32_t x0, int32_t x1, int32_t y);
+/* As pgc_fill_line_r(), but queued until pgc_fill_flush(). Nothing else
+ * may draw while spans are queued */
+void    pgc_fill_span_r(pgc_core_t *pgc, int32_t x0, int32_t x1, int32_t y);
+void    pgc_fill_flush(pgc_core_t *pgc);
 
 /* Convert to raster coordinates */
 void	pgc_sto_raster(pgc_core_t *pgc, int16_t *x, int16_t *y);
@@ -8,6 +8,8 @@
 #include "rom.h"
 #include "thread.h"
 #include "video.h"
+#include "vid_fifo.h"
+#include "vid_blit.h"
 #include "vid_s3.h"
 #include "vid_svga.h"
 #include "vid_svga_render.h"
@@ -29,13 +31,9 @@ enum
         VRAM_512KB = 7
 };
 
-#define FIFO_SIZE 65536
-#define FIFO_MASK (FIFO_SIZE - 1)
-#define FIFO_ENTRY_SIZE (1 << 31)
-
-#define FIFO_ENTRIES (s3->fifo_write_idx - s3->fifo_read_idx)
-#define FIFO_FULL    ((s3->fifo_write_idx - s3->fifo_read_idx) >= FIFO_SIZE)
-#define FIFO_EMPTY   (s3->fifo_read_idx == s3->fifo_write_idx)
+#define FIFO_ENTRIES ACCEL_FIFO_ENTRIES(&s3->fifo)
+#define FIFO_FULL    ACCEL_FIFO_FULL(&s3->fifo)
+#define FIFO_EMPTY   ACCEL_FIFO_EMPTY(&s3->fifo)
 
 #define FIFO_TYPE 0xff000000
 #define FIFO_ADDR 0x00ffffff
@@ -51,12 +49,6 @@ enum
         FIFO_OUT_DWORD   = (0x06 << 24)
 };
 
-typedef struct
-{
-        uint32_t addr_type;
-        uint32_t val;
-} fifo_entry_t;
-
 typedef struct s3_t
 {
         mem_mapping_t linear_mapping;
@@ -131,12 +123,7 @@ typedef struct s3_t
                 int dat_count;
         } accel;
 
-        fifo_entry_t fifo[FIFO_SIZE];
-        volatile int fifo_read_idx, fifo_write_idx;
-
-        thread_t *fifo_thread;
-        event_t *wake_fifo_thread;
-        event_t *fifo_not_full_event;
+        accel_fifo_t fifo;
         
         int blitter_busy;
         uint64_t blitter_time;
@@ -165,16 +152,12 @@ uint8_t s3_accel_read(uint32_t addr, void *p);
 
 static inline void wake_fifo_thread(s3_t *s3)
 {
-        thread_set_event(s3->wake_fifo_thread); /*Wake up FIFO thread if moving from idle*/
+        accel_fifo_wake(&s3->fifo);
 }
 
 static void s3_wait_fifo_idle(s3_t *s3)
 {
-        while (!FIFO_EMPTY)
-        {
-                wake_fifo_thread(s3);
-                thread_wait_event(s3->fifo_not_full_event, 1);
-        }
+        accel_fifo_wait_idle(&s3->fifo);
 }
 
 static void s3_update_irqs(s3_t *s3)
@@ -870,15 +853,13 @@ static void fifo_thread(void *param)
         
         while (1)
         {
-                thread_set_event(s3->fifo_not_full_event);
-                thread_wait_event(s3->wake_fifo_thread, -1);
-                thread_reset_event(s3->wake_fifo_thread);
+                accel_fifo_wait_for_work(&s3->fifo);
                 s3->blitter_busy = 1;
                 while (!FIFO_EMPTY)
                 {
                         uint64_t start_time = timer_read();
                         uint64_t end_time;
-                        fifo_entry_t *fifo = &s3->fifo[s3->fifo_read_idx & FIFO_MASK];
+                        accel_fifo_entry_t *fifo = ACCEL_FIFO_HEAD(&s3->fifo);
 
                         switch (fifo->addr_type & FIFO_TYPE)
                         {
@@ -902,11 +883,8 @@ static void fifo_thread(void *param)
                                 break;
                         }
                                                 
-                        s3->fifo_read_idx++;
                         fifo->addr_type = FIFO_INVALID;
-
-                        if (FIFO_ENTRIES > 0xe000)
-                                thread_set_event(s3->fifo_not_full_event);
+                        accel_fifo_retire(&s3->fifo);
 
                         end_time = timer_read();
                         s3->blitter_time += end_time - start_time;
@@ -927,24 +905,7 @@ static void s3_vblank_start(svga_t *svga)
 
 static void s3_queue(s3_t *s3, uint32_t addr, uint32_t val, uint32_t type)
 {
-        fifo_entry_t *fifo = &s3->fifo[s3->fifo_write_idx & FIFO_MASK];
-
-        if (FIFO_FULL)
-        {
-                thread_reset_event(s3->fifo_not_full_event);
-                if (FIFO_FULL)
-                {
-                        thread_wait_event(s3->fifo_not_full_event, -1); /*Wait for room in ringbuffer*/
-                }
-        }
-
-        fifo->val = val;
-        fifo->addr_type = (addr & FIFO_ADDR) | type;
-
-        s3->fifo_write_idx++;
-        
-        if (FIFO_ENTRIES > 0xe000 || FIFO_ENTRIES < 8)
-                wake_fifo_thread(s3);
+        accel_fifo_queue(&s3->fifo, (addr & FIFO_ADDR) | type, val);
 }
 
 void s3_out(uint16_t addr, uint8_t val, void *p)
@@ -1713,11 +1674,125 @@ static void polygon_setup(s3_t *s3)
                                 svga->changedvram[((addr) & (s3->vram_mask >> 2)) >> 10] = changeframecount;            \
                         }
 
+/*S3 mix functions as common blit core raster operations*/
+static const uint8_t s3_mix_rop[16] =
+{
+        BLIT_ROP_ND,   BLIT_ROP_0,    BLIT_ROP_1,    BLIT_ROP_D,
+        BLIT_ROP_NS,   BLIT_ROP_XOR,  BLIT_ROP_XNOR, BLIT_ROP_S,
+        BLIT_ROP_NAND, BLIT_ROP_NSOD, BLIT_ROP_SOND, BLIT_ROP_OR,
+        BLIT_ROP_AND,  BLIT_ROP_SAND, BLIT_ROP_NSAD, BLIT_ROP_NOR
+};
+
+static inline int s3_accel_shift(s3_t *s3)
+{
+        if (s3->bpp == 0)
+                return 0;
+        if (s3->bpp == 1)
+                return 1;
+        return 2;
+}
+
+static inline int s3_wrt_mask_full(s3_t *s3)
+{
+        if (s3->bpp == 0)
+                return (s3->accel.wrt_mask & 0xff) == 0xff;
+        if (s3->bpp == 1)
+                return (s3->accel.wrt_mask & 0xffff) == 0xffff;
+        return s3->accel.wrt_mask == 0xffffffff;
+}
+
+/*Rectangle fills and screen to screen BitBlts started without CPU data reduce
+  to a single clipped rectangle for the common blit core, provided the write
+  mask is complete and the rectangle doesn't wrap around the 12-bit clip
+  coordinate space. BitBlts with a colour compare use the core's transparent
+  copy. These return 0 if the per-pixel path must be used, and otherwise
+  leave the accelerator state as it would be at the end of the operation*/
+static int s3_accel_fast_fill(s3_t *s3, uint32_t src_dat, int write, uint32_t dstbase, int clip_l, int clip_r, int clip_t, int clip_b)
+{
+        svga_t *svga = &s3->svga;
+        int shift = s3_accel_shift(s3);
+        int sx = s3->accel.sx, sy = s3->accel.sy;
+        int x_l = (s3->accel.cmd & 0x20) ? s3->accel.cx : s3->accel.cx - sx;
+        int y_t = (s3->accel.cmd & 0x80) ? s3->accel.cy : s3->accel.cy - sy;
+        int x_r = x_l + sx, y_b = y_t + sy;
+
+        if (!s3_wrt_mask_full(s3))
+                return 0;
+        if (x_l < 0 || x_r > 0xfff || y_t < 0 || y_b > 0xfff)
+                return 0;
+
+        x_l = MAX(x_l, clip_l);
+        x_r = MIN(x_r, clip_r);
+        y_t = MAX(y_t, clip_t);
+        y_b = MIN(y_b, clip_b);
+        if (write && x_l <= x_r && y_t <= y_b)
+        {
+                if (!blit_fill(svga->vram, s3->vram_mask, svga->changedvram,
+                               (dstbase + y_t * s3->width + x_l) << shift, s3->width << shift,
+                               (x_r - x_l + 1) << shift, y_b - y_t + 1,
+                               src_dat, 1 << shift, s3_mix_rop[s3->accel.frgd_mix & 0xf]))
+                        return 0;
+        }
+
+        if (s3->accel.cmd & 0x80) s3->accel.cy += sy + 1;
+        else                      s3->accel.cy -= sy + 1;
+        s3->accel.dest = dstbase + s3->accel.cy * s3->width;
+        s3->accel.sy = -1;
+        s3->accel.cur_x = s3->accel.cx;
+        s3->accel.cur_y = s3->accel.cy;
+        return 1;
+}
+
+static int s3_accel_fast_copy(s3_t *s3, uint32_t srcbase, uint32_t dstbase, int clip_l, int clip_r, int clip_t, int clip_b, int compare_mode, uint32_t compare)
+{
+        svga_t *svga = &s3->svga;
+        int shift = s3_accel_shift(s3);
+        int sx = s3->accel.sx, sy = s3->accel.sy;
+        int x_l = s3->accel.dx, y_t = s3->accel.dy;
+        int x_r = x_l + sx, y_b = y_t + sy;
+
+        if (!s3_wrt_mask_full(s3))
+                return 0;
+        if (x_l < 0 || x_r > 0xfff || y_t < 0 || y_b > 0xfff)
+                return 0;
+
+        x_l = MAX(x_l, clip_l);
+        x_r = MIN(x_r, clip_r);
+        y_t = MAX(y_t, clip_t);
+        y_b = MIN(y_b, clip_b);
+        if (x_l <= x_r && y_t <= y_b)
+        {
+                uint32_t src = srcbase + (s3->accel.cy + y_t - s3->accel.dy) * s3->width + s3->accel.cx + x_l - s3->accel.dx;
+                uint32_t dst = dstbase + y_t * s3->width + x_l;
+                int done;
+
+                if (compare_mode >= 2)
+                        done = blit_copy_trans(svga->vram, s3->vram_mask, svga->changedvram,
+                                               dst << shift, src << shift, s3->width << shift, s3->width << shift,
+                                               (x_r - x_l + 1) << shift, y_b - y_t + 1, 0, BLIT_ROP_S,
+                                               1 << shift, compare, 0xffffffff, (compare_mode == 3) ? BLIT_TRANS_MATCH : 0);
+                else
+                        done = blit_copy(svga->vram, s3->vram_mask, svga->changedvram,
+                                         dst << shift, src << shift, s3->width << shift, s3->width << shift,
+                                         (x_r - x_l + 1) << shift, y_b - y_t + 1, 0, BLIT_ROP_S);
+                if (!done)
+                        return 0;
+        }
+
+        s3->accel.cy += sy + 1;
+        s3->accel.dy += sy + 1;
+        s3->accel.src  = srcbase + s3->accel.cy * s3->width;
+        s3->accel.dest = dstbase + s3->accel.dy * s3->width;
+        s3->accel.sy = -1;
+        return 1;
+}
+
 void s3_accel_start(int count, int cpu_input, uint32_t mix_dat, uint32_t cpu_dat, s3_t *s3)
 {
         svga_t *svga = &s3->svga;
         uint32_t src_dat, dest_dat;
         int frgd_mix, bkgd_mix;
+        int plain_copy;
         int clip_t = s3->accel.multifunc[1] & 0xfff;
         int clip_l = s3->accel.multifunc[2] & 0xfff;
         int clip_b = s3->accel.multifunc[3] & 0xfff;
@@ -1961,6 +2036,22 @@ void s3_accel_start(int count, int cpu_input, uint32_t mix_dat, uint32_t cpu_dat
 
                 frgd_mix = (s3->accel.frgd_mix >> 5) & 3;
                 bkgd_mix = (s3->accel.bkgd_mix >> 5) & 3;
+
+                if (!cpu_input && cmd == 2)
+                {
+                        switch (frgd_mix)
+                        {
+                                case 0: src_dat = s3->accel.bkgd_color; break;
+                                case 1: src_dat = s3->accel.frgd_color; break;
+                                case 2: src_dat = cpu_dat; break;
+                                case 3: src_dat = 0; break;
+                        }
+                        if (s3_accel_fast_fill(s3, src_dat, (compare_mode == 2 && src_dat != compare) ||
+                                                            (compare_mode == 3 && src_dat == compare) ||
+                                                             compare_mode < 2,
+                                               dstbase, clip_l, clip_r, clip_t, clip_b))
+                                return;
+                }
                 
                 while (count-- && s3->accel.sy >= 0)
                 {
@@ -2056,8 +2147,12 @@ void s3_accel_start(int count, int cpu_input, uint32_t mix_dat, uint32_t cpu_dat
                 frgd_mix = (s3->accel.frgd_mix >> 5) & 3;
                 bkgd_mix = (s3->accel.bkgd_mix >> 5) & 3;
                 
-                if (!cpu_input && frgd_mix == 3 && !vram_mask && !compare_mode &&
-                    (s3->accel.cmd & 0xa0) == 0xa0 && (s3->accel.frgd_mix & 0xf) == 7) 
+                plain_copy = !cpu_input && frgd_mix == 3 && !vram_mask &&
+                             (s3->accel.cmd & 0xa0) == 0xa0 && (s3->accel.frgd_mix & 0xf) == 7;
+                if (plain_copy && s3_accel_fast_copy(s3, srcbase, dstbase, clip_l, clip_r, clip_t, clip_b, compare_mode, compare))
+                        return;
+
+                if (plain_copy && compare_mode < 2)
                 {
                         while (1)
                         {
@@ -2785,9 +2880,7 @@ static void *s3_init(char *bios_fn, int chip)
         
         s3->chip = chip;
 
-        s3->wake_fifo_thread = thread_create_event();
-        s3->fifo_not_full_event = thread_create_event();
-        s3->fifo_thread = thread_create(fifo_thread, s3);
+        accel_fifo_init(&s3->fifo, fifo_thread, s3);
         
         s3->int_line = 0;
  
@@ -2880,9 +2973,7 @@ void s3_close(void *p)
 
         svga_close(&s3->svga);
         
-        thread_kill(s3->fifo_thread);
-        thread_destroy_event(s3->wake_fifo_thread);
-        thread_destroy_event(s3->fifo_not_full_event);
+        accel_fifo_close(&s3->fifo);
 
         free(s3);
 }
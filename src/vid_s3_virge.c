@@ -9,9 +9,11 @@
 #include "thread.h"
 #include "video.h"
 #include "vid_ddc.h"
+#include "vid_fifo.h"
 #include "vid_s3_virge.h"
 #include "vid_svga.h"
 #include "vid_svga_render.h"
+#include "vid_trace.h"
 
 #ifdef MIN
 #undef MIN
@@ -42,13 +44,9 @@ static int dither[4][4] =
 #define RB_FULL (RB_ENTRIES == RB_SIZE)
 #define RB_EMPTY (!RB_ENTRIES)
 
-#define FIFO_SIZE 65536
-#define FIFO_MASK (FIFO_SIZE - 1)
-#define FIFO_ENTRY_SIZE (1 << 31)
-
-#define FIFO_ENTRIES (virge->fifo_write_idx - virge->fifo_read_idx)
-#define FIFO_FULL    ((virge->fifo_write_idx - virge->fifo_read_idx) >= FIFO_SIZE)
-#define FIFO_EMPTY   (virge->fifo_read_idx == virge->fifo_write_idx)
+#define FIFO_ENTRIES ACCEL_FIFO_ENTRIES(&virge->fifo)
+#define FIFO_FULL    ACCEL_FIFO_FULL(&virge->fifo)
+#define FIFO_EMPTY   ACCEL_FIFO_EMPTY(&virge->fifo)
 
 #define FIFO_TYPE 0xff000000
 #define FIFO_ADDR 0x00ffffff
@@ -61,12 +59,6 @@ enum
         FIFO_WRITE_DWORD = (0x03 << 24),
 };
 
-typedef struct
-{
-        uint32_t addr_type;
-        uint32_t val;
-} fifo_entry_t;
-
 typedef struct s3d_t
 {
         uint32_t cmd_set;
@@ -226,14 +218,11 @@ typedef struct virge_t
                 int sec_x, sec_y, sec_w, sec_h;
         } streams;
 
-        fifo_entry_t fifo[FIFO_SIZE];
-        volatile int fifo_read_idx, fifo_write_idx;
-
-        thread_t *fifo_thread;
-        event_t *wake_fifo_thread;
-        event_t *fifo_not_full_event;
+        accel_fifo_t fifo;
         
         int virge_busy;
+
+        vid_trace_t *trace; /*Commands executed by the FIFO thread, NULL if not recording*/
         
         uint8_t subsys_stat, subsys_cntl;
 
@@ -242,7 +231,7 @@ typedef struct virge_t
 
 static inline void wake_fifo_thread(virge_t *virge)
 {
-        thread_set_event(virge->wake_fifo_thread); /*Wake up FIFO thread if moving from idle*/
+        accel_fifo_wake(&virge->fifo);
 }
 
 static void queue_triangle(virge_t *virge);
@@ -756,11 +745,7 @@ static void s3_virge_vblank_start(svga_t *svga)
 
 static void s3_virge_wait_fifo_idle(virge_t *virge)
 {
-        while (!FIFO_EMPTY)
-        {
-                wake_fifo_thread(virge);
-                thread_wait_event(virge->fifo_not_full_event, 1);
-        }
+        accel_fifo_wait_idle(&virge->fifo);
 }
 
 static uint8_t s3_virge_mmio_read(uint32_t addr, void *p)
@@ -975,17 +960,18 @@ static void fifo_thread(void *param)
         
         while (1)
         {
-                thread_set_event(virge->fifo_not_full_event);
-                thread_wait_event(virge->wake_fifo_thread, -1);
-                thread_reset_event(virge->wake_fifo_thread);
+                accel_fifo_wait_for_work(&virge->fifo);
                 virge->virge_busy = 1;
                 while (!FIFO_EMPTY)
                 {
                         uint64_t start_time = timer_read();
                         uint64_t end_time;
-                        fifo_entry_t *fifo = &virge->fifo[virge->fifo_read_idx & FIFO_MASK];
+                        accel_fifo_entry_t *fifo = ACCEL_FIFO_HEAD(&virge->fifo);
                         uint32_t val = fifo->val;
 
+                        if (virge->trace)
+                                vid_trace_record(virge->trace, fifo->addr_type, val);
+
                         switch (fifo->addr_type & FIFO_TYPE)
                         {
                                 case FIFO_WRITE_BYTE:
@@ -1306,11 +1292,8 @@ static void fifo_thread(void *param)
                                 break;
                         }
                                                 
-                        virge->fifo_read_idx++;
                         fifo->addr_type = FIFO_INVALID;
-
-                        if (FIFO_ENTRIES > 0xe000)
-                                thread_set_event(virge->fifo_not_full_event);
+                        accel_fifo_retire(&virge->fifo);
 
                         end_time = timer_read();
                         virge_time += end_time - start_time;
@@ -1323,26 +1306,7 @@ static void fifo_thread(void *param)
 
 static void s3_virge_queue(virge_t *virge, uint32_t addr, uint32_t val, uint32_t type)
 {
-        fifo_entry_t *fifo = &virge->fifo[virge->fifo_write_idx & FIFO_MASK];
-
-        if (FIFO_FULL)
-        {
-                thread_reset_event(virge->fifo_not_full_event);
-                if (FIFO_FULL)
-                {
-                        thread_wait_event(virge->fifo_not_full_event, -1); /*Wait for room in ringbuffer*/
-                }
-        }
-
-        fifo->val = val;
-        fifo->addr_type = (addr & FIFO_ADDR) | type;
-
-        virge->fifo_write_idx++;
-        
-        if (FIFO_ENTRIES > 0xe000)
-                wake_fifo_thread(virge);
-        if (FIFO_ENTRIES > 0xe000 || FIFO_ENTRIES < 8)
-                wake_fifo_thread(virge);
+        accel_fifo_queue(&virge->fifo, (addr & FIFO_ADDR) | type, val);
 }
 
 static void s3_virge_mmio_write(uint32_t addr, uint8_t val, void *p)
@@ -3860,6 +3824,12 @@ static void *s3_virge_init()
         virge->bilinear_enabled = device_get_config_int("bilinear");
         virge->dithering_enabled = device_get_config_int("dithering");
         virge->memory_size = device_get_config_int("memory");
+        if (device_get_config_int("trace"))
+        {
+                uint32_t config[3] = {virge->memory_size, virge->bilinear_enabled, virge->dithering_enabled};
+
+                virge->trace = vid_trace_open("virge.trc", VID_TRACE_VIRGE, config, 3);
+        }
         
         svga_init(&virge->svga, virge, virge->memory_size << 20,
                    s3_virge_recalctimings,
@@ -3939,9 +3909,7 @@ static void *s3_virge_init()
         virge->not_full_event = thread_create_event();
         virge->render_thread = thread_create(render_thread, virge);
 
-        virge->wake_fifo_thread = thread_create_event();
-        virge->fifo_not_full_event = thread_create_event();
-        virge->fifo_thread = thread_create(fifo_thread, virge);
+        accel_fifo_init(&virge->fifo, fifo_thread, virge);
  
         ddc_init();
 
@@ -3956,6 +3924,12 @@ static void *s3_virge_375_init()
         virge->bilinear_enabled = device_get_config_int("bilinear");
         virge->dithering_enabled = device_get_config_int("dithering");
         virge->memory_size = device_get_config_int("memory");
+        if (device_get_config_int("trace"))
+        {
+                uint32_t config[3] = {virge->memory_size, virge->bilinear_enabled, virge->dithering_enabled};
+
+                virge->trace = vid_trace_open("virge.trc", VID_TRACE_VIRGE, config, 3);
+        }
 
         svga_init(&virge->svga, virge, virge->memory_size << 20,
                    s3_virge_recalctimings,
@@ -4038,9 +4012,7 @@ static void *s3_virge_375_init()
         virge->not_full_event = thread_create_event();
         virge->render_thread = thread_create(render_thread, virge);
 
-        virge->wake_fifo_thread = thread_create_event();
-        virge->fifo_not_full_event = thread_create_event();
-        virge->fifo_thread = thread_create(fifo_thread, virge);
+        accel_fifo_init(&virge->fifo, fifo_thread, virge);
 
         ddc_init();
 
@@ -4061,9 +4033,10 @@ static void s3_virge_close(void *p)
         thread_destroy_event(virge->wake_main_thread);
         thread_destroy_event(virge->wake_render_thread);
         
-        thread_kill(virge->fifo_thread);
-        thread_destroy_event(virge->wake_fifo_thread);
-        thread_destroy_event(virge->fifo_not_full_event);
+        accel_fifo_close(&virge->fifo);
+
+        if (virge->trace)
+                vid_trace_close(virge->trace);
 
         svga_close(&virge->svga);
         
@@ -4149,6 +4122,12 @@ static device_config_t s3_virge_config[] =
                 .type = CONFIG_BINARY,
                 .default_int = 1
         },
+        {
+                .name = "trace",
+                .description = "Record command trace to logs directory",
+                .type = CONFIG_BINARY,
+                .default_int = 0
+        },
         {
                 .type = -1
         }
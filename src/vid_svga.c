@@ -25,6 +25,32 @@ svga_t *svga_get_pri()
 {
         return svga_pri;
 }
+/*LFB writes in packed pixel modes with no raster ops are plain stores to VRAM,
+  so once a page has been written through svga_write*_linear() in a frame it is
+  mapped directly into the soft TLB and later writes bypass the handlers. The
+  page has already been marked in changedvram for this frame, and the direct
+  translations are dropped at the end of each frame so the next write to a page
+  marks it again. Any register change that affects how LFB writes land in VRAM
+  must drop them as well*/
+void svga_lfb_direct_flush(svga_t *svga)
+{
+        if (svga->lfb_direct)
+        {
+                mem_flush_write_host_range(svga->vram, svga->vram_mask + 1);
+                svga->lfb_direct = 0;
+        }
+}
+
+static inline void svga_lfb_direct_add(svga_t *svga, uint32_t phys, uint32_t addr)
+{
+        if (svga->writemode || svga->writemask != 0xf || (svga->gdcreg[3] & 7))
+                return;
+        if ((addr & ~0xfff) + 0x1000 > svga->vram_max)
+                return;
+        mem_add_write_direct(phys, &svga->vram[addr], svga_writel_linear, svga);
+        svga->lfb_direct = 1;
+}
+
 void svga_set_override(svga_t *svga, int val)
 {
         if (svga->override && !val)
@@ -104,6 +130,7 @@ void svga_out(uint16_t addr, uint8_t val, void *p)
                         break;
                         case 2: 
                         svga->writemask = val & 0xf; 
+                        svga_lfb_direct_flush(svga);
                         break;
                         case 3:
                         svga->charsetb = (((val >> 2) & 3) * 0x10000) + 2;
@@ -117,6 +144,7 @@ void svga_out(uint16_t addr, uint8_t val, void *p)
                         svga->chain2_write = !(val & 4);
                         svga->chain4 = val & 8;
                         svga->fast = (svga->gdcreg[8] == 0xff && !(svga->gdcreg[3] & 0x18) && !svga->gdcreg[1]) && svga->chain4;
+                        svga_lfb_direct_flush(svga);
                         break;
                 }
                 break;
@@ -202,6 +230,8 @@ void svga_out(uint16_t addr, uint8_t val, void *p)
                 }
                 svga->gdcreg[svga->gdcaddr & 15] = val;                
                 svga->fast = (svga->gdcreg[8] == 0xff && !(svga->gdcreg[3] & 0x18) && !svga->gdcreg[1]) && svga->chain4;
+                svga_recalc_write(svga);
+                svga_lfb_direct_flush(svga);
                 if (((svga->gdcaddr & 15) == 5  && (val ^ o) & 0x70) || ((svga->gdcaddr & 15) == 6 && (val ^ o) & 1))
                         svga_recalctimings(svga);
                 break;
@@ -296,6 +326,8 @@ void svga_recalctimings(svga_t *svga)
         double crtcconst;
         double _dispontime, _dispofftime, disptime;
 
+        svga_lfb_direct_flush(svga);
+
         svga->vtotal = svga->crtc[6];
         svga->dispend = svga->crtc[0x12];
         svga->vsyncstart = svga->crtc[0x10];
@@ -626,6 +658,7 @@ void svga_poll(void *p)
                                 if (svga->changedvram[x]) 
                                         svga->changedvram[x]--;
                         }
+                        svga_lfb_direct_flush(svga);
 //                        memset(changedvram,0,2048);
                         if (svga->fullchange) 
                                 svga->fullchange--;
@@ -760,6 +793,7 @@ int svga_init(svga_t *svga, void *p, int memsize,
                 }
         }
         svga->readmode = 0;
+        svga_recalc_write(svga);
 
         svga->crtc[0] = 63;
         svga->crtc[6] = 255;
@@ -794,28 +828,135 @@ int svga_init(svga_t *svga, void *p, int memsize,
 
 void svga_close(svga_t *svga)
 {
+        svga_lfb_direct_flush(svga);
         free(svga->changedvram);
         free(svga->vram);
         
         svga_pri = NULL;
 }
 
-void svga_write(uint32_t addr, uint8_t val, void *p)
+/*Replicate a byte into all four planes*/
+#define SVGA_EXPAND(val) ((uint32_t)(val) * 0x01010101)
+#define SVGA_LATCH(svga) ((svga)->la | ((svga)->lb << 8) | ((svga)->lc << 16) | ((uint32_t)(svga)->ld << 24))
+
+static const uint32_t svga_plane_mask[16] =
 {
-        svga_t *svga = (svga_t *)p;
-        uint8_t vala, valb, valc, vald, wm = svga->writemask;
-        int writemask2 = svga->writemask;
+        0x00000000, 0x000000ff, 0x0000ff00, 0x0000ffff,
+        0x00ff0000, 0x00ff00ff, 0x00ffff00, 0x00ffffff,
+        0xff000000, 0xff0000ff, 0xff00ff00, 0xff00ffff,
+        0xffff0000, 0xffff00ff, 0xffffff00, 0xffffffff
+};
+
+/*Planar writes operate on all four planes at once - the planes for a given
+  address are the four consecutive bytes at addr, so each plane's value is held
+  in one byte of a 32-bit word. val and bitmask are per-plane, and writemask2
+  selects which planes are updated*/
+static inline void svga_write_planes(svga_t *svga, uint32_t addr, uint32_t val, uint32_t bitmask, int writemask2)
+{
+        uint32_t latch = SVGA_LATCH(svga);
+        uint32_t mask = svga_plane_mask[writemask2];
+        uint32_t *vram = (uint32_t *)&svga->vram[addr];
 
-        egawrites++;
+        switch (svga->write_op)
+        {
+                case 0: /*Set*/
+                val = (val & bitmask) | (latch & ~bitmask);
+                break;
+                case 8: /*AND*/
+                val = (val | ~bitmask) & latch;
+                break;
+                case 0x10: /*OR*/
+                val = (val & bitmask) | latch;
+                break;
+                case 0x18: /*XOR*/
+                val = (val & bitmask) ^ latch;
+                break;
+        }
+        *vram = (*vram & ~mask) | (val & mask);
+}
 
-        cycles -= video_timing_write_b;
-        cycles_lost += video_timing_write_b;
+/*Write mode 0 with no rotate, set/reset or logical op and all bits enabled -
+  the byte is copied straight to the enabled planes*/
+static void svga_write_mode0_copy(svga_t *svga, uint32_t addr, uint8_t val, int writemask2)
+{
+        uint32_t *vram = (uint32_t *)&svga->vram[addr];
 
-        if (svga_output) pclog("Writeega %06X   ",addr);
-        addr &= svga->banked_mask;
-        addr += svga->write_bank;
+        if (writemask2 == 0xf)
+                *vram = SVGA_EXPAND(val);
+        else
+                *vram = (*vram & ~svga_plane_mask[writemask2]) | (SVGA_EXPAND(val) & svga_plane_mask[writemask2]);
+}
+static void svga_write_mode0(svga_t *svga, uint32_t addr, uint8_t val, int writemask2)
+{
+        uint32_t val32 = SVGA_EXPAND(svga_rotate[svga->write_rotate][val]);
+
+        val32 = (val32 & ~svga->write_setreset_en) | (svga->write_setreset & svga->write_setreset_en);
+        svga_write_planes(svga, addr, val32, svga->write_bitmask, writemask2);
+}
+static void svga_write_mode1(svga_t *svga, uint32_t addr, uint8_t val, int writemask2)
+{
+        uint32_t latch = SVGA_LATCH(svga);
+        uint32_t mask = svga_plane_mask[writemask2];
+        uint32_t *vram = (uint32_t *)&svga->vram[addr];
+
+        *vram = (*vram & ~mask) | (latch & mask);
+}
+static void svga_write_mode2(svga_t *svga, uint32_t addr, uint8_t val, int writemask2)
+{
+        svga_write_planes(svga, addr, svga_plane_mask[val & 0xf], svga->write_bitmask, writemask2);
+}
+static void svga_write_mode3(svga_t *svga, uint32_t addr, uint8_t val, int writemask2)
+{
+        uint32_t bitmask = svga->write_bitmask & SVGA_EXPAND(svga_rotate[svga->write_rotate][val]);
+
+        svga_write_planes(svga, addr, svga->write_setreset, bitmask, writemask2);
+}
+static void svga_write_none(svga_t *svga, uint32_t addr, uint8_t val, int writemask2)
+{
+}
+
+/*Select the planar write function for the current write mode, set/reset,
+  data rotate and bit mask registers. Must be called whenever any of these
+  change*/
+void svga_recalc_write(svga_t *svga)
+{
+        svga->write_setreset = svga_plane_mask[svga->gdcreg[0] & 0xf];
+        svga->write_bitmask = SVGA_EXPAND(svga->gdcreg[8]);
+        svga->write_rotate = svga->gdcreg[3] & 7;
+        svga->write_op = svga->gdcreg[3] & 0x18;
+        if (svga->gdcreg[8] == 0xff && !svga->write_op && (!svga->gdcreg[1] || svga->set_reset_disabled))
+                svga->write_setreset_en = 0;
+        else
+                svga->write_setreset_en = svga_plane_mask[svga->gdcreg[1] & 0xf];
+
+        switch (svga->writemode)
+        {
+                case 0:
+                if (!svga->write_setreset_en && !svga->write_rotate && !svga->write_op && svga->gdcreg[8] == 0xff)
+                        svga->write_planar = svga_write_mode0_copy;
+                else
+                        svga->write_planar = svga_write_mode0;
+                break;
+                case 1:
+                svga->write_planar = svga_write_mode1;
+                break;
+                case 2:
+                svga->write_planar = svga_write_mode2;
+                break;
+                case 3:
+                svga->write_planar = svga_write_mode3;
+                break;
+                default:
+                svga->write_planar = svga_write_none;
+                break;
+        }
+}
+
+/*Write a byte to an address that has already had banking applied*/
+static inline void svga_write_common(svga_t *svga, uint32_t addr, uint8_t val)
+{
+        int writemask2 = svga->writemask;
 
-        if (!(svga->gdcreg[6] & 1)) svga->fullchange=2;
         if (svga->chain4 || svga->fb_only)
         {
                 writemask2=1<<(addr&3);
@@ -843,150 +984,55 @@ void svga_write(uint32_t addr, uint8_t val, void *p)
         if (svga_output) pclog("%08X (%i, %i) %02X %i %i %i %02X\n", addr, addr & 1023, addr >> 10, val, writemask2, svga->writemode, svga->chain4, svga->gdcreg[8]);
         svga->changedvram[addr >> 12] = changeframecount;
 
-        switch (svga->writemode)
+        svga->write_planar(svga, addr, val, writemask2);
+}
+
+void svga_write(uint32_t addr, uint8_t val, void *p)
+{
+        svga_t *svga = (svga_t *)p;
+
+        egawrites++;
+
+        cycles -= video_timing_write_b;
+        cycles_lost += video_timing_write_b;
+
+        if (svga_output) pclog("Writeega %06X   ",addr);
+        addr &= svga->banked_mask;
+        addr += svga->write_bank;
+
+        if (!(svga->gdcreg[6] & 1)) svga->fullchange=2;
+
+        svga_write_common(svga, addr, val);
+}
+
+/*Word and dword writes that can't take the packed fast path. The bank is only
+  applied once, unless the access wraps around the end of the bank window*/
+static void svga_write_run(svga_t *svga, uint32_t addr, uint32_t val, int count)
+{
+        int c;
+
+        if ((addr & svga->banked_mask) + count - 1 > svga->banked_mask)
         {
-                case 1:
-                if (writemask2 & 1) svga->vram[addr]       = svga->la;
-                if (writemask2 & 2) svga->vram[addr | 0x1] = svga->lb;
-                if (writemask2 & 4) svga->vram[addr | 0x2] = svga->lc;
-                if (writemask2 & 8) svga->vram[addr | 0x3] = svga->ld;
-                break;
-                case 0:
-                if (svga->gdcreg[3] & 7) 
-                        val = svga_rotate[svga->gdcreg[3] & 7][val];
-                if (svga->gdcreg[8] == 0xff && !(svga->gdcreg[3] & 0x18) && (!svga->gdcreg[1] || svga->set_reset_disabled))
-                {
-                        if (writemask2 & 1) svga->vram[addr]       = val;
-                        if (writemask2 & 2) svga->vram[addr | 0x1] = val;
-                        if (writemask2 & 4) svga->vram[addr | 0x2] = val;
-                        if (writemask2 & 8) svga->vram[addr | 0x3] = val;
-                }
-                else
-                {
-                        if (svga->gdcreg[1] & 1) vala = (svga->gdcreg[0] & 1) ? 0xff : 0;
-                        else                     vala = val;
-                        if (svga->gdcreg[1] & 2) valb = (svga->gdcreg[0] & 2) ? 0xff : 0;
-                        else                     valb = val;
-                        if (svga->gdcreg[1] & 4) valc = (svga->gdcreg[0] & 4) ? 0xff : 0;
-                        else                     valc = val;
-                        if (svga->gdcreg[1] & 8) vald = (svga->gdcreg[0] & 8) ? 0xff : 0;
-                        else                     vald = val;
-
-                        switch (svga->gdcreg[3] & 0x18)
-                        {
-                                case 0: /*Set*/
-                                if (writemask2 & 1) svga->vram[addr]       = (vala & svga->gdcreg[8]) | (svga->la & ~svga->gdcreg[8]);
-                                if (writemask2 & 2) svga->vram[addr | 0x1] = (valb & svga->gdcreg[8]) | (svga->lb & ~svga->gdcreg[8]);
-                                if (writemask2 & 4) svga->vram[addr | 0x2] = (valc & svga->gdcreg[8]) | (svga->lc & ~svga->gdcreg[8]);
-                                if (writemask2 & 8) svga->vram[addr | 0x3] = (vald & svga->gdcreg[8]) | (svga->ld & ~svga->gdcreg[8]);
-                                break;
-                                case 8: /*AND*/
-                                if (writemask2 & 1) svga->vram[addr]       = (vala | ~svga->gdcreg[8]) & svga->la;
-                                if (writemask2 & 2) svga->vram[addr | 0x1] = (valb | ~svga->gdcreg[8]) & svga->lb;
-                                if (writemask2 & 4) svga->vram[addr | 0x2] = (valc | ~svga->gdcreg[8]) & svga->lc;
-                                if (writemask2 & 8) svga->vram[addr | 0x3] = (vald | ~svga->gdcreg[8]) & svga->ld;
-                                break;
-                                case 0x10: /*OR*/
-                                if (writemask2 & 1) svga->vram[addr]       = (vala & svga->gdcreg[8]) | svga->la;
-                                if (writemask2 & 2) svga->vram[addr | 0x1] = (valb & svga->gdcreg[8]) | svga->lb;
-                                if (writemask2 & 4) svga->vram[addr | 0x2] = (valc & svga->gdcreg[8]) | svga->lc;
-                                if (writemask2 & 8) svga->vram[addr | 0x3] = (vald & svga->gdcreg[8]) | svga->ld;
-                                break;
-                                case 0x18: /*XOR*/
-                                if (writemask2 & 1) svga->vram[addr]       = (vala & svga->gdcreg[8]) ^ svga->la;
-                                if (writemask2 & 2) svga->vram[addr | 0x1] = (valb & svga->gdcreg[8]) ^ svga->lb;
-                                if (writemask2 & 4) svga->vram[addr | 0x2] = (valc & svga->gdcreg[8]) ^ svga->lc;
-                                if (writemask2 & 8) svga->vram[addr | 0x3] = (vald & svga->gdcreg[8]) ^ svga->ld;
-                                break;
-                        }
-//                        pclog("- %02X %02X %02X %02X   %08X\n",vram[addr],vram[addr|0x1],vram[addr|0x2],vram[addr|0x3],addr);
-                }
-                break;
-                case 2:
-                if (!(svga->gdcreg[3] & 0x18) && (!svga->gdcreg[1] || svga->set_reset_disabled))
-                {
-                        if (writemask2 & 1) svga->vram[addr]       = (((val & 1) ? 0xff : 0) & svga->gdcreg[8]) | (svga->la & ~svga->gdcreg[8]);
-                        if (writemask2 & 2) svga->vram[addr | 0x1] = (((val & 2) ? 0xff : 0) & svga->gdcreg[8]) | (svga->lb & ~svga->gdcreg[8]);
-                        if (writemask2 & 4) svga->vram[addr | 0x2] = (((val & 4) ? 0xff : 0) & svga->gdcreg[8]) | (svga->lc & ~svga->gdcreg[8]);
-                        if (writemask2 & 8) svga->vram[addr | 0x3] = (((val & 8) ? 0xff : 0) & svga->gdcreg[8]) | (svga->ld & ~svga->gdcreg[8]);
-                }
-                else
-                {
-                        vala = ((val & 1) ? 0xff : 0);
-                        valb = ((val & 2) ? 0xff : 0);
-                        valc = ((val & 4) ? 0xff : 0);
-                        vald = ((val & 8) ? 0xff : 0);
-                        switch (svga->gdcreg[3] & 0x18)
-                        {
-                                case 0: /*Set*/
-                                if (writemask2 & 1) svga->vram[addr]       = (vala & svga->gdcreg[8]) | (svga->la & ~svga->gdcreg[8]);
-                                if (writemask2 & 2) svga->vram[addr | 0x1] = (valb & svga->gdcreg[8]) | (svga->lb & ~svga->gdcreg[8]);
-                                if (writemask2 & 4) svga->vram[addr | 0x2] = (valc & svga->gdcreg[8]) | (svga->lc & ~svga->gdcreg[8]);
-                                if (writemask2 & 8) svga->vram[addr | 0x3] = (vald & svga->gdcreg[8]) | (svga->ld & ~svga->gdcreg[8]);
-                                break;
-                                case 8: /*AND*/
-                                if (writemask2 & 1) svga->vram[addr]       = (vala | ~svga->gdcreg[8]) & svga->la;
-                                if (writemask2 & 2) svga->vram[addr | 0x1] = (valb | ~svga->gdcreg[8]) & svga->lb;
-                                if (writemask2 & 4) svga->vram[addr | 0x2] = (valc | ~svga->gdcreg[8]) & svga->lc;
-                                if (writemask2 & 8) svga->vram[addr | 0x3] = (vald | ~svga->gdcreg[8]) & svga->ld;
-                                break;
-                                case 0x10: /*OR*/
-                                if (writemask2 & 1) svga->vram[addr]       = (vala & svga->gdcreg[8]) | svga->la;
-                                if (writemask2 & 2) svga->vram[addr | 0x1] = (valb & svga->gdcreg[8]) | svga->lb;
-                                if (writemask2 & 4) svga->vram[addr | 0x2] = (valc & svga->gdcreg[8]) | svga->lc;
-                                if (writemask2 & 8) svga->vram[addr | 0x3] = (vald & svga->gdcreg[8]) | svga->ld;
-                                break;
-                                case 0x18: /*XOR*/
-                                if (writemask2 & 1) svga->vram[addr]       = (vala & svga->gdcreg[8]) ^ svga->la;
-                                if (writemask2 & 2) svga->vram[addr | 0x1] = (valb & svga->gdcreg[8]) ^ svga->lb;
-                                if (writemask2 & 4) svga->vram[addr | 0x2] = (valc & svga->gdcreg[8]) ^ svga->lc;
-                                if (writemask2 & 8) svga->vram[addr | 0x3] = (vald & svga->gdcreg[8]) ^ svga->ld;
-                                break;
-                        }
-                }
-                break;
-                case 3:
-                if (svga->gdcreg[3] & 7) 
-                        val = svga_rotate[svga->gdcreg[3] & 7][val];
-                wm = svga->gdcreg[8];
-                svga->gdcreg[8] &= val;
-
-                vala = (svga->gdcreg[0] & 1) ? 0xff : 0;
-                valb = (svga->gdcreg[0] & 2) ? 0xff : 0;
-                valc = (svga->gdcreg[0] & 4) ? 0xff : 0;
-                vald = (svga->gdcreg[0] & 8) ? 0xff : 0;
-                switch (svga->gdcreg[3] & 0x18)
-                {
-                        case 0: /*Set*/
-                        if (writemask2 & 1) svga->vram[addr]       = (vala & svga->gdcreg[8]) | (svga->la & ~svga->gdcreg[8]);
-                        if (writemask2 & 2) svga->vram[addr | 0x1] = (valb & svga->gdcreg[8]) | (svga->lb & ~svga->gdcreg[8]);
-                        if (writemask2 & 4) svga->vram[addr | 0x2] = (valc & svga->gdcreg[8]) | (svga->lc & ~svga->gdcreg[8]);
-                        if (writemask2 & 8) svga->vram[addr | 0x3] = (vald & svga->gdcreg[8]) | (svga->ld & ~svga->gdcreg[8]);
-                        break;
-                        case 8: /*AND*/
-                        if (writemask2 & 1) svga->vram[addr]       = (vala | ~svga->gdcreg[8]) & svga->la;
-                        if (writemask2 & 2) svga->vram[addr | 0x1] = (valb | ~svga->gdcreg[8]) & svga->lb;
-                        if (writemask2 & 4) svga->vram[addr | 0x2] = (valc | ~svga->gdcreg[8]) & svga->lc;
-                        if (writemask2 & 8) svga->vram[addr | 0x3] = (vald | ~svga->gdcreg[8]) & svga->ld;
-                        break;
-                        case 0x10: /*OR*/
-                        if (writemask2 & 1) svga->vram[addr]       = (vala & svga->gdcreg[8]) | svga->la;
-                        if (writemask2 & 2) svga->vram[addr | 0x1] = (valb & svga->gdcreg[8]) | svga->lb;
-                        if (writemask2 & 4) svga->vram[addr | 0x2] = (valc & svga->gdcreg[8]) | svga->lc;
-                        if (writemask2 & 8) svga->vram[addr | 0x3] = (vald & svga->gdcreg[8]) | svga->ld;
-                        break;
-                        case 0x18: /*XOR*/
-                        if (writemask2 & 1) svga->vram[addr]       = (vala & svga->gdcreg[8]) ^ svga->la;
-                        if (writemask2 & 2) svga->vram[addr | 0x1] = (valb & svga->gdcreg[8]) ^ svga->lb;
-                        if (writemask2 & 4) svga->vram[addr | 0x2] = (valc & svga->gdcreg[8]) ^ svga->lc;
-                        if (writemask2 & 8) svga->vram[addr | 0x3] = (vald & svga->gdcreg[8]) ^ svga->ld;
-                        break;
-                }
-                svga->gdcreg[8] = wm;
-                break;
+                for (c = 0; c < count; c++)
+                        svga_write(addr + c, val >> (c * 8), svga);
+                return;
         }
+
+        egawrites += count;
+
+        cycles -= video_timing_write_b * count;
+        cycles_lost += video_timing_write_b * count;
+
+        addr &= svga->banked_mask;
+        addr += svga->write_bank;
+
+        if (!(svga->gdcreg[6] & 1)) svga->fullchange=2;
+
+        for (c = 0; c < count; c++)
+                svga_write_common(svga, addr + c, val >> (c * 8));
 }
 
+
 uint8_t svga_read(uint32_t addr, void *p)
 {
         svga_t *svga = (svga_t *)p;
@@ -1071,8 +1117,6 @@ uint8_t svga_read(uint32_t addr, void *p)
 void svga_write_linear(uint32_t addr, uint8_t val, void *p)
 {
         svga_t *svga = (svga_t *)p;
-        uint8_t vala, valb, valc, vald, wm = svga->writemask;
-        int writemask2 = svga->writemask;
 
         cycles -= video_timing_write_b;
         cycles_lost += video_timing_write_b;
@@ -1082,174 +1126,27 @@ void svga_write_linear(uint32_t addr, uint8_t val, void *p)
         if (svga_output) pclog("Write LFB %08X %02X ", addr, val);
         if (!(svga->gdcreg[6] & 1)) 
                 svga->fullchange = 2;
-        if (svga->chain4 || svga->fb_only)
-        {
-                writemask2=1<<(addr&3);
-                addr&=~3;
-        }
-        else if (svga->chain2_write)
-        {
-                writemask2 &= ~0xa;
-                if (addr & 1)
-                        writemask2 <<= 1;
-                addr &= ~1;
-                addr <<= 2;
-        }
-        else
-        {
-                addr<<=2;
-        }
-        addr &= svga->decode_mask;
-        if (addr >= svga->vram_max)
-                return;
-        addr &= svga->vram_mask;
-        if (svga_output) pclog("%08X\n", addr);
-        svga->changedvram[addr >> 12]=changeframecount;
-        
-        switch (svga->writemode)
-        {
-                case 1:
-                if (writemask2 & 1) svga->vram[addr]       = svga->la;
-                if (writemask2 & 2) svga->vram[addr | 0x1] = svga->lb;
-                if (writemask2 & 4) svga->vram[addr | 0x2] = svga->lc;
-                if (writemask2 & 8) svga->vram[addr | 0x3] = svga->ld;
-                break;
-                case 0:
-                if (svga->gdcreg[3] & 7) 
-                        val = svga_rotate[svga->gdcreg[3] & 7][val];
-                if (svga->gdcreg[8] == 0xff && !(svga->gdcreg[3] & 0x18) && (!svga->gdcreg[1] || svga->set_reset_disabled))
-                {
-                        if (writemask2 & 1) svga->vram[addr]       = val;
-                        if (writemask2 & 2) svga->vram[addr | 0x1] = val;
-                        if (writemask2 & 4) svga->vram[addr | 0x2] = val;
-                        if (writemask2 & 8) svga->vram[addr | 0x3] = val;
-                }
-                else
-                {
-                        if (svga->gdcreg[1] & 1) vala = (svga->gdcreg[0] & 1) ? 0xff : 0;
-                        else                     vala = val;
-                        if (svga->gdcreg[1] & 2) valb = (svga->gdcreg[0] & 2) ? 0xff : 0;
-                        else                     valb = val;
-                        if (svga->gdcreg[1] & 4) valc = (svga->gdcreg[0] & 4) ? 0xff : 0;
-                        else                     valc = val;
-                        if (svga->gdcreg[1] & 8) vald = (svga->gdcreg[0] & 8) ? 0xff : 0;
-                        else                     vald = val;
-
-                        switch (svga->gdcreg[3] & 0x18)
-                        {
-                                case 0: /*Set*/
-                                if (writemask2 & 1) svga->vram[addr]       = (vala & svga->gdcreg[8]) | (svga->la & ~svga->gdcreg[8]);
-                                if (writemask2 & 2) svga->vram[addr | 0x1] = (valb & svga->gdcreg[8]) | (svga->lb & ~svga->gdcreg[8]);
-                                if (writemask2 & 4) svga->vram[addr | 0x2] = (valc & svga->gdcreg[8]) | (svga->lc & ~svga->gdcreg[8]);
-                                if (writemask2 & 8) svga->vram[addr | 0x3] = (vald & svga->gdcreg[8]) | (svga->ld & ~svga->gdcreg[8]);
-                                break;
-                                case 8: /*AND*/
-                                if (writemask2 & 1) svga->vram[addr]       = (vala | ~svga->gdcreg[8]) & svga->la;
-                                if (writemask2 & 2) svga->vram[addr | 0x1] = (valb | ~svga->gdcreg[8]) & svga->lb;
-                                if (writemask2 & 4) svga->vram[addr | 0x2] = (valc | ~svga->gdcreg[8]) & svga->lc;
-                                if (writemask2 & 8) svga->vram[addr | 0x3] = (vald | ~svga->gdcreg[8]) & svga->ld;
-                                break;
-                                case 0x10: /*OR*/
-                                if (writemask2 & 1) svga->vram[addr]       = (vala & svga->gdcreg[8]) | svga->la;
-                                if (writemask2 & 2) svga->vram[addr | 0x1] = (valb & svga->gdcreg[8]) | svga->lb;
-                                if (writemask2 & 4) svga->vram[addr | 0x2] = (valc & svga->gdcreg[8]) | svga->lc;
-                                if (writemask2 & 8) svga->vram[addr | 0x3] = (vald & svga->gdcreg[8]) | svga->ld;
-                                break;
-                                case 0x18: /*XOR*/
-                                if (writemask2 & 1) svga->vram[addr]       = (vala & svga->gdcreg[8]) ^ svga->la;
-                                if (writemask2 & 2) svga->vram[addr | 0x1] = (valb & svga->gdcreg[8]) ^ svga->lb;
-                                if (writemask2 & 4) svga->vram[addr | 0x2] = (valc & svga->gdcreg[8]) ^ svga->lc;
-                                if (writemask2 & 8) svga->vram[addr | 0x3] = (vald & svga->gdcreg[8]) ^ svga->ld;
-                                break;
-                        }
-//                        pclog("- %02X %02X %02X %02X   %08X\n",vram[addr],vram[addr|0x1],vram[addr|0x2],vram[addr|0x3],addr);
-                }
-                break;
-                case 2:
-                if (!(svga->gdcreg[3] & 0x18) && (!svga->gdcreg[1] || svga->set_reset_disabled))
-                {
-                        if (writemask2 & 1) svga->vram[addr]       = (((val & 1) ? 0xff : 0) & svga->gdcreg[8]) | (svga->la & ~svga->gdcreg[8]);
-                        if (writemask2 & 2) svga->vram[addr | 0x1] = (((val & 2) ? 0xff : 0) & svga->gdcreg[8]) | (svga->lb & ~svga->gdcreg[8]);
-                        if (writemask2 & 4) svga->vram[addr | 0x2] = (((val & 4) ? 0xff : 0) & svga->gdcreg[8]) | (svga->lc & ~svga->gdcreg[8]);
-                        if (writemask2 & 8) svga->vram[addr | 0x3] = (((val & 8) ? 0xff : 0) & svga->gdcreg[8]) | (svga->ld & ~svga->gdcreg[8]);
-                }
-                else
-                {
-                        vala = ((val & 1) ? 0xff : 0);
-                        valb = ((val & 2) ? 0xff : 0);
-                        valc = ((val & 4) ? 0xff : 0);
-                        vald = ((val & 8) ? 0xff : 0);
-                        switch (svga->gdcreg[3] & 0x18)
-                        {
-                                case 0: /*Set*/
-                                if (writemask2 & 1) svga->vram[addr]       = (vala & svga->gdcreg[8]) | (svga->la & ~svga->gdcreg[8]);
-                                if (writemask2 & 2) svga->vram[addr | 0x1] = (valb & svga->gdcreg[8]) | (svga->lb & ~svga->gdcreg[8]);
-                                if (writemask2 & 4) svga->vram[addr | 0x2] = (valc & svga->gdcreg[8]) | (svga->lc & ~svga->gdcreg[8]);
-                                if (writemask2 & 8) svga->vram[addr | 0x3] = (vald & svga->gdcreg[8]) | (svga->ld & ~svga->gdcreg[8]);
-                                break;
-                                case 8: /*AND*/
-                                if (writemask2 & 1) svga->vram[addr]       = (vala | ~svga->gdcreg[8]) & svga->la;
-                                if (writemask2 & 2) svga->vram[addr | 0x1] = (valb | ~svga->gdcreg[8]) & svga->lb;
-                                if (writemask2 & 4) svga->vram[addr | 0x2] = (valc | ~svga->gdcreg[8]) & svga->lc;
-                                if (writemask2 & 8) svga->vram[addr | 0x3] = (vald | ~svga->gdcreg[8]) & svga->ld;
-                                break;
-                                case 0x10: /*OR*/
-                                if (writemask2 & 1) svga->vram[addr]       = (vala & svga->gdcreg[8]) | svga->la;
-                                if (writemask2 & 2) svga->vram[addr | 0x1] = (valb & svga->gdcreg[8]) | svga->lb;
-                                if (writemask2 & 4) svga->vram[addr | 0x2] = (valc & svga->gdcreg[8]) | svga->lc;
-                                if (writemask2 & 8) svga->vram[addr | 0x3] = (vald & svga->gdcreg[8]) | svga->ld;
-                                break;
-                                case 0x18: /*XOR*/
-                                if (writemask2 & 1) svga->vram[addr]       = (vala & svga->gdcreg[8]) ^ svga->la;
-                                if (writemask2 & 2) svga->vram[addr | 0x1] = (valb & svga->gdcreg[8]) ^ svga->lb;
-                                if (writemask2 & 4) svga->vram[addr | 0x2] = (valc & svga->gdcreg[8]) ^ svga->lc;
-                                if (writemask2 & 8) svga->vram[addr | 0x3] = (vald & svga->gdcreg[8]) ^ svga->ld;
-                                break;
-                        }
-                }
-                break;
-                case 3:
-                if (svga->gdcreg[3] & 7) 
-                        val = svga_rotate[svga->gdcreg[3] & 7][val];
-                wm = svga->gdcreg[8];
-                svga->gdcreg[8] &= val;
-
-                vala = (svga->gdcreg[0] & 1) ? 0xff : 0;
-                valb = (svga->gdcreg[0] & 2) ? 0xff : 0;
-                valc = (svga->gdcreg[0] & 4) ? 0xff : 0;
-                vald = (svga->gdcreg[0] & 8) ? 0xff : 0;
-                switch (svga->gdcreg[3] & 0x18)
-                {
-                        case 0: /*Set*/
-                        if (writemask2 & 1) svga->vram[addr]       = (vala & svga->gdcreg[8]) | (svga->la & ~svga->gdcreg[8]);
-                        if (writemask2 & 2) svga->vram[addr | 0x1] = (valb & svga->gdcreg[8]) | (svga->lb & ~svga->gdcreg[8]);
-                        if (writemask2 & 4) svga->vram[addr | 0x2] = (valc & svga->gdcreg[8]) | (svga->lc & ~svga->gdcreg[8]);
-                        if (writemask2 & 8) svga->vram[addr | 0x3] = (vald & svga->gdcreg[8]) | (svga->ld & ~svga->gdcreg[8]);
-                        break;
-                        case 8: /*AND*/
-                        if (writemask2 & 1) svga->vram[addr]       = (vala | ~svga->gdcreg[8]) & svga->la;
-                        if (writemask2 & 2) svga->vram[addr | 0x1] = (valb | ~svga->gdcreg[8]) & svga->lb;
-                        if (writemask2 & 4) svga->vram[addr | 0x2] = (valc | ~svga->gdcreg[8]) & svga->lc;
-                        if (writemask2 & 8) svga->vram[addr | 0x3] = (vald | ~svga->gdcreg[8]) & svga->ld;
-                        break;
-                        case 0x10: /*OR*/
-                        if (writemask2 & 1) svga->vram[addr]       = (vala & svga->gdcreg[8]) | svga->la;
-                        if (writemask2 & 2) svga->vram[addr | 0x1] = (valb & svga->gdcreg[8]) | svga->lb;
-                        if (writemask2 & 4) svga->vram[addr | 0x2] = (valc & svga->gdcreg[8]) | svga->lc;
-                        if (writemask2 & 8) svga->vram[addr | 0x3] = (vald & svga->gdcreg[8]) | svga->ld;
-                        break;
-                        case 0x18: /*XOR*/
-                        if (writemask2 & 1) svga->vram[addr]       = (vala & svga->gdcreg[8]) ^ svga->la;
-                        if (writemask2 & 2) svga->vram[addr | 0x1] = (valb & svga->gdcreg[8]) ^ svga->lb;
-                        if (writemask2 & 4) svga->vram[addr | 0x2] = (valc & svga->gdcreg[8]) ^ svga->lc;
-                        if (writemask2 & 8) svga->vram[addr | 0x3] = (vald & svga->gdcreg[8]) ^ svga->ld;
-                        break;
-                }
-                svga->gdcreg[8] = wm;
-                break;
-        }
+
+        svga_write_common(svga, addr, val);
 }
 
+static void svga_write_linear_run(svga_t *svga, uint32_t addr, uint32_t val, int count)
+{
+        int c;
+
+        egawrites += count;
+
+        cycles -= video_timing_write_b * count;
+        cycles_lost += video_timing_write_b * count;
+
+        if (!(svga->gdcreg[6] & 1)) 
+                svga->fullchange = 2;
+
+        for (c = 0; c < count; c++)
+                svga_write_common(svga, addr + c, val >> (c * 8));
+}
+
+
 uint8_t svga_read_linear(uint32_t addr, void *p)
 {
         svga_t *svga = (svga_t *)p;
@@ -1356,8 +1253,7 @@ void svga_writew(uint32_t addr, uint16_t val, void *p)
         svga_t *svga = (svga_t *)p;
         if (!svga->fast)
         {
-                svga_write(addr, val, p);
-                svga_write(addr + 1, val >> 8, p);
+                svga_write_run(svga, addr, val, 2);
                 return;
         }
         
@@ -1383,10 +1279,7 @@ void svga_writel(uint32_t addr, uint32_t val, void *p)
         
         if (!svga->fast)
         {
-                svga_write(addr, val, p);
-                svga_write(addr + 1, val >> 8, p);
-                svga_write(addr + 2, val >> 16, p);
-                svga_write(addr + 3, val >> 24, p);
+                svga_write_run(svga, addr, val, 4);
                 return;
         }
         
@@ -1454,11 +1347,11 @@ uint32_t svga_readl(uint32_t addr, void *p)
 void svga_writew_linear(uint32_t addr, uint16_t val, void *p)
 {
         svga_t *svga = (svga_t *)p;
+        uint32_t phys = addr;
         
         if (!svga->fast)
         {
-                svga_write_linear(addr, val, p);
-                svga_write_linear(addr + 1, val >> 8, p);
+                svga_write_linear_run(svga, addr, val, 2);
                 return;
         }
         
@@ -1474,18 +1367,17 @@ void svga_writew_linear(uint32_t addr, uint16_t val, void *p)
         addr &= svga->vram_mask;
         svga->changedvram[addr >> 12] = changeframecount;
         *(uint16_t *)&svga->vram[addr] = val;
+        svga_lfb_direct_add(svga, phys, addr);
 }
 
 void svga_writel_linear(uint32_t addr, uint32_t val, void *p)
 {
         svga_t *svga = (svga_t *)p;
+        uint32_t phys = addr;
         
         if (!svga->fast)
         {
-                svga_write_linear(addr, val, p);
-                svga_write_linear(addr + 1, val >> 8, p);
-                svga_write_linear(addr + 2, val >> 16, p);
-                svga_write_linear(addr + 3, val >> 24, p);
+                svga_write_linear_run(svga, addr, val, 4);
                 return;
         }
         
@@ -1501,6 +1393,7 @@ void svga_writel_linear(uint32_t addr, uint32_t val, void *p)
         addr &= svga->vram_mask;
         svga->changedvram[addr >> 12] = changeframecount;
         *(uint32_t *)&svga->vram[addr] = val;
+        svga_lfb_direct_add(svga, phys, addr);
 }
 
 uint16_t svga_readw_linear(uint32_t addr, void *p)
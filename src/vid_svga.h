@@ -41,6 +41,15 @@ typedef struct svga_t
         int fb_only;
         
         int fast;
+        /*Non-zero if LFB writes may currently bypass svga_write*_linear()
+          through direct soft TLB translations to VRAM*/
+        int lfb_direct;
+
+        /*Planar write handler and register state, precomputed by
+          svga_recalc_write()*/
+        void (*write_planar)(struct svga_t *svga, uint32_t addr, uint8_t val, int writemask2);
+        uint32_t write_setreset, write_setreset_en, write_bitmask;
+        int write_rotate, write_op;
         uint8_t colourcompare, colournocare;
         int readmode, writemode, readplane;
         int chain4, chain2_write, chain2_read;
@@ -157,6 +166,9 @@ extern int svga_init(svga_t *svga, void *p, int memsize,
                void (*hwcursor_draw)(struct svga_t *svga, int displine),
                void (*overlay_draw)(struct svga_t *svga, int displine));
 void svga_close(svga_t *svga);
+
+void svga_lfb_direct_flush(svga_t *svga);
+void svga_recalc_write(svga_t *svga);
 extern void svga_recalctimings(svga_t *svga);
 
 
@@ -49,7 +49,7 @@ void svga_render_text_40(svga_t *svga)
         {
                 int offset = ((8 - svga->scrollcache) << 1) + 16;
                 uint32_t *p = &((uint32_t *)buffer32->line[svga->displine])[offset];
-                int x, xx;
+                int x;
                 int drawcursor;
                 uint8_t chr, attr, dat;
                 uint32_t charaddr;
@@ -82,15 +82,9 @@ void svga_render_text_40(svga_t *svga)
                         }
 
                         dat = svga->vram[charaddr + (svga->sc << 2)];
-                        if (svga->seqregs[1] & 1) 
-                        { 
-                                for (xx = 0; xx < 16; xx += 2) 
-                                        p[xx] = p[xx + 1] = (dat & (0x80 >> (xx >> 1))) ? fg : bg;
-                        }
-                        else
+                        video_expand_glyph_double(p, dat, fg, bg);
+                        if (!(svga->seqregs[1] & 1)) 
                         {
-                                for (xx = 0; xx < 16; xx += 2)
-                                        p[xx] = p[xx + 1] = (dat & (0x80 >> (xx >> 1))) ? fg : bg;
                                 if ((chr & ~0x1F) != 0xC0 || !(svga->attrregs[0x10] & 4)) 
                                         p[16] = p[17] = bg;
                                 else                  
@@ -113,7 +107,7 @@ void svga_render_text_80(svga_t *svga)
         {
                 int offset = (8 - svga->scrollcache) + 24;
                 uint32_t *p = &((uint32_t *)buffer32->line[svga->displine])[offset];
-                int x, xx;
+                int x;
                 int drawcursor;
                 uint8_t chr, attr, dat;
                 uint32_t charaddr;
@@ -146,15 +140,9 @@ void svga_render_text_80(svga_t *svga)
                         }
 
                         dat = svga->vram[charaddr + (svga->sc << 2)];
-                        if (svga->seqregs[1] & 1) 
-                        { 
-                                for (xx = 0; xx < 8; xx++) 
-                                        p[xx] = (dat & (0x80 >> xx)) ? fg : bg;
-                        }
-                        else
+                        video_expand_glyph(p, dat, fg, bg);
+                        if (!(svga->seqregs[1] & 1)) 
                         {
-                                for (xx = 0; xx < 8; xx++) 
-                                        p[xx] = (dat & (0x80 >> xx)) ? fg : bg;
                                 if ((chr & ~0x1F) != 0xC0 || !(svga->attrregs[0x10] & 4)) 
                                         p[8] = bg;
                                 else                  
@@ -232,15 +220,9 @@ void svga_render_text_80_ksc5601(svga_t *svga)
                                 if ((svga->ksc5601_english_font_type >> 8) == 1) dat = fontdatksc5601[((svga->ksc5601_english_font_type & 0x7F) << 7) | (chr >> 1)][((chr & 1) << 4) | svga->sc];
                                 else dat = svga->vram[charaddr + (svga->sc << 2)];
                         }
-                        if (svga->seqregs[1] & 1) 
-                        { 
-                                for (xx = 0; xx < 8; xx++) 
-                                        p[xx] = (dat & (0x80 >> xx)) ? fg : bg;
-                        }
-                        else
+                        video_expand_glyph(p, dat, fg, bg);
+                        if (!(svga->seqregs[1] & 1)) 
                         {
-                                for (xx = 0; xx < 8; xx++) 
-                                        p[xx] = (dat & (0x80 >> xx)) ? fg : bg;
                                 if ((chr & ~0x1F) != 0xC0 || !(svga->attrregs[0x10] & 4)) 
                                         p[8] = bg;
                                 else                  
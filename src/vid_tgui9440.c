@@ -8,6 +8,7 @@
 #include "rom.h"
 #include "thread.h"
 #include "video.h"
+#include "vid_fifo.h"
 #include "vid_svga.h"
 #include "vid_svga_render.h"
 #include "vid_tkd8001_ramdac.h"
@@ -49,13 +50,9 @@
 #define EXT_CTRL_MONO_TRANSPARENT 0x04
 #define EXT_CTRL_LATCH_COPY       0x08
 
-#define FIFO_SIZE 65536
-#define FIFO_MASK (FIFO_SIZE - 1)
-#define FIFO_ENTRY_SIZE (1 << 31)
-
-#define FIFO_ENTRIES (tgui->fifo_write_idx - tgui->fifo_read_idx)
-#define FIFO_FULL    ((tgui->fifo_write_idx - tgui->fifo_read_idx) >= FIFO_SIZE)
-#define FIFO_EMPTY   (tgui->fifo_read_idx == tgui->fifo_write_idx)
+#define FIFO_ENTRIES ACCEL_FIFO_ENTRIES(&tgui->fifo)
+#define FIFO_FULL    ACCEL_FIFO_FULL(&tgui->fifo)
+#define FIFO_EMPTY   ACCEL_FIFO_EMPTY(&tgui->fifo)
 
 #define FIFO_TYPE 0xff000000
 #define FIFO_ADDR 0x00ffffff
@@ -75,12 +72,6 @@ enum
         FIFO_WRITE_FB_LONG = (0x06 << 24)
 };
 
-typedef struct
-{
-        uint32_t addr_type;
-        uint32_t val;
-} fifo_entry_t;
-
 typedef struct tgui_t
 {
         mem_mapping_t linear_mapping;
@@ -134,12 +125,7 @@ typedef struct tgui_t
         
         uint32_t vram_size, vram_mask;
 
-        fifo_entry_t fifo[FIFO_SIZE];
-        volatile int fifo_read_idx, fifo_write_idx;
-
-        thread_t *fifo_thread;
-        event_t *wake_fifo_thread;
-        event_t *fifo_not_full_event;
+        accel_fifo_t fifo;
         
         int blitter_busy;
         uint64_t blitter_time;
@@ -758,9 +744,7 @@ static void *tgui_init(char *bios_fn, int type, int mem_size)
         if (tgui->type >= TGUI_9440)
                 pci_add(tgui_pci_read, tgui_pci_write, tgui);
 
-        tgui->wake_fifo_thread = thread_create_event();
-        tgui->fifo_not_full_event = thread_create_event();
-        tgui->fifo_thread = thread_create(fifo_thread, tgui);
+        accel_fifo_init(&tgui->fifo, fifo_thread, tgui);
 
         return tgui;
 }
@@ -804,9 +788,7 @@ void tgui_close(void *p)
         
         svga_close(&tgui->svga);
         
-        thread_kill(tgui->fifo_thread);
-        thread_destroy_event(tgui->wake_fifo_thread);
-        thread_destroy_event(tgui->fifo_not_full_event);
+        accel_fifo_close(&tgui->fifo);
 
         free(tgui);
 }
@@ -1476,15 +1458,13 @@ static void fifo_thread(void *param)
         
         while (1)
         {
-                thread_set_event(tgui->fifo_not_full_event);
-                thread_wait_event(tgui->wake_fifo_thread, -1);
-                thread_reset_event(tgui->wake_fifo_thread);
+                accel_fifo_wait_for_work(&tgui->fifo);
                 tgui->blitter_busy = 1;
                 while (!FIFO_EMPTY)
                 {
                         uint64_t start_time = timer_read();
                         uint64_t end_time;
-                        fifo_entry_t *fifo = &tgui->fifo[tgui->fifo_read_idx & FIFO_MASK];
+                        accel_fifo_entry_t *fifo = ACCEL_FIFO_HEAD(&tgui->fifo);
 
                         switch (fifo->addr_type & FIFO_TYPE)
                         {
@@ -1502,11 +1482,8 @@ static void fifo_thread(void *param)
                                 break;
                         }
                                                 
-                        tgui->fifo_read_idx++;
                         fifo->addr_type = FIFO_INVALID;
-
-                        if (FIFO_ENTRIES > 0xe000)
-                                thread_set_event(tgui->fifo_not_full_event);
+                        accel_fifo_retire(&tgui->fifo);
 
                         end_time = timer_read();
                         tgui->blitter_time += end_time - start_time;
@@ -1517,38 +1494,17 @@ static void fifo_thread(void *param)
 
 static inline void wake_fifo_thread(tgui_t *tgui)
 {
-        thread_set_event(tgui->wake_fifo_thread); /*Wake up FIFO thread if moving from idle*/
+        accel_fifo_wake(&tgui->fifo);
 }
 
 static void tgui_wait_fifo_idle(tgui_t *tgui)
 {
-        while (!FIFO_EMPTY)
-        {
-                wake_fifo_thread(tgui);
-                thread_wait_event(tgui->fifo_not_full_event, 1);
-        }
+        accel_fifo_wait_idle(&tgui->fifo);
 }
 
 static void tgui_queue(tgui_t *tgui, uint32_t addr, uint32_t val, uint32_t type)
 {
-        fifo_entry_t *fifo = &tgui->fifo[tgui->fifo_write_idx & FIFO_MASK];
-
-        if (FIFO_FULL)
-        {
-                thread_reset_event(tgui->fifo_not_full_event);
-                if (FIFO_FULL)
-                {
-                        thread_wait_event(tgui->fifo_not_full_event, -1); /*Wait for room in ringbuffer*/
-                }
-        }
-
-        fifo->val = val;
-        fifo->addr_type = (addr & FIFO_ADDR) | type;
-
-        tgui->fifo_write_idx++;
-        
-        if (FIFO_ENTRIES > 0xe000 || FIFO_ENTRIES < 8)
-                wake_fifo_thread(tgui);
+        accel_fifo_queue(&tgui->fifo, (addr & FIFO_ADDR) | type, val);
 }
 
 
@@ -0,0 +1,66 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ibm.h"
+#include "paths.h"
+#include "vid_trace.h"
+
+vid_trace_t *vid_trace_open(const char *fn, int card, const uint32_t *config, int nr_config)
+{
+        vid_trace_header_t header;
+        vid_trace_t *trace;
+        char path[1024];
+        FILE *f;
+
+        snprintf(path, sizeof(path), "%s%s", logs_path, fn);
+        f = fopen(path, "wb");
+        if (!f)
+        {
+                pclog("vid_trace_open : can't create %s\n", path);
+                return NULL;
+        }
+        pclog("vid_trace_open : recording to %s\n", path);
+
+        memset(&header, 0, sizeof(header));
+        header.magic = VID_TRACE_MAGIC;
+        header.version = VID_TRACE_VERSION;
+        header.card = card;
+        memcpy(header.config, config, nr_config * sizeof(uint32_t));
+        fwrite(&header, sizeof(header), 1, f);
+
+        trace = malloc(sizeof(vid_trace_t));
+        trace->f = f;
+        trace->nr_records = 0;
+
+        return trace;
+}
+
+void vid_trace_flush(vid_trace_t *trace)
+{
+        fwrite(trace->records, sizeof(vid_trace_record_t), trace->nr_records, trace->f);
+        trace->nr_records = 0;
+}
+
+void vid_trace_close(vid_trace_t *trace)
+{
+        vid_trace_flush(trace);
+        fclose(trace->f);
+        free(trace);
+}
+
+FILE *vid_trace_open_replay(const char *fn, vid_trace_header_t *header)
+{
+        FILE *f = fopen(fn, "rb");
+
+        if (!f)
+                return NULL;
+
+        if (fread(header, sizeof(vid_trace_header_t), 1, f) != 1 ||
+            header->magic != VID_TRACE_MAGIC || header->version != VID_TRACE_VERSION)
+        {
+                fclose(f);
+                return NULL;
+        }
+
+        return f;
+}
@@ -0,0 +1,78 @@
+/*Capture of the command stream sent to a 3D accelerator, so a workload can be
+  replayed and benchmarked without booting the guest.
+
+  A trace is a vid_trace_header_t followed by 8 byte records in host byte
+  order. Each record is an address with the record type in the top 8 bits,
+  followed by a value. Types below VID_TRACE_GENERIC are the card's own FIFO
+  entry types, for cards that are traced at their command FIFO.*/
+#ifndef _VID_TRACE_H_
+#define _VID_TRACE_H_
+
+#define VID_TRACE_MAGIC   0x43525456 /*"VTRC"*/
+#define VID_TRACE_VERSION 1
+
+enum
+{
+        VID_TRACE_VOODOO = 1,   /*config = type, framebuffer memory, texture memory, bilinear*/
+        VID_TRACE_VIRGE,        /*config = memory size, bilinear, dithering*/
+        VID_TRACE_MYSTIQUE      /*config = memory size*/
+};
+
+#define VID_TRACE_GENERIC   (0xf0 << 24)
+#define VID_TRACE_WRITE_W   (0xf0 << 24) /*Write to the card's memory space*/
+#define VID_TRACE_WRITE_L   (0xf1 << 24)
+#define VID_TRACE_READ_W    (0xf2 << 24) /*Read from the card's memory space that waits for the card to go idle*/
+#define VID_TRACE_READ_L    (0xf3 << 24)
+#define VID_TRACE_PCI_WRITE (0xf4 << 24) /*PCI config space write, val is the byte written*/
+#define VID_TRACE_RETRACE   (0xf5 << 24) /*Vertical retrace, where the card completes buffer swaps*/
+
+#define VID_TRACE_TYPE 0xff000000
+#define VID_TRACE_ADDR 0x00ffffff
+
+#define VID_TRACE_MAX_CONFIG 4
+
+typedef struct vid_trace_header_t
+{
+        uint32_t magic;
+        uint32_t version;
+        uint32_t card;
+        uint32_t config[VID_TRACE_MAX_CONFIG];
+} vid_trace_header_t;
+
+typedef struct vid_trace_record_t
+{
+        uint32_t addr_type;
+        uint32_t val;
+} vid_trace_record_t;
+
+#define VID_TRACE_BUFFER_SIZE 4096
+
+typedef struct vid_trace_t
+{
+        FILE *f;
+        int nr_records;
+        vid_trace_record_t records[VID_TRACE_BUFFER_SIZE];
+} vid_trace_t;
+
+/*Create a trace in the logs directory. Returns NULL if the file can't be
+  created*/
+vid_trace_t *vid_trace_open(const char *fn, int card, const uint32_t *config, int nr_config);
+void vid_trace_close(vid_trace_t *trace);
+void vid_trace_flush(vid_trace_t *trace);
+
+/*Record a write. Must only be called from one thread at a time*/
+static inline void vid_trace_record(vid_trace_t *trace, uint32_t addr_type, uint32_t val)
+{
+        vid_trace_record_t *record = &trace->records[trace->nr_records++];
+
+        record->addr_type = addr_type;
+        record->val = val;
+        if (trace->nr_records == VID_TRACE_BUFFER_SIZE)
+                vid_trace_flush(trace);
+}
+
+/*Open a trace for replay, checking the header is valid. Returns NULL on
+  failure*/
+FILE *vid_trace_open_replay(const char *fn, vid_trace_header_t *header);
+
+#endif /*_VID_TRACE_H_*/
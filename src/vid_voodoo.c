@@ -9,6 +9,7 @@
 #include "timer.h"
 #include "video.h"
 #include "vid_svga.h"
+#include "vid_trace.h"
 #include "vid_voodoo.h"
 #include "vid_voodoo_common.h"
 #include "vid_voodoo_blitter.h"
@@ -119,6 +120,9 @@ static uint16_t voodoo_readw(uint32_t addr, void *p)
         
         if ((addr & 0xc00000) == 0x400000) /*Framebuffer*/
         {
+                if (voodoo->trace)
+                        vid_trace_record(voodoo->trace, addr | VID_TRACE_READ_W, 0);
+
                 if (SLI_ENABLED)
                 {
                         voodoo_set_t *set = voodoo->set;
@@ -161,6 +165,9 @@ static uint32_t voodoo_readl(uint32_t addr, void *p)
         }
         else if (addr & 0x400000) /*Framebuffer*/
         {
+                if (voodoo->trace)
+                        vid_trace_record(voodoo->trace, addr | VID_TRACE_READ_L, 0);
+
                 if (SLI_ENABLED)
                 {
                         voodoo_set_t *set = voodoo->set;
@@ -369,6 +376,9 @@ static void voodoo_writew(uint32_t addr, uint16_t val, void *p)
         
         cycles -= voodoo->write_time;
 
+        if (voodoo->trace)
+                vid_trace_record(voodoo->trace, addr | VID_TRACE_WRITE_W, val);
+
         if ((addr & 0xc00000) == 0x400000) /*Framebuffer*/
                 voodoo_queue_command(voodoo, addr | FIFO_WRITEW_FB, val);
 }
@@ -387,6 +397,9 @@ static void voodoo_writel(uint32_t addr, uint32_t val, void *p)
                 cycles -= voodoo->write_time;
         voodoo->last_write_addr = addr;
 
+        if (voodoo->trace)
+                vid_trace_record(voodoo->trace, addr | VID_TRACE_WRITE_L, val);
+
         if (addr & 0x800000) /*Texture*/
         {
                 voodoo->tex_count++;
@@ -793,6 +806,9 @@ void voodoo_pci_write(int func, int addr, uint8_t val, void *p)
 
 //        pclog("Voodoo PCI write %04X %02X PC=%08x\n", addr, val, cpu_state.pc);
 
+        if (voodoo->trace)
+                vid_trace_record(voodoo->trace, addr | VID_TRACE_PCI_WRITE, val);
+
         switch (addr)
         {
                 case 0x04:
@@ -1261,6 +1277,16 @@ void *voodoo_init()
         if (voodoo_set->nr_cards == 2)
                 voodoo_set->voodoos[1]->tmuConfig = tmuConfig;
 
+        /*Tracing is from power on, so the trace holds all the state needed to
+          replay it. SLI isn't supported*/
+        if (device_get_config_int("trace") && voodoo_set->nr_cards == 1)
+        {
+                voodoo_t *voodoo = voodoo_set->voodoos[0];
+                uint32_t config[4] = {type, voodoo->fb_size, voodoo->texture_size, voodoo->bilinear_enabled};
+
+                voodoo->trace = vid_trace_open("voodoo.trc", VID_TRACE_VOODOO, config, 4);
+        }
+
         mem_mapping_add(&voodoo_set->snoop_mapping, 0, 0, NULL, voodoo_snoop_readw, voodoo_snoop_readl, NULL, voodoo_snoop_writew, voodoo_snoop_writel,     NULL, MEM_MAPPING_EXTERNAL, voodoo_set);
                 
         return voodoo_set;
@@ -1288,6 +1314,9 @@ void voodoo_card_close(voodoo_t *voodoo)
         }
 #endif
 
+        if (voodoo->trace)
+                vid_trace_close(voodoo->trace);
+
         thread_kill(voodoo->fifo_thread);
         thread_kill(voodoo->render_thread[0]);
         if (voodoo->render_threads >= 2)
@@ -1443,6 +1472,12 @@ static device_config_t voodoo_config[] =
                 .type = CONFIG_BINARY,
                 .default_int = 0
         },
+        {
+                .name = "trace",
+                .description = "Record command trace to logs directory",
+                .type = CONFIG_BINARY,
+                .default_int = 0
+        },
 #ifndef NO_CODEGEN
         {
                 .name = "recompiler",
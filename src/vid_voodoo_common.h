@@ -159,6 +159,11 @@ typedef struct voodoo_params_t
 
         int col_tiled, aux_tiled;
         int row_width, aux_row_width;
+
+        /*Derived from the above once per triangle by voodoo_queue_triangle(),
+          rather than by every render thread*/
+        int32_t dxAB, dxAC, dxBC;
+        int lod[2], lod_min[2], lod_max[2];
 } voodoo_params_t;
 
 typedef struct texture_t
@@ -175,6 +180,7 @@ typedef struct texture_t
 typedef struct vert_t
 {
         float sVx, sVy;
+        /*voodoo_triangle_setup() treats sRed - sT1 as an array*/
         float sRed, sGreen, sBlue, sAlpha;
         float sVz, sWb;
         float sW0, sS0, sT0;
@@ -460,11 +466,14 @@ typedef struct voodoo_t
 
         pc_timer_t wake_timer;
 
+        struct vid_trace_t *trace; /*Command stream capture, NULL if not recording*/
+
         /* screen filter tables */
         uint8_t thefilter[256][256];
         uint8_t thefilterg[256][256];
         uint8_t thefilterb[256][256];
         uint16_t purpleline[256][3];
+        int filter_cap_v1[3]; /*B, G, R thresholds for the V1 filter*/
 
         texture_t texture_cache[2][TEX_CACHE_MAX];
         uint8_t texture_present[2][16384];
@@ -4,6 +4,7 @@
 #include "thread.h"
 #include "video.h"
 #include "vid_svga.h"
+#include "vid_trace.h"
 #include "vid_voodoo.h"
 #include "vid_voodoo_common.h"
 #include "vid_voodoo_display.h"
@@ -190,6 +191,10 @@ void voodoo_generate_filter_v1(voodoo_t *voodoo)
                         lined = 255;
                 voodoo->purpleline[g][1] = lined;
         }
+
+        voodoo->filter_cap_v1[0] = FILTCAPB;
+        voodoo->filter_cap_v1[1] = FILTCAPG;
+        voodoo->filter_cap_v1[2] = FILTCAP;
 }
 
 void voodoo_generate_filter_v2(voodoo_t *voodoo)
@@ -317,69 +322,70 @@ void voodoo_threshold_check(voodoo_t *voodoo)
 	}
 }
 
-static void voodoo_filterline_v1(voodoo_t *voodoo, uint8_t *fil, int column, uint16_t *src, int line)
+/*The V1 filter tables reduce to g + (clamp(h - g, -cap, cap) >> 1). Doing the
+  arithmetic directly on one colour channel at a time lets the compiler
+  vectorise each pass, rather than doing three table lookups per pixel*/
+static void voodoo_filterpass_v1(uint8_t *dst, const uint8_t *cur, const uint8_t *next, int count, int cap)
 {
-	int x;
+        int x;
 
-	// Scratchpad for avoiding feedback streaks
-        uint8_t fil3[(voodoo->h_disp) * 3];
+        for (x = 0; x < count; x++)
+        {
+                int diff = next[x] - cur[x];
+
+                if (diff > cap)
+                        diff = cap;
+                if (diff < -cap)
+                        diff = -cap;
+                dst[x] = cur[x] + (diff >> 1);
+        }
+}
+
+static void voodoo_filterline_v1(voodoo_t *voodoo, uint32_t *p, int column, uint16_t *src, int line)
+{
+	int x, c;
+
+        /* Planar B, G, R, plus scratchpad for avoiding feedback streaks */
+        uint8_t fil[3][column];
+        uint8_t fil3[3][column];
 
 	/* 16 to 32-bit */
         for (x=0; x<column;x++)
         {
-		fil[x*3] 	=	((src[x] & 31) << 3);
-		fil[x*3+1] 	=	(((src[x] >> 5) & 63) << 2);
- 		fil[x*3+2] 	=	(((src[x] >> 11) & 31) << 3);
-
-		// Copy to our scratchpads
- 		fil3[x*3+0] 	= fil[x*3+0];
- 		fil3[x*3+1] 	= fil[x*3+1];
- 		fil3[x*3+2] 	= fil[x*3+2];
+		fil[0][x] = ((src[x] & 31) << 3);
+		fil[1][x] = (((src[x] >> 5) & 63) << 2);
+		fil[2][x] = (((src[x] >> 11) & 31) << 3);
         }
 
+        /* Only the first pixel of the scratchpad is read before being written */
+        for (c = 0; c < 3; c++)
+                fil3[c][0] = fil[c][0];
 
-        /* lines */
-
+        /* lines - purpleline adds 4 to blue and red, which can't overflow
+           here as neither goes above 0xf8 */
         if (line & 1)
         {
                 for (x=0; x<column;x++)
                 {
-                        fil[x*3] = voodoo->purpleline[fil[x*3]][0];
-                        fil[x*3+1] = voodoo->purpleline[fil[x*3+1]][1];
-                        fil[x*3+2] = voodoo->purpleline[fil[x*3+2]][2];
+                        fil[0][x] += 4;
+                        fil[2][x] += 4;
                 }
         }
 
-
         /* filtering time */
 
-        for (x=1; x<column;x++)
-        {
-                fil3[(x)*3]   = voodoo->thefilterb[fil[x*3]][fil[	(x-1)		*3]];
-                fil3[(x)*3+1] = voodoo->thefilterg[fil[x*3+1]][fil[	(x-1)		*3+1]];
-                fil3[(x)*3+2] = voodoo->thefilter[fil[x*3+2]][fil[	(x-1)		*3+2]];
-        }
-
-        for (x=1; x<column;x++)
+        for (c = 0; c < 3; c++)
         {
-                fil[(x)*3]   = voodoo->thefilterb[fil3[x*3]][fil3[	(x-1)		*3]];
-                fil[(x)*3+1] = voodoo->thefilterg[fil3[x*3+1]][fil3[	(x-1)		*3+1]];
-                fil[(x)*3+2] = voodoo->thefilter[fil3[x*3+2]][fil3[	(x-1)		*3+2]];
-        }
+                int cap = voodoo->filter_cap_v1[c];
 
-        for (x=1; x<column;x++)
-        {
-                fil3[(x)*3]   = voodoo->thefilterb[fil[x*3]][fil[	(x-1)		*3]];
-                fil3[(x)*3+1] = voodoo->thefilterg[fil[x*3+1]][fil[	(x-1)		*3+1]];
-                fil3[(x)*3+2] = voodoo->thefilter[fil[x*3+2]][fil[	(x-1)		*3+2]];
+                voodoo_filterpass_v1(&fil3[c][1], &fil[c][1], &fil[c][0], column-1, cap);
+                voodoo_filterpass_v1(&fil[c][1], &fil3[c][1], &fil3[c][0], column-1, cap);
+                voodoo_filterpass_v1(&fil3[c][1], &fil[c][1], &fil[c][0], column-1, cap);
+                voodoo_filterpass_v1(&fil[c][0], &fil3[c][0], &fil3[c][1], column-1, cap);
         }
 
-        for (x=0; x<column-1;x++)
-        {
-                fil[(x)*3]   = voodoo->thefilterb[fil3[x*3]][fil3[	(x+1)		*3]];
-                fil[(x)*3+1] = voodoo->thefilterg[fil3[x*3+1]][fil3[	(x+1)		*3+1]];
-                fil[(x)*3+2] = voodoo->thefilter[fil3[x*3+2]][fil3[	(x+1)		*3+2]];
-        }
+        for (x = 0; x < column; x++)
+                p[x] = (voodoo->clutData256[fil[0][x]].b << 0 | voodoo->clutData256[fil[1][x]].g << 8 | voodoo->clutData256[fil[2][x]].r << 16);
 }
 
 
@@ -447,6 +453,28 @@ static void voodoo_filterline_v2(voodoo_t *voodoo, uint8_t *fil, int column, uin
 	fil3[(column-1)*3+2] = voodoo->thefilter	[fil[(column-1)*3+2]][(((src[column] >> 11) & 31) << 3)];
 }
 
+/*Complete a pending buffer swap on a single card, if enough retraces have
+  passed since the last one*/
+void voodoo_retrace_swap(voodoo_t *voodoo)
+{
+        thread_lock_mutex(voodoo->swap_mutex);
+        if (voodoo->swap_pending && (voodoo->retrace_count > voodoo->swap_interval))
+        {
+                voodoo->front_offset = voodoo->swap_offset;
+                if (voodoo->swap_count > 0)
+                        voodoo->swap_count--;
+                voodoo->swap_pending = 0;
+                thread_unlock_mutex(voodoo->swap_mutex);
+
+                memset(voodoo->dirty_line, 1, 1024);
+                voodoo->retrace_count = 0;
+                thread_set_event(voodoo->wake_fifo_thread);
+                voodoo->frame_count++;
+        }
+        else
+                thread_unlock_mutex(voodoo->swap_mutex);
+}
+
 void voodoo_callback(void *p)
 {
         voodoo_t *voodoo = (voodoo_t *)p;
@@ -493,20 +521,19 @@ void voodoo_callback(void *p)
                                 if (voodoo->line > voodoo->dirty_line_high)
                                         voodoo->dirty_line_high = voodoo->line;
 
-                                if (voodoo->scrfilter && voodoo->scrfilterEnabled)
+                                if (voodoo->scrfilter && voodoo->scrfilterEnabled && voodoo->type == VOODOO_2)
                                 {
                                         uint8_t fil[(voodoo->h_disp) * 3];              /* interleaved 24-bit RGB */
 
-                			if (voodoo->type == VOODOO_2)
-	                                        voodoo_filterline_v2(voodoo, fil, voodoo->h_disp, src, voodoo->line);
-					else
-                                        	voodoo_filterline_v1(voodoo, fil, voodoo->h_disp, src, voodoo->line);
+                                        voodoo_filterline_v2(voodoo, fil, voodoo->h_disp, src, voodoo->line);
 
                                         for (x = 0; x < voodoo->h_disp; x++)
                                         {
                                                 p[x] = (voodoo->clutData256[fil[x*3]].b << 0 | voodoo->clutData256[fil[x*3+1]].g << 8 | voodoo->clutData256[fil[x*3+2]].r << 16);
                                         }
                                 }
+                                else if (voodoo->scrfilter && voodoo->scrfilterEnabled)
+                                        voodoo_filterline_v1(voodoo, p, voodoo->h_disp, src, voodoo->line);
                                 else
                                 {
                                         for (x = 0; x < voodoo->h_disp; x++)
@@ -522,6 +549,8 @@ skip_draw:
         {
 //                pclog("retrace %i %i %08x %i\n", voodoo->retrace_count, voodoo->swap_interval, voodoo->swap_offset, voodoo->swap_pending);
                 voodoo->retrace_count++;
+                if (voodoo->trace)
+                        vid_trace_record(voodoo->trace, VID_TRACE_RETRACE, 0);
                 if (SLI_ENABLED && (voodoo->fbiInit2 & FBIINIT2_SWAP_ALGORITHM_MASK) == FBIINIT2_SWAP_ALGORITHM_SLI_SYNC)
                 {
                         if (voodoo == voodoo->set->voodoos[0])
@@ -559,24 +588,7 @@ skip_draw:
                         }
                 }
                 else
-                {
-                        thread_lock_mutex(voodoo->swap_mutex);
-                        if (voodoo->swap_pending && (voodoo->retrace_count > voodoo->swap_interval))
-                        {
-                                voodoo->front_offset = voodoo->swap_offset;
-                                if (voodoo->swap_count > 0)
-                                        voodoo->swap_count--;
-                                voodoo->swap_pending = 0;
-                                thread_unlock_mutex(voodoo->swap_mutex);
-
-                                memset(voodoo->dirty_line, 1, 1024);
-                                voodoo->retrace_count = 0;
-                                thread_set_event(voodoo->wake_fifo_thread);
-                                voodoo->frame_count++;
-                        }
-                        else
-                                thread_unlock_mutex(voodoo->swap_mutex);
-                }
+                        voodoo_retrace_swap(voodoo);
                 voodoo->v_retrace = 1;
         }
         voodoo->line++;
@@ -3,4 +3,5 @@ void voodoo_pixelclock_update(voodoo_t *voodoo);
 void voodoo_generate_filter_v1(voodoo_t *voodoo);
 void voodoo_generate_filter_v2(voodoo_t *voodoo);
 void voodoo_threshold_check(voodoo_t *voodoo);
+void voodoo_retrace_swap(voodoo_t *voodoo);
 void voodoo_callback(void *p);
@@ -445,3 +445,60 @@ skip_pixel:
                 }
         }
 }
+
+/*Write count consecutive 32-bit LFB words starting at addr. If the pixel
+  pipeline is bypassed, the run stays within one row and the data would be
+  stored unmodified (RGB565 without dithering, or depth), the whole run is
+  copied straight into the framebuffer.*/
+void voodoo_fb_writel_run(uint32_t addr, const uint32_t *val, int count, void *p)
+{
+        voodoo_t *voodoo = (voodoo_t *)p;
+        voodoo_params_t *params = &voodoo->params;
+        int format = voodoo->lfbMode & LFB_FORMAT_MASK;
+        uint32_t row_mask = (voodoo->type >= VOODOO_BANSHEE) ? 0xfff : 0x7ff;
+        int c;
+
+        if (!(voodoo->lfbMode & 0x100) && !(addr & 3) && ((addr & row_mask) + count*4) <= row_mask + 1 &&
+            ((format == LFB_FORMAT_RGB565 && !dither && !voodoo->col_tiled) ||
+             (format == LFB_FORMAT_DEPTH && !voodoo->aux_tiled)))
+        {
+                int x, y;
+                uint32_t write_addr;
+
+                if (voodoo->type >= VOODOO_BANSHEE)
+                {
+                        x = addr & 0xffe;
+                        y = (addr >> 12) & 0x3ff;
+                }
+                else
+                {
+                        x = addr & 0x7fe;
+                        y = (addr >> 11) & 0x3ff;
+                }
+
+                if (SLI_ENABLED)
+                {
+                        if ((!(voodoo->initEnable & INITENABLE_SLI_MASTER_SLAVE) && (y & 1)) ||
+                            ((voodoo->initEnable & INITENABLE_SLI_MASTER_SLAVE) && !(y & 1)))
+                                return;
+                        y >>= 1;
+                }
+
+                if (format == LFB_FORMAT_DEPTH)
+                        write_addr = voodoo->params.aux_offset + x + (y * voodoo->row_width);
+                else
+                        write_addr = voodoo->fb_write_offset + x + (y * voodoo->row_width);
+
+                if (write_addr + count*4 - 1 <= voodoo->fb_mask)
+                {
+                        if (voodoo->fb_write_offset == voodoo->params.front_offset && y < 2048)
+                                voodoo->dirty_line[y] = 1;
+
+                        memcpy(&voodoo->fb_mem[write_addr], val, count*4);
+                        return;
+                }
+        }
+
+        for (c = 0; c < count; c++)
+                voodoo_fb_writel((addr + c*4) & 0xffffff, val[c], p);
+}
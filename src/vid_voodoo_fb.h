@@ -2,3 +2,4 @@ uint16_t voodoo_fb_readw(uint32_t addr, void *p);
 uint32_t voodoo_fb_readl(uint32_t addr, void *p);
 void voodoo_fb_writew(uint32_t addr, uint16_t val, void *p);
 void voodoo_fb_writel(uint32_t addr, uint32_t val, void *p);
+void voodoo_fb_writel_run(uint32_t addr, const uint32_t *val, int count, void *p);
@@ -17,6 +17,9 @@
 #include "vid_voodoo_texture.h"
 
 #define WAKE_DELAY (TIMER_USEC * 100)
+
+/*Maximum number of LFB writes combined into one span - one row on Banshee*/
+#define LFB_RUN_MAX 1024
 void voodoo_wake_fifo_thread(voodoo_t *voodoo)
 {
         if (!timer_is_enabled(&voodoo->wake_timer))
@@ -203,9 +206,26 @@ void voodoo_fifo_thread(void *param)
                                 voodoo_wait_for_render_thread_idle(voodoo);
                                 while ((fifo->addr_type & FIFO_TYPE) == FIFO_WRITEL_FB)
                                 {
-                                        voodoo_fb_writel(fifo->addr_type & FIFO_ADDR, fifo->val, voodoo);
-                                        fifo->addr_type = FIFO_INVALID;
-                                        voodoo->fifo_read_idx++;
+                                        uint32_t run_addr = fifo->addr_type & FIFO_ADDR;
+                                        uint32_t run_val[LFB_RUN_MAX];
+                                        int c, run_len = 0;
+
+                                        /*Gather writes to consecutive addresses so they can be
+                                          written as one span. Entries are only retired once
+                                          written, so voodoo_flush() can't return early*/
+                                        do
+                                        {
+                                                run_val[run_len++] = fifo->val;
+                                                if (run_len == LFB_RUN_MAX || voodoo->fifo_read_idx + run_len == voodoo->fifo_write_idx)
+                                                        break;
+                                                fifo = &voodoo->fifo[(voodoo->fifo_read_idx + run_len) & FIFO_MASK];
+                                        } while (fifo->addr_type == (FIFO_WRITEL_FB | ((run_addr + run_len*4) & FIFO_ADDR)));
+
+                                        voodoo_fb_writel_run(run_addr, run_val, run_len, voodoo);
+
+                                        for (c = 0; c < run_len; c++)
+                                                voodoo->fifo[(voodoo->fifo_read_idx + c) & FIFO_MASK].addr_type = FIFO_INVALID;
+                                        voodoo->fifo_read_idx += run_len;
                                         if (FIFO_EMPTY)
                                                 break;
                                         fifo = &voodoo->fifo[voodoo->fifo_read_idx & FIFO_MASK];
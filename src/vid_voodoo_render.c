@@ -1411,11 +1411,6 @@ void voodoo_triangle(voodoo_t *voodoo, voodoo_params_t *params, int odd_even)
         int vertexCy_adjusted;
         int dx, dy;
 
-        uint64_t tempdx, tempdy;
-        uint64_t tempLOD;
-        int LOD;
-        int lodbias;
-
         voodoo->tri_count++;
 
         dx = 8 - (params->vertexAx & 0xf);
@@ -1485,27 +1480,14 @@ void voodoo_triangle(voodoo_t *voodoo, voodoo_params_t *params, int odd_even)
         vertexAy_adjusted = (state.vertexAy+7) >> 4;
         vertexCy_adjusted = (state.vertexCy+7) >> 4;
 
-        if (state.vertexBy - state.vertexAy)
-                state.dxAB = (int)((((int64_t)state.vertexBx << 12) - ((int64_t)state.vertexAx << 12)) << 4) / (int)(state.vertexBy - state.vertexAy);
-        else
-                state.dxAB = 0;
-        if (state.vertexCy - state.vertexAy)
-                state.dxAC = (int)((((int64_t)state.vertexCx << 12) - ((int64_t)state.vertexAx << 12)) << 4) / (int)(state.vertexCy - state.vertexAy);
-        else
-                state.dxAC = 0;
-        if (state.vertexCy - state.vertexBy)
-                state.dxBC = (int)((((int64_t)state.vertexCx << 12) - ((int64_t)state.vertexBx << 12)) << 4) / (int)(state.vertexCy - state.vertexBy);
-        else
-                state.dxBC = 0;
+        state.dxAB = params->dxAB;
+        state.dxAC = params->dxAC;
+        state.dxBC = params->dxBC;
 
-        state.lod_min[0] = (params->tLOD[0] & 0x3f) << 6;
-        state.lod_max[0] = ((params->tLOD[0] >> 6) & 0x3f) << 6;
-        if (state.lod_max[0] > 0x800)
-                state.lod_max[0] = 0x800;
-        state.lod_min[1] = (params->tLOD[1] & 0x3f) << 6;
-        state.lod_max[1] = ((params->tLOD[1] >> 6) & 0x3f) << 6;
-        if (state.lod_max[1] > 0x800)
-                state.lod_max[1] = 0x800;
+        state.lod_min[0] = params->lod_min[0];
+        state.lod_max[0] = params->lod_max[0];
+        state.lod_min[1] = params->lod_min[1];
+        state.lod_max[1] = params->lod_max[1];
 
         state.xstart = state.xend = state.vertexAx << 8;
         state.xdir = params->sign ? -1 : 1;
@@ -1514,39 +1496,8 @@ void voodoo_triangle(voodoo_t *voodoo, voodoo_params_t *params, int odd_even)
         state.ydir = 1;
 
 
-        tempdx = (params->tmu[0].dSdX >> 14) * (params->tmu[0].dSdX >> 14) + (params->tmu[0].dTdX >> 14) * (params->tmu[0].dTdX >> 14);
-        tempdy = (params->tmu[0].dSdY >> 14) * (params->tmu[0].dSdY >> 14) + (params->tmu[0].dTdY >> 14) * (params->tmu[0].dTdY >> 14);
-
-        if (tempdx > tempdy)
-                tempLOD = tempdx;
-        else
-                tempLOD = tempdy;
-
-        LOD = (int)(log2((double)tempLOD / (double)(1ULL << 36)) * 256);
-        LOD >>= 2;
-
-        lodbias = (params->tLOD[0] >> 12) & 0x3f;
-        if (lodbias & 0x20)
-                lodbias |= ~0x3f;
-        state.tmu[0].lod = LOD + (lodbias << 6);
-
-
-        tempdx = (params->tmu[1].dSdX >> 14) * (params->tmu[1].dSdX >> 14) + (params->tmu[1].dTdX >> 14) * (params->tmu[1].dTdX >> 14);
-        tempdy = (params->tmu[1].dSdY >> 14) * (params->tmu[1].dSdY >> 14) + (params->tmu[1].dTdY >> 14) * (params->tmu[1].dTdY >> 14);
-
-        if (tempdx > tempdy)
-                tempLOD = tempdx;
-        else
-                tempLOD = tempdy;
-
-        LOD = (int)(log2((double)tempLOD / (double)(1ULL << 36)) * 256);
-        LOD >>= 2;
-
-        lodbias = (params->tLOD[1] >> 12) & 0x3f;
-        if (lodbias & 0x20)
-                lodbias |= ~0x3f;
-        state.tmu[1].lod = LOD + (lodbias << 6);
-
+        state.tmu[0].lod = params->lod[0];
+        state.tmu[1].lod = params->lod[1];
 
         voodoo_half_triangle(voodoo, params, &state, vertexAy_adjusted, vertexCy_adjusted, odd_even);
 }
@@ -1601,6 +1552,62 @@ void voodoo_render_thread_4(void *param)
         render_thread(param, 3);
 }
 
+/*Work out the parts of triangle setup that don't depend on which render thread
+  draws the triangle*/
+static void voodoo_triangle_prepare(voodoo_params_t *params)
+{
+        int32_t vertexAx, vertexAy, vertexBx, vertexBy, vertexCx, vertexCy;
+        uint64_t tempdx, tempdy;
+        uint64_t tempLOD;
+        int LOD;
+        int lodbias;
+        int tmu;
+
+        vertexAx = (int32_t)(int16_t)params->vertexAx;
+        vertexAy = (int32_t)(int16_t)params->vertexAy;
+        vertexBx = (int32_t)(int16_t)params->vertexBx;
+        vertexBy = (int32_t)(int16_t)params->vertexBy;
+        vertexCx = (int32_t)(int16_t)params->vertexCx;
+        vertexCy = (int32_t)(int16_t)params->vertexCy;
+
+        if (vertexBy - vertexAy)
+                params->dxAB = (int)((((int64_t)vertexBx << 12) - ((int64_t)vertexAx << 12)) << 4) / (int)(vertexBy - vertexAy);
+        else
+                params->dxAB = 0;
+        if (vertexCy - vertexAy)
+                params->dxAC = (int)((((int64_t)vertexCx << 12) - ((int64_t)vertexAx << 12)) << 4) / (int)(vertexCy - vertexAy);
+        else
+                params->dxAC = 0;
+        if (vertexCy - vertexBy)
+                params->dxBC = (int)((((int64_t)vertexCx << 12) - ((int64_t)vertexBx << 12)) << 4) / (int)(vertexCy - vertexBy);
+        else
+                params->dxBC = 0;
+
+        for (tmu = 0; tmu < 2; tmu++)
+        {
+                params->lod_min[tmu] = (params->tLOD[tmu] & 0x3f) << 6;
+                params->lod_max[tmu] = ((params->tLOD[tmu] >> 6) & 0x3f) << 6;
+                if (params->lod_max[tmu] > 0x800)
+                        params->lod_max[tmu] = 0x800;
+
+                tempdx = (params->tmu[tmu].dSdX >> 14) * (params->tmu[tmu].dSdX >> 14) + (params->tmu[tmu].dTdX >> 14) * (params->tmu[tmu].dTdX >> 14);
+                tempdy = (params->tmu[tmu].dSdY >> 14) * (params->tmu[tmu].dSdY >> 14) + (params->tmu[tmu].dTdY >> 14) * (params->tmu[tmu].dTdY >> 14);
+
+                if (tempdx > tempdy)
+                        tempLOD = tempdx;
+                else
+                        tempLOD = tempdy;
+
+                LOD = (int)(log2((double)tempLOD / (double)(1ULL << 36)) * 256);
+                LOD >>= 2;
+
+                lodbias = (params->tLOD[tmu] >> 12) & 0x3f;
+                if (lodbias & 0x20)
+                        lodbias |= ~0x3f;
+                params->lod[tmu] = LOD + (lodbias << 6);
+        }
+}
+
 void voodoo_queue_triangle(voodoo_t *voodoo, voodoo_params_t *params)
 {
         voodoo_params_t *params_new = &voodoo->params_buffer[voodoo->params_write_idx & PARAM_MASK];
@@ -1631,6 +1638,7 @@ void voodoo_queue_triangle(voodoo_t *voodoo, voodoo_params_t *params)
                 voodoo_use_texture(voodoo, params, 1);
 
         memcpy(params_new, params, sizeof(voodoo_params_t));
+        voodoo_triangle_prepare(params_new);
 
         voodoo->params_write_idx++;
 
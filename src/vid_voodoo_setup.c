@@ -1,3 +1,5 @@
+#include <stddef.h>
+#include <string.h>
 #include "ibm.h"
 #include "device.h"
 #include "mem.h"
@@ -10,12 +12,33 @@
 #include "vid_voodoo_render.h"
 #include "vid_voodoo_setup.h"
 
+/*Per-vertex attributes, in the order they appear in vert_t from sRed on*/
+enum
+{
+        ATTR_R = 0,
+        ATTR_G,
+        ATTR_B,
+        ATTR_A,
+        ATTR_Z,
+        ATTR_Wb,
+        ATTR_W0,
+        ATTR_S0,
+        ATTR_T0,
+        ATTR_W1,
+        ATTR_S1,
+        ATTR_T1,
+        ATTR_COUNT
+};
+
 void voodoo_triangle_setup(voodoo_t *voodoo)
 {
         float dxAB, dxBC, dyAB, dyBC;
         float area;
         int va = 0, vb = 1, vc = 2;
         vert_t verts[3];
+        float a[ATTR_COUNT], b[ATTR_COUNT], c[ATTR_COUNT];
+        float grad_x[ATTR_COUNT], grad_y[ATTR_COUNT];
+        int i;
 
         verts[0] = voodoo->verts[0];
         verts[1] = voodoo->verts[1];
@@ -131,56 +154,72 @@ void voodoo_triangle_setup(voodoo_t *voodoo)
                 return;
         }
 
+        memcpy(a, (uint8_t *)&verts[va] + offsetof(vert_t, sRed), sizeof(a));
+        memcpy(b, (uint8_t *)&verts[vb] + offsetof(vert_t, sRed), sizeof(b));
+        memcpy(c, (uint8_t *)&verts[vc] + offsetof(vert_t, sRed), sizeof(c));
+
+        /*Compute the gradients of every attribute in one fixed length loop,
+          which the compiler can vectorise, and then only store the ones that
+          the setup mode asks for*/
+        for (i = 0; i < ATTR_COUNT; i++)
+        {
+                float dAB = a[i] - b[i];
+                float dBC = b[i] - c[i];
+
+                grad_x[i] = dAB * dyBC - dBC * dyAB;
+                grad_y[i] = dBC * dxAB - dAB * dxBC;
+        }
+
         if (voodoo->sSetupMode & SETUPMODE_RGB)
         {
-                voodoo->params.startR = (int32_t)(verts[va].sRed * 4096.0f);
-                voodoo->params.dRdX = (int32_t)(((verts[va].sRed - verts[vb].sRed) * dyBC - (verts[vb].sRed - verts[vc].sRed) * dyAB) * 4096.0f);
-                voodoo->params.dRdY = (int32_t)(((verts[vb].sRed - verts[vc].sRed) * dxAB - (verts[va].sRed - verts[vb].sRed) * dxBC) * 4096.0f);
-                voodoo->params.startG = (int32_t)(verts[va].sGreen * 4096.0f);
-                voodoo->params.dGdX = (int32_t)(((verts[va].sGreen - verts[vb].sGreen) * dyBC - (verts[vb].sGreen - verts[vc].sGreen) * dyAB) * 4096.0f);
-                voodoo->params.dGdY = (int32_t)(((verts[vb].sGreen - verts[vc].sGreen) * dxAB - (verts[va].sGreen - verts[vb].sGreen) * dxBC) * 4096.0f);
-                voodoo->params.startB = (int32_t)(verts[va].sBlue * 4096.0f);
-                voodoo->params.dBdX = (int32_t)(((verts[va].sBlue - verts[vb].sBlue) * dyBC - (verts[vb].sBlue - verts[vc].sBlue) * dyAB) * 4096.0f);
-                voodoo->params.dBdY = (int32_t)(((verts[vb].sBlue - verts[vc].sBlue) * dxAB - (verts[va].sBlue - verts[vb].sBlue) * dxBC) * 4096.0f);
+                voodoo->params.startR = (int32_t)(a[ATTR_R] * 4096.0f);
+                voodoo->params.dRdX = (int32_t)(grad_x[ATTR_R] * 4096.0f);
+                voodoo->params.dRdY = (int32_t)(grad_y[ATTR_R] * 4096.0f);
+                voodoo->params.startG = (int32_t)(a[ATTR_G] * 4096.0f);
+                voodoo->params.dGdX = (int32_t)(grad_x[ATTR_G] * 4096.0f);
+                voodoo->params.dGdY = (int32_t)(grad_y[ATTR_G] * 4096.0f);
+                voodoo->params.startB = (int32_t)(a[ATTR_B] * 4096.0f);
+                voodoo->params.dBdX = (int32_t)(grad_x[ATTR_B] * 4096.0f);
+                voodoo->params.dBdY = (int32_t)(grad_y[ATTR_B] * 4096.0f);
         }
         if (voodoo->sSetupMode & SETUPMODE_ALPHA)
         {
-                voodoo->params.startA = (int32_t)(verts[va].sAlpha * 4096.0f);
-                voodoo->params.dAdX = (int32_t)(((verts[va].sAlpha - verts[vb].sAlpha) * dyBC - (verts[vb].sAlpha - verts[vc].sAlpha) * dyAB) * 4096.0f);
-                voodoo->params.dAdY = (int32_t)(((verts[vb].sAlpha - verts[vc].sAlpha) * dxAB - (verts[va].sAlpha - verts[vb].sAlpha) * dxBC) * 4096.0f);
+                voodoo->params.startA = (int32_t)(a[ATTR_A] * 4096.0f);
+                voodoo->params.dAdX = (int32_t)(grad_x[ATTR_A] * 4096.0f);
+                voodoo->params.dAdY = (int32_t)(grad_y[ATTR_A] * 4096.0f);
         }
         if (voodoo->sSetupMode & SETUPMODE_Z)
         {
-                voodoo->params.startZ = (int32_t)(verts[va].sVz * 4096.0f);
-                voodoo->params.dZdX = (int32_t)(((verts[va].sVz - verts[vb].sVz) * dyBC - (verts[vb].sVz - verts[vc].sVz) * dyAB) * 4096.0f);
-                voodoo->params.dZdY = (int32_t)(((verts[vb].sVz - verts[vc].sVz) * dxAB - (verts[va].sVz - verts[vb].sVz) * dxBC) * 4096.0f);
+                voodoo->params.startZ = (int32_t)(a[ATTR_Z] * 4096.0f);
+                voodoo->params.dZdX = (int32_t)(grad_x[ATTR_Z] * 4096.0f);
+                voodoo->params.dZdY = (int32_t)(grad_y[ATTR_Z] * 4096.0f);
         }
         if (voodoo->sSetupMode & SETUPMODE_Wb)
         {
-                voodoo->params.startW = (int64_t)(verts[va].sWb * 4294967296.0f);
-                voodoo->params.dWdX = (int64_t)(((verts[va].sWb - verts[vb].sWb) * dyBC - (verts[vb].sWb - verts[vc].sWb) * dyAB) * 4294967296.0f);
-                voodoo->params.dWdY = (int64_t)(((verts[vb].sWb - verts[vc].sWb) * dxAB - (verts[va].sWb - verts[vb].sWb) * dxBC) * 4294967296.0f);
+                voodoo->params.startW = (int64_t)(a[ATTR_Wb] * 4294967296.0f);
+                voodoo->params.dWdX = (int64_t)(grad_x[ATTR_Wb] * 4294967296.0f);
+                voodoo->params.dWdY = (int64_t)(grad_y[ATTR_Wb] * 4294967296.0f);
                 voodoo->params.tmu[0].startW = voodoo->params.tmu[1].startW = voodoo->params.startW;
                 voodoo->params.tmu[0].dWdX = voodoo->params.tmu[1].dWdX = voodoo->params.dWdX;
                 voodoo->params.tmu[0].dWdY = voodoo->params.tmu[1].dWdY = voodoo->params.dWdY;
         }
         if (voodoo->sSetupMode & SETUPMODE_W0)
         {
-                voodoo->params.tmu[0].startW = (int64_t)(verts[va].sW0 * 4294967296.0f);
-                voodoo->params.tmu[0].dWdX = (int64_t)(((verts[va].sW0 - verts[vb].sW0) * dyBC - (verts[vb].sW0 - verts[vc].sW0) * dyAB) * 4294967296.0f);
-                voodoo->params.tmu[0].dWdY = (int64_t)(((verts[vb].sW0 - verts[vc].sW0) * dxAB - (verts[va].sW0 - verts[vb].sW0) * dxBC) * 4294967296.0f);
+                voodoo->params.tmu[0].startW = (int64_t)(a[ATTR_W0] * 4294967296.0f);
+                voodoo->params.tmu[0].dWdX = (int64_t)(grad_x[ATTR_W0] * 4294967296.0f);
+                voodoo->params.tmu[0].dWdY = (int64_t)(grad_y[ATTR_W0] * 4294967296.0f);
                 voodoo->params.tmu[1].startW = voodoo->params.tmu[0].startW;
                 voodoo->params.tmu[1].dWdX = voodoo->params.tmu[0].dWdX;
                 voodoo->params.tmu[1].dWdY = voodoo->params.tmu[0].dWdY;
         }
         if (voodoo->sSetupMode & SETUPMODE_S0_T0)
         {
-                voodoo->params.tmu[0].startS = (int64_t)(verts[va].sS0 * 4294967296.0f);
-                voodoo->params.tmu[0].dSdX = (int64_t)(((verts[va].sS0 - verts[vb].sS0) * dyBC - (verts[vb].sS0 - verts[vc].sS0) * dyAB) * 4294967296.0f);
-                voodoo->params.tmu[0].dSdY = (int64_t)(((verts[vb].sS0 - verts[vc].sS0) * dxAB - (verts[va].sS0 - verts[vb].sS0) * dxBC) * 4294967296.0f);
-                voodoo->params.tmu[0].startT = (int64_t)(verts[va].sT0 * 4294967296.0f);
-                voodoo->params.tmu[0].dTdX = (int64_t)(((verts[va].sT0 - verts[vb].sT0) * dyBC - (verts[vb].sT0 - verts[vc].sT0) * dyAB) * 4294967296.0f);
-                voodoo->params.tmu[0].dTdY = (int64_t)(((verts[vb].sT0 - verts[vc].sT0) * dxAB - (verts[va].sT0 - verts[vb].sT0) * dxBC) * 4294967296.0f);
+                voodoo->params.tmu[0].startS = (int64_t)(a[ATTR_S0] * 4294967296.0f);
+                voodoo->params.tmu[0].dSdX = (int64_t)(grad_x[ATTR_S0] * 4294967296.0f);
+                voodoo->params.tmu[0].dSdY = (int64_t)(grad_y[ATTR_S0] * 4294967296.0f);
+                voodoo->params.tmu[0].startT = (int64_t)(a[ATTR_T0] * 4294967296.0f);
+                voodoo->params.tmu[0].dTdX = (int64_t)(grad_x[ATTR_T0] * 4294967296.0f);
+                voodoo->params.tmu[0].dTdY = (int64_t)(grad_y[ATTR_T0] * 4294967296.0f);
                 voodoo->params.tmu[1].startS = voodoo->params.tmu[0].startS;
                 voodoo->params.tmu[1].dSdX = voodoo->params.tmu[0].dSdX;
                 voodoo->params.tmu[1].dSdY = voodoo->params.tmu[0].dSdY;
@@ -190,18 +229,18 @@ void voodoo_triangle_setup(voodoo_t *voodoo)
         }
         if (voodoo->sSetupMode & SETUPMODE_W1)
         {
-                voodoo->params.tmu[1].startW = (int64_t)(verts[va].sW1 * 4294967296.0f);
-                voodoo->params.tmu[1].dWdX = (int64_t)(((verts[va].sW1 - verts[vb].sW1) * dyBC - (verts[vb].sW1 - verts[vc].sW1) * dyAB) * 4294967296.0f);
-                voodoo->params.tmu[1].dWdY = (int64_t)(((verts[vb].sW1 - verts[vc].sW1) * dxAB - (verts[va].sW1 - verts[vb].sW1) * dxBC) * 4294967296.0f);
+                voodoo->params.tmu[1].startW = (int64_t)(a[ATTR_W1] * 4294967296.0f);
+                voodoo->params.tmu[1].dWdX = (int64_t)(grad_x[ATTR_W1] * 4294967296.0f);
+                voodoo->params.tmu[1].dWdY = (int64_t)(grad_y[ATTR_W1] * 4294967296.0f);
         }
         if (voodoo->sSetupMode & SETUPMODE_S1_T1)
         {
-                voodoo->params.tmu[1].startS = (int64_t)(verts[va].sS1 * 4294967296.0f);
-                voodoo->params.tmu[1].dSdX = (int64_t)(((verts[va].sS1 - verts[vb].sS1) * dyBC - (verts[vb].sS1 - verts[vc].sS1) * dyAB) * 4294967296.0f);
-                voodoo->params.tmu[1].dSdY = (int64_t)(((verts[vb].sS1 - verts[vc].sS1) * dxAB - (verts[va].sS1 - verts[vb].sS1) * dxBC) * 4294967296.0f);
-                voodoo->params.tmu[1].startT = (int64_t)(verts[va].sT1 * 4294967296.0f);
-                voodoo->params.tmu[1].dTdX = (int64_t)(((verts[va].sT1 - verts[vb].sT1) * dyBC - (verts[vb].sT1 - verts[vc].sT1) * dyAB) * 4294967296.0f);
-                voodoo->params.tmu[1].dTdY = (int64_t)(((verts[vb].sT1 - verts[vc].sT1) * dxAB - (verts[va].sT1 - verts[vb].sT1) * dxBC) * 4294967296.0f);
+                voodoo->params.tmu[1].startS = (int64_t)(a[ATTR_S1] * 4294967296.0f);
+                voodoo->params.tmu[1].dSdX = (int64_t)(grad_x[ATTR_S1] * 4294967296.0f);
+                voodoo->params.tmu[1].dSdY = (int64_t)(grad_y[ATTR_S1] * 4294967296.0f);
+                voodoo->params.tmu[1].startT = (int64_t)(a[ATTR_T1] * 4294967296.0f);
+                voodoo->params.tmu[1].dTdX = (int64_t)(grad_x[ATTR_T1] * 4294967296.0f);
+                voodoo->params.tmu[1].dTdY = (int64_t)(grad_y[ATTR_T1] * 4294967296.0f);
         }
 
         voodoo->params.sign = (area < 0.0);
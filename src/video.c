@@ -505,6 +505,8 @@ int changeframecount=2;
 
 uint8_t rotatevga[8][256];
 
+uint32_t video_glyph_mask[256][8];
+
 int frames = 0;
 int video_frames = 0;
 int video_refresh_rate = 0;
@@ -1074,12 +1076,13 @@ static void blit_thread(void *param);
 
 uint32_t cgapal[16];
 
-void initvideo()
+/*Lookup tables that are constant once built. These are process wide and can
+  be shared by every machine, so they are built once at process startup, before
+  any emulation thread is created, and never freed*/
+void video_init_tables()
 {
         int c, d, e;
 
-        buffer32 = create_bitmap(2048, 2048);
-
         for (c = 0; c < 256; c++)
         {
                 e = c;
@@ -1110,6 +1113,56 @@ void initvideo()
         for (c = 0; c < 65536; c++)
                 video_16to32[c] = ((c & 31) << 3) | (((c >> 5) & 63) << 10) | (((c >> 11) & 31) << 19);
 
+        for (c = 0; c < 256; c++)
+        {
+                for (d = 0; d < 8; d++)
+                        video_glyph_mask[c][d] = (c & (0x80 >> d)) ? 0xffffffff : 0;
+        }
+}
+
+text_line_cache_t *text_line_cache_alloc(int lines)
+{
+        text_line_cache_t *cache = malloc(lines * sizeof(text_line_cache_t));
+        
+        memset(cache, 0, lines * sizeof(text_line_cache_t));
+        
+        return cache;
+}
+
+int text_line_cache_check(text_line_cache_t *cache, int line, const uint32_t *key, const uint8_t *vram, uint32_t addr, uint32_t mask, int len)
+{
+        text_line_cache_t *entry = &cache[line];
+        int c;
+        
+        if (len > TEXT_LINE_DATA_SIZE)
+        {
+                entry->valid = 0;
+                return 0;
+        }
+        
+        if (entry->valid && !memcmp(entry->key, key, sizeof(entry->key)))
+        {
+                for (c = 0; c < len; c++)
+                {
+                        if (entry->data[c] != vram[(addr + c) & mask])
+                                break;
+                }
+                if (c == len)
+                        return 1;
+        }
+        
+        memcpy(entry->key, key, sizeof(entry->key));
+        for (c = 0; c < len; c++)
+                entry->data[c] = vram[(addr + c) & mask];
+        entry->valid = 1;
+        
+        return 0;
+}
+
+void initvideo()
+{
+        buffer32 = create_bitmap(2048, 2048);
+
         cgapal_rebuild(DISPLAY_RGB, 0);
 
         blit_data.wake_blit_thread = thread_create_event();
@@ -1125,8 +1178,6 @@ void closevideo()
         thread_destroy_event(blit_data.blit_complete);
         thread_destroy_event(blit_data.wake_blit_thread);
 
-        free(video_15to32);
-        free(video_16to32);
         destroy_bitmap(buffer32);
 }
 
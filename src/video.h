@@ -58,6 +58,57 @@ extern uint8_t fontdatksc5601_user[192][32];
 
 extern uint32_t *video_15to32, *video_16to32;
 
+/*Pixel masks for each row of a text mode glyph - video_glyph_mask[dat][x] is
+  all ones if pixel x of glyph row dat is set*/
+extern uint32_t video_glyph_mask[256][8];
+
+/*Expand an 8 pixel glyph row to fg/bg pixels*/
+static inline void video_expand_glyph(uint32_t *p, uint8_t dat, uint32_t fg, uint32_t bg)
+{
+        const uint32_t *mask = video_glyph_mask[dat];
+        uint32_t diff = fg ^ bg;
+        int xx;
+
+        for (xx = 0; xx < 8; xx++)
+                p[xx] = bg ^ (mask[xx] & diff);
+}
+/*As above, but with each pixel doubled (40 column modes)*/
+static inline void video_expand_glyph_double(uint32_t *p, uint8_t dat, uint32_t fg, uint32_t bg)
+{
+        const uint32_t *mask = video_glyph_mask[dat];
+        uint32_t diff = fg ^ bg;
+        int xx;
+
+        for (xx = 0; xx < 8; xx++)
+                p[xx << 1] = p[(xx << 1) + 1] = bg ^ (mask[xx] & diff);
+}
+
+/*Record of what was last drawn on each scanline by a text mode renderer. The
+  key holds the register state that affects the line, data the character and
+  attribute bytes. If both are unchanged since the line was last drawn, and
+  nothing else has drawn over it, the line in buffer32 is still correct and
+  can be left alone*/
+#define TEXT_LINE_KEY_SIZE  6
+#define TEXT_LINE_DATA_SIZE 256
+
+typedef struct text_line_cache_t
+{
+        int valid;
+        uint32_t key[TEXT_LINE_KEY_SIZE];
+        uint8_t data[TEXT_LINE_DATA_SIZE];
+} text_line_cache_t;
+
+text_line_cache_t *text_line_cache_alloc(int lines);
+/*Returns 1 if line can be skipped. Otherwise records key and the len bytes at
+  vram[(addr + n) & mask] as the new contents of the line and returns 0*/
+int text_line_cache_check(text_line_cache_t *cache, int line, const uint32_t *key, const uint8_t *vram, uint32_t addr, uint32_t mask, int len);
+
+static inline void text_line_cache_invalidate(text_line_cache_t *cache, int line)
+{
+        if (cache)
+                cache[line].valid = 0;
+}
+
 extern int xsize,ysize;
 
 extern float cpuclock;
@@ -98,6 +149,7 @@ typedef enum
 
 void loadfont(char *s, fontformat_t format);
 
+void video_init_tables();
 void initvideo();
 void video_init();
 void closevideo();
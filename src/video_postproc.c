@@ -0,0 +1,391 @@
+/*CPU scaling and CRT style filters. Output rows are independent, so the image
+  is split into horizontal bands, one per thread. The calling thread draws the
+  first band itself.
+
+  Colours are blended with 8 bit weights. Where SSE2 is available rows are
+  processed four pixels at a time, otherwise two channels at a time in 32-bit
+  integers.*/
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#if defined __SSE2__ || defined _M_X64
+#include <emmintrin.h>
+#define POSTPROC_SSE2
+#endif
+#include "thread.h"
+#include "video_postproc.h"
+
+/*Images smaller than this aren't worth waking the worker threads for*/
+#define POSTPROC_PARALLEL_MIN (256*256)
+
+/*Scanlines darken the edges of each source line by up to this much (out of
+  256)*/
+#define SCANLINE_STRENGTH 128
+/*CRT mask weight for the two channels a column doesn't show (out of 256)*/
+#define CRT_MASK_DIM 192
+
+typedef struct postproc_worker_t
+{
+        thread_t *thread;
+        event_t *wake;
+        event_t *done;
+        int y1, y2;
+
+        uint32_t *row;          /*Vertically blended source row*/
+        int row_size;
+} postproc_worker_t;
+
+static struct
+{
+        uint32_t *dst;
+        int dst_pitch, dst_w, dst_h;
+        const uint32_t *src;
+        int src_pitch, src_w, src_h;
+        int linear, filter;
+
+        /*Source pixels and weights for each output column*/
+        int *x_left, *x_right;
+        int *x_frac;
+        int x_size;
+} job;
+
+static postproc_worker_t workers[POSTPROC_MAX_THREADS];
+static int nr_workers = 1;
+
+/*Blend two pixels, f = 0 gives a, f = 256 gives b*/
+static inline uint32_t postproc_lerp(uint32_t a, uint32_t b, int f)
+{
+        uint32_t rb = ((a & 0xff00ff) * (256 - f) + (b & 0xff00ff) * f) >> 8;
+        uint32_t ag = ((a >> 8) & 0xff00ff) * (256 - f) + ((b >> 8) & 0xff00ff) * f;
+
+        return (rb & 0xff00ff) | (ag & 0xff00ff00);
+}
+
+/*Blend two source rows into out, f = 0 gives a, f = 256 gives b*/
+static void postproc_blend_rows(uint32_t *out, const uint32_t *a, const uint32_t *b, int w, int f)
+{
+        int x = 0;
+#ifdef POSTPROC_SSE2
+        __m128i zero = _mm_setzero_si128();
+        __m128i wa = _mm_set1_epi16(256 - f);
+        __m128i wb = _mm_set1_epi16(f);
+
+        for (; x + 4 <= w; x += 4)
+        {
+                __m128i pa = _mm_loadu_si128((const __m128i *)&a[x]);
+                __m128i pb = _mm_loadu_si128((const __m128i *)&b[x]);
+                __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(pa, zero), wa),
+                                           _mm_mullo_epi16(_mm_unpacklo_epi8(pb, zero), wb));
+                __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(pa, zero), wa),
+                                           _mm_mullo_epi16(_mm_unpackhi_epi8(pb, zero), wb));
+
+                _mm_storeu_si128((__m128i *)&out[x],
+                                 _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8)));
+        }
+#endif
+        for (; x < w; x++)
+                out[x] = postproc_lerp(a[x], b[x], f);
+}
+
+/*Multiply each channel by a weight (out of 256). mult holds the weights for
+  12 pixels, 4 channels each in memory order, and repeats along the row*/
+static void postproc_filter_row(uint32_t *p, int w, const uint16_t *mult)
+{
+        int x = 0, c = 0;
+#ifdef POSTPROC_SSE2
+        __m128i zero = _mm_setzero_si128();
+
+        for (; x + 4 <= w; x += 4)
+        {
+                const __m128i *m = (const __m128i *)&mult[c * 16];
+                __m128i v = _mm_loadu_si128((__m128i *)&p[x]);
+                __m128i lo = _mm_mullo_epi16(_mm_unpacklo_epi8(v, zero), _mm_loadu_si128(&m[0]));
+                __m128i hi = _mm_mullo_epi16(_mm_unpackhi_epi8(v, zero), _mm_loadu_si128(&m[1]));
+
+                _mm_storeu_si128((__m128i *)&p[x],
+                                 _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8)));
+                c = (c == 2) ? 0 : (c + 1);
+        }
+        c *= 4;
+#endif
+        for (; x < w; x++)
+        {
+                uint8_t *b = (uint8_t *)&p[x];
+                const uint16_t *m = &mult[c * 4];
+
+                b[0] = (b[0] * m[0]) >> 8;
+                b[1] = (b[1] * m[1]) >> 8;
+                b[2] = (b[2] * m[2]) >> 8;
+                b[3] = (b[3] * m[3]) >> 8;
+                c = (c == 11) ? 0 : (c + 1);
+        }
+}
+
+/*Build the channel weights for output row y*/
+static void postproc_filter_weights(uint16_t *mult, int y)
+{
+        int scan = 256;
+        int c;
+
+        /*Scanlines need at least two output rows per source line, otherwise
+          they just alias*/
+        if (job.dst_h >= job.src_h * 2)
+        {
+                int t = (int)((((int64_t)(2 * y + 1) * job.src_h) << 7) / job.dst_h) & 0xff;
+                int d = t - 128;
+
+                scan = 256 - (SCANLINE_STRENGTH * d * d) / (128 * 128);
+        }
+
+        for (c = 0; c < 12; c++)
+        {
+                uint16_t *m = &mult[c * 4];
+
+                m[0] = m[1] = m[2] = scan;
+                m[3] = 256;
+                if (job.filter == POSTPROC_FILTER_CRT)
+                {
+                        /*Aperture grille, red, green and blue columns. Pixels
+                          are stored B, G, R, A*/
+                        int bright = 2 - (c % 3);
+
+                        m[0] = (m[0] * ((bright == 0) ? 256 : CRT_MASK_DIM)) >> 8;
+                        m[1] = (m[1] * ((bright == 1) ? 256 : CRT_MASK_DIM)) >> 8;
+                        m[2] = (m[2] * ((bright == 2) ? 256 : CRT_MASK_DIM)) >> 8;
+                }
+        }
+}
+
+static void postproc_rows(postproc_worker_t *worker, int y1, int y2)
+{
+        uint16_t mult[12 * 4];
+        int prev_sy = -1;
+        int y, x;
+
+        for (y = y1; y < y2; y++)
+        {
+                uint32_t *d = &job.dst[y * job.dst_pitch];
+
+                if (job.linear)
+                {
+                        /*Sample at the centre of each output pixel*/
+                        int sy = (int)((((int64_t)(2 * y + 1) * job.src_h) << 7) / job.dst_h) - 128;
+                        int sy0, fy;
+                        const uint32_t *row;
+
+                        if (sy < 0)
+                                sy = 0;
+                        sy0 = sy >> 8;
+                        fy = sy & 0xff;
+                        if (sy0 >= job.src_h - 1)
+                        {
+                                sy0 = job.src_h - 1;
+                                fy = 0;
+                        }
+
+                        if (fy)
+                        {
+                                postproc_blend_rows(worker->row, &job.src[sy0 * job.src_pitch],
+                                                    &job.src[(sy0 + 1) * job.src_pitch], job.src_w, fy);
+                                row = worker->row;
+                        }
+                        else
+                                row = &job.src[sy0 * job.src_pitch];
+
+                        for (x = 0; x < job.dst_w; x++)
+                                d[x] = postproc_lerp(row[job.x_left[x]], row[job.x_right[x]], job.x_frac[x]);
+                }
+                else
+                {
+                        int sy = (int)(((int64_t)(2 * y + 1) * job.src_h) / (2 * job.dst_h));
+
+                        if (sy == prev_sy)
+                                memcpy(d, d - job.dst_pitch, job.dst_w * 4);
+                        else
+                        {
+                                const uint32_t *row = &job.src[sy * job.src_pitch];
+
+                                for (x = 0; x < job.dst_w; x++)
+                                        d[x] = row[job.x_left[x]];
+                        }
+                        prev_sy = sy;
+                }
+
+                if (job.filter != POSTPROC_FILTER_NONE)
+                {
+                        postproc_filter_weights(mult, y);
+                        postproc_filter_row(d, job.dst_w, mult);
+                        /*The row is no longer a copy of the source*/
+                        prev_sy = -1;
+                }
+        }
+}
+
+static void postproc_thread(void *p)
+{
+        postproc_worker_t *worker = (postproc_worker_t *)p;
+
+        while (1)
+        {
+                thread_wait_event(worker->wake, -1);
+                thread_reset_event(worker->wake);
+
+                postproc_rows(worker, worker->y1, worker->y2);
+
+                thread_set_event(worker->done);
+        }
+}
+
+void postproc_init(int nr_threads)
+{
+        int c;
+
+        if (nr_threads < 1)
+                nr_threads = 1;
+        if (nr_threads > POSTPROC_MAX_THREADS)
+                nr_threads = POSTPROC_MAX_THREADS;
+
+        /*Worker 0 is the calling thread*/
+        for (c = 1; c < nr_threads; c++)
+        {
+                postproc_worker_t *worker = &workers[c];
+
+                worker->wake = thread_create_event();
+                worker->done = thread_create_event();
+                worker->thread = thread_create(postproc_thread, worker);
+        }
+        nr_workers = nr_threads;
+}
+
+void postproc_close()
+{
+        int c;
+
+        for (c = 0; c < POSTPROC_MAX_THREADS; c++)
+        {
+                postproc_worker_t *worker = &workers[c];
+
+                if (worker->thread)
+                {
+                        thread_kill(worker->thread);
+                        thread_destroy_event(worker->wake);
+                        thread_destroy_event(worker->done);
+                }
+                free(worker->row);
+                memset(worker, 0, sizeof(postproc_worker_t));
+        }
+        free(job.x_left);
+        free(job.x_right);
+        free(job.x_frac);
+        job.x_left = job.x_right = job.x_frac = NULL;
+        job.x_size = 0;
+        nr_workers = 1;
+}
+
+/*Work out which source pixels, and what weights, each output column uses*/
+static int postproc_setup_columns()
+{
+        int x;
+
+        if (job.dst_w > job.x_size)
+        {
+                free(job.x_left);
+                free(job.x_right);
+                free(job.x_frac);
+                job.x_left = malloc(job.dst_w * sizeof(int));
+                job.x_right = malloc(job.dst_w * sizeof(int));
+                job.x_frac = malloc(job.dst_w * sizeof(int));
+                if (!job.x_left || !job.x_right || !job.x_frac)
+                {
+                        job.x_size = 0;
+                        return 0;
+                }
+                job.x_size = job.dst_w;
+        }
+
+        for (x = 0; x < job.dst_w; x++)
+        {
+                if (job.linear)
+                {
+                        int sx = (int)((((int64_t)(2 * x + 1) * job.src_w) << 7) / job.dst_w) - 128;
+
+                        if (sx < 0)
+                                sx = 0;
+                        job.x_left[x] = sx >> 8;
+                        job.x_frac[x] = sx & 0xff;
+                        if (job.x_left[x] >= job.src_w - 1)
+                        {
+                                job.x_left[x] = job.src_w - 1;
+                                job.x_frac[x] = 0;
+                        }
+                        job.x_right[x] = job.x_frac[x] ? (job.x_left[x] + 1) : job.x_left[x];
+                }
+                else
+                        job.x_left[x] = (int)(((int64_t)(2 * x + 1) * job.src_w) / (2 * job.dst_w));
+        }
+
+        return 1;
+}
+
+void postproc_scale(uint32_t *dst, int dst_pitch, int dst_w, int dst_h,
+                    const uint32_t *src, int src_pitch, int src_w, int src_h,
+                    int linear, int filter)
+{
+        int nr_bands = nr_workers;
+        int rows, c;
+
+        if (dst_w <= 0 || dst_h <= 0 || src_w <= 0 || src_h <= 0)
+                return;
+
+        job.dst = dst;
+        job.dst_pitch = dst_pitch;
+        job.dst_w = dst_w;
+        job.dst_h = dst_h;
+        job.src = src;
+        job.src_pitch = src_pitch;
+        job.src_w = src_w;
+        job.src_h = src_h;
+        job.linear = linear;
+        job.filter = filter;
+
+        if (!postproc_setup_columns())
+                return;
+
+        if (dst_w * dst_h < POSTPROC_PARALLEL_MIN)
+                nr_bands = 1;
+
+        for (c = 0; c < nr_bands; c++)
+        {
+                postproc_worker_t *worker = &workers[c];
+
+                if (linear && worker->row_size < src_w)
+                {
+                        free(worker->row);
+                        worker->row = malloc(src_w * 4);
+                        if (!worker->row)
+                        {
+                                worker->row_size = 0;
+                                return;
+                        }
+                        worker->row_size = src_w;
+                }
+        }
+
+        rows = (dst_h + nr_bands - 1) / nr_bands;
+        for (c = 1; c < nr_bands; c++)
+        {
+                postproc_worker_t *worker = &workers[c];
+
+                worker->y1 = c * rows;
+                worker->y2 = (c + 1) * rows;
+                if (worker->y1 > dst_h)
+                        worker->y1 = dst_h;
+                if (worker->y2 > dst_h)
+                        worker->y2 = dst_h;
+                thread_reset_event(worker->done);
+                thread_set_event(worker->wake);
+        }
+        postproc_rows(&workers[0], 0, (rows < dst_h) ? rows : dst_h);
+        for (c = 1; c < nr_bands; c++)
+                thread_wait_event(workers[c].done, -1);
+}
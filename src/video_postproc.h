@@ -0,0 +1,27 @@
+/*CPU scaling and CRT style filters for display paths that have no GPU shaders
+  (the SDL2 software renderer, screen capture). Work is split by output row
+  between the calling thread and a pool of worker threads.*/
+#ifndef _VIDEO_POSTPROC_H_
+#define _VIDEO_POSTPROC_H_
+
+enum
+{
+        POSTPROC_FILTER_NONE = 0,
+        POSTPROC_FILTER_SCANLINES,      /*Darken the edges of each source line*/
+        POSTPROC_FILTER_CRT             /*Scanlines plus an RGB aperture grille mask*/
+};
+
+#define POSTPROC_MAX_THREADS 8
+
+/*Start the worker pool. nr_threads includes the calling thread*/
+void postproc_init(int nr_threads);
+void postproc_close();
+
+/*Scale a 32-bit source image to dst, applying filter. Pitches are in pixels.
+  linear selects bilinear filtering, otherwise nearest neighbour is used.
+  Blocks until the whole image has been written*/
+void postproc_scale(uint32_t *dst, int dst_pitch, int dst_w, int dst_h,
+                    const uint32_t *src, int src_pitch, int src_w, int src_h,
+                    int linear, int filter);
+
+#endif /*_VIDEO_POSTPROC_H_*/
@@ -0,0 +1,418 @@
+/*Offline replay of a Voodoo command trace recorded with the "Record command
+  trace" option. The trace is fed to the card as fast as the FIFO and render
+  threads will take it, and the achieved triangle, pixel and frame rates are
+  reported.
+
+  This is a standalone program, built with Makefile.voodoo-replay. It links the
+  Voodoo core with stubs for the parts of the emulator it touches, and drives
+  the card through the memory and PCI handlers the core registers.
+
+  Retraces in the trace complete any buffer swap the card has queued without
+  waiting for the swap interval, so vsync doesn't limit the frame rate.*/
+#include <stdarg.h>
+#include <stdlib.h>
+#include <time.h>
+#include "ibm.h"
+#include "device.h"
+#include "mem.h"
+#include "pci.h"
+#include "thread.h"
+#include "timer.h"
+#include "video.h"
+#include "x86.h"
+#include "vid_svga.h"
+#include "vid_trace.h"
+#include "vid_voodoo.h"
+#include "vid_voodoo_common.h"
+#include "vid_voodoo_banshee.h"
+#include "vid_voodoo_banshee_blitter.h"
+#include "vid_voodoo_display.h"
+#include "vid_voodoo_fifo.h"
+
+/*ibm.h sends printf to the log, but results should go to stdout*/
+#undef printf
+
+/*Number of records after which an armed wake timer fires. The emulator wakes
+  the FIFO thread 100us after the first write to an idle FIFO, which is a few
+  hundred writes at typical guest write rates*/
+#define WAKE_RECORDS 256
+
+#define RECORD_BLOCK 4096
+
+static uint32_t trace_config[VID_TRACE_MAX_CONFIG];
+static int replay_render_threads = 2;
+static int replay_recompiler = 1;
+static int replay_verbose = 0;
+
+static uint8_t (*replay_pci_read)(int func, int addr, void *priv);
+static void (*replay_pci_write)(int func, int addr, uint8_t val, void *priv);
+static void *replay_pci_priv;
+
+static pc_timer_t *wake_timer;
+
+/*Emulator interfaces used by the Voodoo core*/
+uint64_t TIMER_USEC = 1ull << 32;
+uint64_t timer_freq = 1000000000;
+uint64_t tsc;
+float cpuclock = 100000000.0f;
+int pci_burst_time, pci_nonburst_time;
+BITMAP *buffer32;
+char logs_path[512];
+
+void pclog(const char *format, ...)
+{
+        va_list ap;
+
+        if (!replay_verbose)
+                return;
+
+        va_start(ap, format);
+        vfprintf(stderr, format, ap);
+        va_end(ap);
+}
+
+void fatal(const char *format, ...)
+{
+        va_list ap;
+
+        va_start(ap, format);
+        vfprintf(stderr, format, ap);
+        va_end(ap);
+        exit(-1);
+}
+
+uint64_t timer_read()
+{
+        struct timespec ts;
+
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+int device_get_config_int(char *name)
+{
+        if (!strcmp(name, "type"))
+                return trace_config[0];
+        if (!strcmp(name, "framebuffer_memory"))
+                return trace_config[1];
+        if (!strcmp(name, "texture_memory"))
+                return trace_config[2];
+        if (!strcmp(name, "bilinear"))
+                return trace_config[3];
+        if (!strcmp(name, "render_threads"))
+                return replay_render_threads;
+        if (!strcmp(name, "recompiler"))
+                return replay_recompiler;
+        return 0;
+}
+
+void timer_add(pc_timer_t *timer, void (*callback)(void *p), void *p, int start_timer)
+{
+        memset(timer, 0, sizeof(pc_timer_t));
+        timer->callback = callback;
+        timer->p = p;
+        timer->enabled = start_timer;
+
+        if (callback == voodoo_wake_timer)
+                wake_timer = timer;
+}
+
+void timer_enable(pc_timer_t *timer)
+{
+        timer->enabled = 1;
+}
+
+void timer_disable(pc_timer_t *timer)
+{
+        timer->enabled = 0;
+}
+
+void mem_mapping_add(mem_mapping_t *mapping,
+                    uint32_t base,
+                    uint32_t size,
+                    uint8_t  (*read_b)(uint32_t addr, void *p),
+                    uint16_t (*read_w)(uint32_t addr, void *p),
+                    uint32_t (*read_l)(uint32_t addr, void *p),
+                    void (*write_b)(uint32_t addr, uint8_t  val, void *p),
+                    void (*write_w)(uint32_t addr, uint16_t val, void *p),
+                    void (*write_l)(uint32_t addr, uint32_t val, void *p),
+                    uint8_t *exec,
+                    uint32_t flags,
+                    void *p)
+{
+        memset(mapping, 0, sizeof(mem_mapping_t));
+        mapping->read_b = read_b;
+        mapping->read_w = read_w;
+        mapping->read_l = read_l;
+        mapping->write_b = write_b;
+        mapping->write_w = write_w;
+        mapping->write_l = write_l;
+        mapping->exec = exec;
+        mapping->flags = flags;
+        mapping->p = p;
+}
+
+void mem_mapping_set_addr(mem_mapping_t *mapping, uint32_t base, uint32_t size)
+{
+        mapping->base = base;
+        mapping->size = size;
+        mapping->enable = 1;
+}
+
+void mem_mapping_disable(mem_mapping_t *mapping)
+{
+        mapping->enable = 0;
+}
+
+int pci_add(uint8_t (*read)(int func, int addr, void *priv), void (*write)(int func, int addr, uint8_t val, void *priv), void *priv)
+{
+        replay_pci_read = read;
+        replay_pci_write = write;
+        replay_pci_priv = priv;
+        return 0;
+}
+
+svga_t *svga_get_pri()
+{
+        return NULL;
+}
+
+void svga_set_override(svga_t *svga, int val)
+{
+}
+
+void svga_doblit(int y1, int y2, int wx, int wy, svga_t *svga)
+{
+}
+
+void video_wait_for_buffer()
+{
+}
+
+FILE *romfopen(char *fn, char *mode)
+{
+        return NULL;
+}
+
+/*Banshee entry points referenced by the shared core. Never reached, as traces
+  are only recorded on Voodoo Graphics and Voodoo 2*/
+void voodoo_2d_reg_writel(voodoo_t *voodoo, uint32_t addr, uint32_t val)
+{
+        fatal("voodoo_2d_reg_writel called on a Voodoo Graphics/2\n");
+}
+
+void banshee_set_overlay_addr(void *p, uint32_t addr)
+{
+        fatal("banshee_set_overlay_addr called on a Voodoo Graphics/2\n");
+}
+
+void voodoo_generate_vb_filters(voodoo_t *voodoo, int fcr, int fcg)
+{
+}
+
+
+static struct
+{
+        uint64_t start_time, last_frame_time;
+        uint64_t frame_time_min, frame_time_max;
+        int frames;
+
+        uint64_t pixels, texels, tris;
+        uint32_t pixel_count_old, texel_count_old;
+} stats;
+
+static void replay_update_stats(voodoo_t *voodoo)
+{
+        uint32_t pixel_count = 0, texel_count = 0;
+        int c;
+
+        /*The card's counters are 32 bit and are never reset here, so
+          accumulate the differences to avoid overflow on long traces*/
+        for (c = 0; c < 4; c++)
+        {
+                pixel_count += voodoo->pixel_count[c];
+                texel_count += voodoo->texel_count[c];
+        }
+        stats.pixels += (uint32_t)(pixel_count - stats.pixel_count_old);
+        stats.texels += (uint32_t)(texel_count - stats.texel_count_old);
+        stats.pixel_count_old = pixel_count;
+        stats.texel_count_old = texel_count;
+        /*Each render thread counts every triangle it draws a share of*/
+        stats.tris += voodoo->tri_count / voodoo->render_threads;
+        voodoo->tri_count = 0;
+}
+
+static void replay_frame(voodoo_t *voodoo)
+{
+        uint64_t now = timer_read();
+        uint64_t frame_time = now - stats.last_frame_time;
+
+        if (!stats.frames || frame_time < stats.frame_time_min)
+                stats.frame_time_min = frame_time;
+        if (frame_time > stats.frame_time_max)
+                stats.frame_time_max = frame_time;
+        stats.last_frame_time = now;
+        stats.frames++;
+}
+
+static void replay_fire_wake_timer()
+{
+        if (wake_timer && wake_timer->enabled)
+        {
+                wake_timer->enabled = 0;
+                wake_timer->callback(wake_timer->p);
+        }
+}
+
+/*Complete any buffer swaps queued up to this point, waiting for the FIFO thread
+  to reach them*/
+static void replay_retrace(voodoo_t *voodoo)
+{
+        voodoo->retrace_count++;
+
+        while (1)
+        {
+                if (voodoo->swap_pending)
+                {
+                        voodoo->retrace_count = voodoo->swap_interval + 1;
+                        voodoo_retrace_swap(voodoo);
+                        replay_frame(voodoo);
+                }
+                else if (!voodoo->swap_count)
+                        break;
+                else
+                {
+                        /*The FIFO thread doesn't signal when it reaches a swap,
+                          so poll*/
+                        thread_reset_event(voodoo->fifo_not_full_event);
+                        voodoo_wake_fifo_thread_now(voodoo);
+                        thread_wait_event(voodoo->fifo_not_full_event, 1);
+                }
+        }
+
+        replay_update_stats(voodoo);
+}
+
+static void replay_record(voodoo_t *voodoo, vid_trace_record_t *record)
+{
+        uint32_t addr = record->addr_type & VID_TRACE_ADDR;
+
+        switch (record->addr_type & VID_TRACE_TYPE)
+        {
+                case VID_TRACE_WRITE_W:
+                voodoo->mapping.write_w(addr, record->val, voodoo->mapping.p);
+                break;
+                case VID_TRACE_WRITE_L:
+                voodoo->mapping.write_l(addr, record->val, voodoo->mapping.p);
+                break;
+
+                case VID_TRACE_READ_W:
+                voodoo->mapping.read_w(addr, voodoo->mapping.p);
+                break;
+                case VID_TRACE_READ_L:
+                voodoo->mapping.read_l(addr, voodoo->mapping.p);
+                break;
+
+                case VID_TRACE_PCI_WRITE:
+                replay_pci_write(0, addr, record->val, replay_pci_priv);
+                break;
+
+                case VID_TRACE_RETRACE:
+                replay_fire_wake_timer();
+                replay_retrace(voodoo);
+                break;
+
+                default:
+                fatal("Unknown trace record %08x %08x\n", record->addr_type, record->val);
+        }
+}
+
+static void usage()
+{
+        fprintf(stderr, "usage: voodoo-replay [-t render_threads] [-r recompiler] [-v] trace\n"
+                        "  -t  number of render threads, 1, 2 or 4 (default 2)\n"
+                        "  -r  1 to use the recompiler, 0 for the interpreter (default 1)\n"
+                        "  -v  print emulator log messages\n");
+        exit(-1);
+}
+
+int main(int argc, char *argv[])
+{
+        static vid_trace_record_t records[RECORD_BLOCK];
+        vid_trace_header_t header;
+        voodoo_set_t *voodoo_set;
+        voodoo_t *voodoo;
+        uint64_t nr_records = 0;
+        uint64_t total_time;
+        double secs;
+        char *fn = NULL;
+        int since_wake = 0;
+        int nr;
+        FILE *f;
+        int c;
+
+        for (c = 1; c < argc; c++)
+        {
+                if (!strcmp(argv[c], "-t") && c+1 < argc)
+                        replay_render_threads = atoi(argv[++c]);
+                else if (!strcmp(argv[c], "-r") && c+1 < argc)
+                        replay_recompiler = atoi(argv[++c]);
+                else if (!strcmp(argv[c], "-v"))
+                        replay_verbose = 1;
+                else if (argv[c][0] == '-' || fn)
+                        usage();
+                else
+                        fn = argv[c];
+        }
+        if (!fn || (replay_render_threads != 1 && replay_render_threads != 2 && replay_render_threads != 4))
+                usage();
+
+        f = vid_trace_open_replay(fn, &header);
+        if (!f)
+                fatal("Can't open trace %s\n", fn);
+        if (header.card != VID_TRACE_VOODOO)
+                fatal("%s is not a Voodoo trace\n", fn);
+        memcpy(trace_config, header.config, sizeof(trace_config));
+
+        voodoo_set = voodoo_device.init();
+        voodoo = voodoo_set->voodoos[0];
+
+        stats.start_time = stats.last_frame_time = timer_read();
+
+        while ((nr = fread(records, sizeof(vid_trace_record_t), RECORD_BLOCK, f)) > 0)
+        {
+                for (c = 0; c < nr; c++)
+                {
+                        replay_record(voodoo, &records[c]);
+
+                        if (!wake_timer->enabled)
+                                since_wake = 0;
+                        else if (++since_wake >= WAKE_RECORDS)
+                                replay_fire_wake_timer();
+                }
+                nr_records += nr;
+        }
+        fclose(f);
+
+        replay_fire_wake_timer();
+        voodoo_flush(voodoo);
+        replay_update_stats(voodoo);
+
+        total_time = timer_read() - stats.start_time;
+        secs = (double)total_time / timer_freq;
+
+        printf("%s : %llu records, %i render threads, %s\n", fn, (unsigned long long)nr_records,
+                        replay_render_threads, replay_recompiler ? "recompiler" : "interpreter");
+        printf("%f seconds\n", secs);
+        printf("%llu triangles, %f ktris/sec\n", (unsigned long long)stats.tris, (double)stats.tris / (secs * 1000.0));
+        printf("%llu pixels, %f Mpixels/sec\n", (unsigned long long)stats.pixels, (double)stats.pixels / (secs * 1000000.0));
+        printf("%llu texels, %f Mtexels/sec\n", (unsigned long long)stats.texels, (double)stats.texels / (secs * 1000000.0));
+        if (stats.frames)
+                printf("%i frames, %f frames/sec, frame time %f/%f/%f ms (min/avg/max)\n", stats.frames,
+                        (double)stats.frames / secs,
+                        (double)stats.frame_time_min / (timer_freq / 1000),
+                        (secs * 1000.0) / stats.frames,
+                        (double)stats.frame_time_max / (timer_freq / 1000));
+
+        return 0;
+}
@@ -20,6 +20,7 @@ extern int mousecapture;
 extern int video_scale_mode;
 extern int video_vsync;
 extern int video_focus_dim;
+extern int video_postproc_filter;
 extern int video_fullscreen_mode;
 extern int video_alternative_update_lock;
 
@@ -1784,7 +1784,7 @@ static unsigned char xml_res_file_25[] = {
 87,93,129,205,251,40,255,176,89,15,134,167,154,149,127,4,24,0,227,17,114,
 29,252,169,144,138,0,0,0,0,73,69,78,68,174,66,96,130};
 
-static size_t xml_res_size_26 = 142917;
+static size_t xml_res_size_26 = 143479;
 static unsigned char xml_res_file_26[] = {
 60,63,120,109,108,32,118,101,114,115,105,111,110,61,34,49,46,48,34,32,101,
 110,99,111,100,105,110,103,61,34,85,84,70,45,56,34,63,62,10,60,33,45,45,
@@ -1858,858 +1858,959 @@ static unsigned char xml_res_file_26[] = {
 62,10,32,32,60,105,100,115,45,114,97,110,103,101,32,110,97,109,101,61,34,
 73,68,77,95,86,73,68,95,82,69,78,68,69,82,95,68,82,73,86,69,82,34,32,115,
 116,97,114,116,61,34,49,52,48,48,34,47,62,10,32,32,60,105,100,115,45,114,
-97,110,103,101,32,110,97,109,101,61,34,73,68,77,95,83,78,68,95,66,85,70,
-34,32,115,116,97,114,116,61,34,50,48,48,48,34,47,62,10,32,32,60,105,100,
-115,45,114,97,110,103,101,32,110,97,109,101,61,34,73,68,77,95,83,78,68,
-95,71,65,73,78,34,32,115,116,97,114,116,61,34,50,49,48,48,34,47,62,10,32,
+97,110,103,101,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,80,79,83,
+84,80,82,79,67,34,32,115,116,97,114,116,61,34,49,53,48,48,34,47,62,10,32,
 32,60,105,100,115,45,114,97,110,103,101,32,110,97,109,101,61,34,73,68,77,
-95,86,73,68,95,71,76,51,95,73,78,80,85,84,95,83,84,82,69,84,67,72,34,32,
-115,116,97,114,116,61,34,51,48,48,48,34,47,62,10,32,32,60,105,100,115,45,
-114,97,110,103,101,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,71,76,
-51,95,73,78,80,85,84,95,83,67,65,76,69,34,32,115,116,97,114,116,61,34,51,
-49,48,48,34,47,62,10,32,32,60,105,100,115,45,114,97,110,103,101,32,110,
-97,109,101,61,34,73,68,77,95,86,73,68,95,71,76,51,95,83,72,65,68,69,82,
-95,82,69,70,82,69,83,72,95,82,65,84,69,34,32,115,116,97,114,116,61,34,51,
-50,48,48,34,47,62,10,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,
-61,34,119,120,77,101,110,117,66,97,114,34,32,110,97,109,101,61,34,115,116,
-97,116,117,115,95,109,101,110,117,34,62,10,32,32,32,32,60,111,98,106,101,
-99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,34,62,10,32,32,
-32,32,32,32,60,108,97,98,101,108,62,95,79,112,116,105,111,110,115,60,47,
-108,97,98,101,108,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,
+95,83,78,68,95,66,85,70,34,32,115,116,97,114,116,61,34,50,48,48,48,34,47,
+62,10,32,32,60,105,100,115,45,114,97,110,103,101,32,110,97,109,101,61,34,
+73,68,77,95,83,78,68,95,71,65,73,78,34,32,115,116,97,114,116,61,34,50,49,
+48,48,34,47,62,10,32,32,60,105,100,115,45,114,97,110,103,101,32,110,97,
+109,101,61,34,73,68,77,95,86,73,68,95,71,76,51,95,73,78,80,85,84,95,83,
+84,82,69,84,67,72,34,32,115,116,97,114,116,61,34,51,48,48,48,34,47,62,10,
+32,32,60,105,100,115,45,114,97,110,103,101,32,110,97,109,101,61,34,73,68,
+77,95,86,73,68,95,71,76,51,95,73,78,80,85,84,95,83,67,65,76,69,34,32,115,
+116,97,114,116,61,34,51,49,48,48,34,47,62,10,32,32,60,105,100,115,45,114,
+97,110,103,101,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,71,76,51,
+95,83,72,65,68,69,82,95,82,69,70,82,69,83,72,95,82,65,84,69,34,32,115,116,
+97,114,116,61,34,51,50,48,48,34,47,62,10,32,32,60,111,98,106,101,99,116,
+32,99,108,97,115,115,61,34,119,120,77,101,110,117,66,97,114,34,32,110,97,
+109,101,61,34,115,116,97,116,117,115,95,109,101,110,117,34,62,10,32,32,
+32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,
+110,117,34,62,10,32,32,32,32,32,32,60,108,97,98,101,108,62,95,79,112,116,
+105,111,110,115,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,111,
+98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,
+116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,68,73,83,67,95,65,67,
+84,73,86,73,84,89,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,
+62,68,105,115,99,32,97,99,116,105,118,105,116,121,60,47,108,97,98,101,108,
+62,10,32,32,32,32,32,32,32,32,60,99,104,101,99,107,97,98,108,101,62,49,
+60,47,99,104,101,99,107,97,98,108,101,62,10,32,32,32,32,32,32,60,47,111,
+98,106,101,99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,
 108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,
-109,101,61,34,73,68,77,95,68,73,83,67,95,65,67,84,73,86,73,84,89,34,62,
-10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,68,105,115,99,32,97,
-99,116,105,118,105,116,121,60,47,108,97,98,101,108,62,10,32,32,32,32,32,
-32,32,32,60,99,104,101,99,107,97,98,108,101,62,49,60,47,99,104,101,99,107,
-97,98,108,101,62,10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,
-32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,
-120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,
-77,65,67,72,73,78,69,95,77,79,85,78,84,95,80,65,84,72,83,34,62,10,32,32,
-32,32,32,32,32,32,60,108,97,98,101,108,62,77,111,117,110,116,32,112,97,
-116,104,115,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,60,99,
-104,101,99,107,97,98,108,101,62,49,60,47,99,104,101,99,107,97,98,108,101,
-62,10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,
-32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,
-117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,83,72,79,87,95,
-83,84,65,84,85,83,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,
-62,83,116,97,116,117,115,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,
-32,32,60,99,104,101,99,107,97,98,108,101,62,49,60,47,99,104,101,99,107,
-97,98,108,101,62,10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,
+109,101,61,34,73,68,77,95,77,65,67,72,73,78,69,95,77,79,85,78,84,95,80,
+65,84,72,83,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,77,
+111,117,110,116,32,112,97,116,104,115,60,47,108,97,98,101,108,62,10,32,
+32,32,32,32,32,32,32,60,99,104,101,99,107,97,98,108,101,62,49,60,47,99,
+104,101,99,107,97,98,108,101,62,10,32,32,32,32,32,32,60,47,111,98,106,101,
+99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
+115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,
+34,73,68,77,95,83,72,79,87,95,83,84,65,84,85,83,34,62,10,32,32,32,32,32,
+32,32,32,60,108,97,98,101,108,62,83,116,97,116,117,115,60,47,108,97,98,
+101,108,62,10,32,32,32,32,32,32,32,32,60,99,104,101,99,107,97,98,108,101,
+62,49,60,47,99,104,101,99,107,97,98,108,101,62,10,32,32,32,32,32,32,60,
+47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,
+32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,
+110,97,109,101,61,34,73,68,77,95,83,80,69,69,68,95,72,73,83,84,79,82,89,
+34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,83,112,101,101,
+100,32,104,105,115,116,111,114,121,60,47,108,97,98,101,108,62,10,32,32,
+32,32,32,32,32,32,60,99,104,101,99,107,97,98,108,101,62,49,60,47,99,104,
+101,99,107,97,98,108,101,62,10,32,32,32,32,32,32,60,47,111,98,106,101,99,
+116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,
+61,34,115,101,112,97,114,97,116,111,114,34,47,62,10,32,32,32,32,32,32,60,
+111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,
+73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,83,72,79,87,95,77,
+65,67,72,73,78,69,95,79,78,95,83,84,65,82,84,34,62,10,32,32,32,32,32,32,
+32,32,60,108,97,98,101,108,62,83,104,111,119,32,111,110,32,115,116,97,114,
+116,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,60,99,104,101,
+99,107,97,98,108,101,62,49,60,47,99,104,101,99,107,97,98,108,101,62,10,
+32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,60,47,111,
+98,106,101,99,116,62,10,32,32,32,32,60,111,98,106,101,99,116,32,99,108,
+97,115,115,61,34,119,120,77,101,110,117,34,62,10,32,32,32,32,32,32,60,108,
+97,98,101,108,62,95,67,111,110,102,105,103,117,114,101,60,47,108,97,98,
+101,108,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
+115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,
+34,73,68,77,95,67,79,78,70,73,71,34,62,10,32,32,32,32,32,32,32,32,60,108,
+97,98,101,108,62,77,97,99,104,105,110,101,60,47,108,97,98,101,108,62,10,
+32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,60,47,111,
+98,106,101,99,116,62,10,32,32,32,32,60,111,98,106,101,99,116,32,99,108,
+97,115,115,61,34,119,120,77,101,110,117,34,62,10,32,32,32,32,32,32,60,108,
+97,98,101,108,62,95,77,105,115,99,60,47,108,97,98,101,108,62,10,32,32,32,
+32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,
+101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,82,69,
+83,69,84,95,67,79,78,70,73,82,77,65,84,73,79,78,95,68,73,65,76,79,71,83,
+34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,82,101,115,
+101,116,32,99,111,110,102,105,114,109,97,116,105,111,110,32,100,105,97,
+108,111,103,115,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,47,111,
+98,106,101,99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,
+108,97,115,115,61,34,115,101,112,97,114,97,116,111,114,34,47,62,10,32,32,
+32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,
+77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,65,
+66,79,85,84,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,
+65,98,111,117,116,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,47,
+111,98,106,101,99,116,62,10,32,32,32,32,60,47,111,98,106,101,99,116,62,
+10,32,32,60,47,111,98,106,101,99,116,62,10,32,32,60,111,98,106,101,99,116,
+32,99,108,97,115,115,61,34,119,120,77,101,110,117,34,32,110,97,109,101,
+61,34,109,97,105,110,95,109,101,110,117,34,62,10,32,32,32,32,60,111,98,
+106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,34,62,
+10,32,32,32,32,32,32,60,108,97,98,101,108,62,95,83,121,115,116,101,109,
+60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,
+32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,
+110,97,109,101,61,34,73,68,77,95,70,73,76,69,95,72,82,69,83,69,84,34,62,
+10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,72,97,114,100,32,
+82,101,115,101,116,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,47,
+111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,
+32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,
+110,97,109,101,61,34,73,68,77,95,70,73,76,69,95,82,69,83,69,84,95,67,65,
+68,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,67,116,114,
+108,43,65,108,116,43,68,101,108,60,47,108,97,98,101,108,62,10,32,32,32,
+32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,111,98,
+106,101,99,116,32,99,108,97,115,115,61,34,115,101,112,97,114,97,116,111,
+114,34,47,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,
+115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,
+61,34,73,68,77,95,70,73,76,69,95,69,88,73,84,34,62,10,32,32,32,32,32,32,
+32,32,60,108,97,98,101,108,62,95,83,104,117,116,100,111,119,110,60,47,108,
+97,98,101,108,62,10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,
+32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,60,111,98,106,
+101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,34,62,10,32,
+32,32,32,32,32,60,108,97,98,101,108,62,95,68,105,115,99,60,47,108,97,98,
+101,108,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
+115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,
+34,73,68,77,95,68,73,83,67,95,65,34,62,10,32,32,32,32,32,32,32,32,60,108,
+97,98,101,108,62,67,104,97,110,103,101,32,100,114,105,118,101,32,95,65,
+58,46,46,46,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,47,111,98,
+106,101,99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,
+97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,
+101,61,34,73,68,77,95,68,73,83,67,95,66,34,62,10,32,32,32,32,32,32,32,32,
+60,108,97,98,101,108,62,67,104,97,110,103,101,32,100,114,105,118,101,32,
+95,66,58,46,46,46,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,47,
+111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,
+32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,
+110,97,109,101,61,34,73,68,77,95,69,74,69,67,84,95,65,34,62,10,32,32,32,
+32,32,32,32,32,60,108,97,98,101,108,62,95,69,106,101,99,116,32,100,114,
+105,118,101,32,65,58,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,
+47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,
+32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,
+110,97,109,101,61,34,73,68,77,95,69,74,69,67,84,95,66,34,62,10,32,32,32,
+32,32,32,32,32,60,108,97,98,101,108,62,69,106,101,99,116,32,100,114,105,
+118,101,32,66,58,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,47,
+111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,
+32,99,108,97,115,115,61,34,115,101,112,97,114,97,116,111,114,34,47,62,10,
 32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,
 120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,
-83,80,69,69,68,95,72,73,83,84,79,82,89,34,62,10,32,32,32,32,32,32,32,32,
-60,108,97,98,101,108,62,83,112,101,101,100,32,104,105,115,116,111,114,121,
-60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,60,99,104,101,99,
-107,97,98,108,101,62,49,60,47,99,104,101,99,107,97,98,108,101,62,10,32,
-32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,111,
-98,106,101,99,116,32,99,108,97,115,115,61,34,115,101,112,97,114,97,116,
-111,114,34,47,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,
-97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,
-101,61,34,73,68,77,95,83,72,79,87,95,77,65,67,72,73,78,69,95,79,78,95,83,
-84,65,82,84,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,83,
-104,111,119,32,111,110,32,115,116,97,114,116,60,47,108,97,98,101,108,62,
-10,32,32,32,32,32,32,32,32,60,99,104,101,99,107,97,98,108,101,62,49,60,
-47,99,104,101,99,107,97,98,108,101,62,10,32,32,32,32,32,32,60,47,111,98,
-106,101,99,116,62,10,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,
-32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,
-110,117,34,62,10,32,32,32,32,32,32,60,108,97,98,101,108,62,95,67,111,110,
-102,105,103,117,114,101,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,
-60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,
-117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,67,79,78,70,73,
-71,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,77,97,99,104,
-105,110,101,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,47,111,98,
-106,101,99,116,62,10,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,
-32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,
-110,117,34,62,10,32,32,32,32,32,32,60,108,97,98,101,108,62,95,77,105,115,
-99,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,111,98,106,101,99,
+66,80,66,95,68,73,83,65,66,76,69,34,62,10,32,32,32,32,32,32,32,32,60,108,
+97,98,101,108,62,68,105,115,97,98,108,101,32,66,80,66,32,99,104,101,99,
+107,105,110,103,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,60,
+99,104,101,99,107,97,98,108,101,62,49,60,47,99,104,101,99,107,97,98,108,
+101,62,10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,
+32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,115,101,112,
+97,114,97,116,111,114,34,47,62,10,32,32,32,32,32,32,60,111,98,106,101,99,
 116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,
-32,110,97,109,101,61,34,73,68,77,95,82,69,83,69,84,95,67,79,78,70,73,82,
-77,65,84,73,79,78,95,68,73,65,76,79,71,83,34,62,10,32,32,32,32,32,32,32,
-32,60,108,97,98,101,108,62,95,82,101,115,101,116,32,99,111,110,102,105,
-114,109,97,116,105,111,110,32,100,105,97,108,111,103,115,60,47,108,97,98,
-101,108,62,10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,
-32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,115,101,
-112,97,114,97,116,111,114,34,47,62,10,32,32,32,32,32,32,60,111,98,106,101,
-99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,
-34,32,110,97,109,101,61,34,73,68,77,95,65,66,79,85,84,34,62,10,32,32,32,
-32,32,32,32,32,60,108,97,98,101,108,62,95,65,98,111,117,116,60,47,108,97,
-98,101,108,62,10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,
-32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,60,47,111,98,106,101,99,
-116,62,10,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,
-120,77,101,110,117,34,32,110,97,109,101,61,34,109,97,105,110,95,109,101,
-110,117,34,62,10,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
-115,61,34,119,120,77,101,110,117,34,62,10,32,32,32,32,32,32,60,108,97,98,
-101,108,62,95,83,121,115,116,101,109,60,47,108,97,98,101,108,62,10,32,32,
-32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,
-77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,70,
-73,76,69,95,72,82,69,83,69,84,34,62,10,32,32,32,32,32,32,32,32,60,108,97,
-98,101,108,62,95,72,97,114,100,32,82,101,115,101,116,60,47,108,97,98,101,
-108,62,10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,
-32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,
-101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,70,73,
-76,69,95,82,69,83,69,84,95,67,65,68,34,62,10,32,32,32,32,32,32,32,32,60,
-108,97,98,101,108,62,95,67,116,114,108,43,65,108,116,43,68,101,108,60,47,
-108,97,98,101,108,62,10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,
-10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,
-115,101,112,97,114,97,116,111,114,34,47,62,10,32,32,32,32,32,32,60,111,
-98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,
-116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,70,73,76,69,95,69,88,
-73,84,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,83,104,
-117,116,100,111,119,110,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,
-60,47,111,98,106,101,99,116,62,10,32,32,32,32,60,47,111,98,106,101,99,116,
-62,10,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,
-120,77,101,110,117,34,62,10,32,32,32,32,32,32,60,108,97,98,101,108,62,95,
-68,105,115,99,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,111,98,
-106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,
-101,109,34,32,110,97,109,101,61,34,73,68,77,95,68,73,83,67,95,65,34,62,
-10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,67,104,97,110,103,101,
-32,100,114,105,118,101,32,95,65,58,46,46,46,60,47,108,97,98,101,108,62,
-10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,
-60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,
+32,110,97,109,101,61,34,73,68,77,95,68,73,83,67,95,67,82,69,65,84,69,34,
+62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,67,114,101,97,116,
+101,32,98,108,97,110,107,32,100,105,115,99,32,105,109,97,103,101,46,46,
+46,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,47,111,98,106,101,
+99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
+115,61,34,115,101,112,97,114,97,116,111,114,34,47,62,10,32,32,32,32,32,
+32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,
 117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,68,73,83,67,95,
-66,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,67,104,97,110,
-103,101,32,100,114,105,118,101,32,95,66,58,46,46,46,60,47,108,97,98,101,
-108,62,10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,
-32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,
-101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,69,74,
-69,67,84,95,65,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,
-95,69,106,101,99,116,32,100,114,105,118,101,32,65,58,60,47,108,97,98,101,
+90,73,80,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,76,111,
+97,100,32,95,90,73,80,32,100,114,105,118,101,46,46,46,60,47,108,97,98,101,
 108,62,10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,
 32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,
 101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,69,74,
-69,67,84,95,66,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,
-69,106,101,99,116,32,100,114,105,118,101,32,66,58,60,47,108,97,98,101,108,
-62,10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,
-32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,115,101,112,97,114,
-97,116,111,114,34,47,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,
-99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,
-97,109,101,61,34,73,68,77,95,66,80,66,95,68,73,83,65,66,76,69,34,62,10,
-32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,68,105,115,97,98,108,101,
-32,66,80,66,32,99,104,101,99,107,105,110,103,60,47,108,97,98,101,108,62,
-10,32,32,32,32,32,32,32,32,60,99,104,101,99,107,97,98,108,101,62,49,60,
-47,99,104,101,99,107,97,98,108,101,62,10,32,32,32,32,32,32,60,47,111,98,
-106,101,99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,
-97,115,115,61,34,115,101,112,97,114,97,116,111,114,34,47,62,10,32,32,32,
-32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,
-101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,68,73,
-83,67,95,67,82,69,65,84,69,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,
-101,108,62,67,114,101,97,116,101,32,98,108,97,110,107,32,100,105,115,99,
-32,105,109,97,103,101,46,46,46,60,47,108,97,98,101,108,62,10,32,32,32,32,
-32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,111,98,106,
-101,99,116,32,99,108,97,115,115,61,34,115,101,112,97,114,97,116,111,114,
-34,47,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
-115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,
-34,73,68,77,95,68,73,83,67,95,90,73,80,34,62,10,32,32,32,32,32,32,32,32,
-60,108,97,98,101,108,62,76,111,97,100,32,95,90,73,80,32,100,114,105,118,
+69,67,84,95,90,73,80,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,
+108,62,69,106,101,99,116,32,90,73,80,32,100,114,105,118,101,60,47,108,97,
+98,101,108,62,10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,
+32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,60,111,98,106,101,
+99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,34,32,110,97,109,
+101,61,34,73,68,77,95,67,68,82,79,77,34,62,10,32,32,32,32,32,32,60,108,
+97,98,101,108,62,95,67,68,45,82,79,77,60,47,108,97,98,101,108,62,10,32,
+32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,
+120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,
+67,68,82,79,77,95,73,77,65,71,69,95,76,79,65,68,34,62,10,32,32,32,32,32,
+32,32,32,60,108,97,98,101,108,62,95,76,111,97,100,32,105,109,97,103,101,
+46,46,46,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,47,111,98,106,
+101,99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,
+115,115,61,34,115,101,112,97,114,97,116,111,114,34,47,62,10,32,32,32,32,
+32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,
+110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,67,68,82,
+79,77,95,69,77,80,84,89,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,
+108,62,95,69,109,112,116,121,60,47,108,97,98,101,108,62,10,32,32,32,32,
+32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,62,10,
+32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,
+111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,
+73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,67,68,82,79,77,95,
+73,77,65,71,69,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,
+95,73,109,97,103,101,46,46,46,60,47,108,97,98,101,108,62,10,32,32,32,32,
+32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,62,10,
+32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,60,47,111,
+98,106,101,99,116,62,10,32,32,32,32,60,111,98,106,101,99,116,32,99,108,
+97,115,115,61,34,119,120,77,101,110,117,34,32,110,97,109,101,61,34,73,68,
+77,95,67,65,83,83,69,84,84,69,34,62,10,32,32,32,32,32,32,60,108,97,98,101,
+108,62,67,95,97,115,115,101,116,116,101,60,47,108,97,98,101,108,62,10,32,
+32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,
+120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,
+67,65,83,83,69,84,84,69,95,76,79,65,68,34,62,10,32,32,32,32,32,32,32,32,
+60,108,97,98,101,108,62,95,76,111,97,100,32,116,97,112,101,102,105,108,
 101,46,46,46,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,47,111,
 98,106,101,99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,
 108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,
-109,101,61,34,73,68,77,95,69,74,69,67,84,95,90,73,80,34,62,10,32,32,32,
-32,32,32,32,32,60,108,97,98,101,108,62,69,106,101,99,116,32,90,73,80,32,
-100,114,105,118,101,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,
+109,101,61,34,73,68,77,95,67,65,83,83,69,84,84,69,95,69,74,69,67,84,34,
+62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,69,106,101,99,
+116,32,116,97,112,101,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,
 47,111,98,106,101,99,116,62,10,32,32,32,32,60,47,111,98,106,101,99,116,
 62,10,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,
-120,77,101,110,117,34,32,110,97,109,101,61,34,73,68,77,95,67,68,82,79,77,
-34,62,10,32,32,32,32,32,32,60,108,97,98,101,108,62,95,67,68,45,82,79,77,
-60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,
-32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,
-110,97,109,101,61,34,73,68,77,95,67,68,82,79,77,95,73,77,65,71,69,95,76,
-79,65,68,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,76,
-111,97,100,32,105,109,97,103,101,46,46,46,60,47,108,97,98,101,108,62,10,
-32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,
-111,98,106,101,99,116,32,99,108,97,115,115,61,34,115,101,112,97,114,97,
-116,111,114,34,47,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,
-108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,
-109,101,61,34,73,68,77,95,67,68,82,79,77,95,69,77,80,84,89,34,62,10,32,
-32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,69,109,112,116,121,60,47,
-108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,
-49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,60,47,111,98,106,101,
-99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
-115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,
-34,73,68,77,95,67,68,82,79,77,95,73,77,65,71,69,34,62,10,32,32,32,32,32,
-32,32,32,60,108,97,98,101,108,62,95,73,109,97,103,101,46,46,46,60,47,108,
-97,98,101,108,62,10,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,
-60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,60,47,111,98,106,101,99,
-116,62,10,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,60,
-111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,
-34,32,110,97,109,101,61,34,73,68,77,95,67,65,83,83,69,84,84,69,34,62,10,
-32,32,32,32,32,32,60,108,97,98,101,108,62,67,95,97,115,115,101,116,116,
-101,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,111,98,106,101,99,
-116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,
-32,110,97,109,101,61,34,73,68,77,95,67,65,83,83,69,84,84,69,95,76,79,65,
-68,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,76,111,97,
-100,32,116,97,112,101,102,105,108,101,46,46,46,60,47,108,97,98,101,108,
-62,10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,
+120,77,101,110,117,34,62,10,32,32,32,32,32,32,60,108,97,98,101,108,62,86,
+105,100,101,111,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,111,
+98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,34,
+62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,82,101,115,111,108,
+117,116,105,111,110,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,
 32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,
-117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,67,65,83,83,69,
-84,84,69,95,69,74,69,67,84,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,
-101,108,62,95,69,106,101,99,116,32,116,97,112,101,60,47,108,97,98,101,108,
-62,10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,60,
-47,111,98,106,101,99,116,62,10,32,32,32,32,60,111,98,106,101,99,116,32,
-99,108,97,115,115,61,34,119,120,77,101,110,117,34,62,10,32,32,32,32,32,
-32,60,108,97,98,101,108,62,86,105,100,101,111,60,47,108,97,98,101,108,62,
-10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,
-119,120,77,101,110,117,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,
-108,62,82,101,115,111,108,117,116,105,111,110,60,47,108,97,98,101,108,62,
-10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,
-61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,
-73,68,77,95,86,73,68,95,82,69,83,79,76,85,84,73,79,78,91,48,93,34,62,10,
-32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,79,114,105,103,105,
-110,97,108,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,
-60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,
-32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,
-111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,
-73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,82,69,
-83,79,76,85,84,73,79,78,91,49,93,34,62,10,32,32,32,32,32,32,32,32,32,32,
-60,108,97,98,101,108,62,82,101,115,105,122,97,98,108,101,60,47,108,97,98,
+117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,82,
+69,83,79,76,85,84,73,79,78,91,48,93,34,62,10,32,32,32,32,32,32,32,32,32,
+32,60,108,97,98,101,108,62,79,114,105,103,105,110,97,108,60,47,108,97,98,
 101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,
 60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,
 101,99,116,62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,
 108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,
 109,101,61,34,73,68,77,95,86,73,68,95,82,69,83,79,76,85,84,73,79,78,91,
-50,93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,67,
-117,115,116,111,109,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,
+49,93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,82,
+101,115,105,122,97,98,108,101,60,47,108,97,98,101,108,62,10,32,32,32,32,
+32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,
+62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,
+32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,
+120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,
+86,73,68,95,82,69,83,79,76,85,84,73,79,78,91,50,93,34,62,10,32,32,32,32,
+32,32,32,32,32,32,60,108,97,98,101,108,62,67,117,115,116,111,109,60,47,
+108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,
+111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,60,47,
+111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,
+116,32,99,108,97,115,115,61,34,115,101,112,97,114,97,116,111,114,34,47,
+62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
+115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,
+34,73,68,77,95,86,73,68,95,82,69,83,79,76,85,84,73,79,78,95,67,85,83,84,
+79,77,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,83,
+101,116,32,99,117,115,116,111,109,32,114,101,115,111,108,117,116,105,111,
+110,46,46,46,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,60,47,
+111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,
+62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,
+34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,
+68,77,95,86,73,68,95,82,69,77,69,77,66,69,82,34,62,10,32,32,32,32,32,32,
+32,32,60,108,97,98,101,108,62,82,101,109,101,109,98,101,114,32,115,105,
+122,101,32,38,97,109,112,59,38,97,109,112,59,32,112,111,115,105,116,105,
+111,110,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,60,99,104,
+101,99,107,97,98,108,101,62,49,60,47,99,104,101,99,107,97,98,108,101,62,
+10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,
+60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,115,101,112,97,114,
+97,116,111,114,34,47,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,
+99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,
+97,109,101,61,34,73,68,77,95,86,73,68,95,70,85,76,76,83,67,82,69,69,78,
+95,84,79,71,71,76,69,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,
+108,62,84,111,103,103,108,101,32,102,117,108,108,115,99,114,101,101,110,
+92,116,67,116,114,108,43,65,108,116,43,80,97,103,101,68,111,119,110,60,
+47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,
+62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,
+34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,
+68,77,95,86,73,68,95,70,85,76,76,83,67,82,69,69,78,34,62,10,32,32,32,32,
+32,32,32,32,60,108,97,98,101,108,62,70,117,108,108,115,99,114,101,101,110,
+32,111,110,32,105,110,112,117,116,32,103,114,97,98,60,47,108,97,98,101,
+108,62,10,32,32,32,32,32,32,32,32,60,99,104,101,99,107,97,98,108,101,62,
+49,60,47,99,104,101,99,107,97,98,108,101,62,10,32,32,32,32,32,32,60,47,
+111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,
+32,99,108,97,115,115,61,34,115,101,112,97,114,97,116,111,114,34,47,62,10,
+32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,
+120,77,101,110,117,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,
+62,70,117,108,108,115,99,114,101,101,110,32,109,111,100,101,60,47,108,97,
+98,101,108,62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,
+108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,
+109,101,61,34,73,68,77,95,86,73,68,95,70,83,95,77,79,68,69,91,48,93,34,
+62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,66,111,114,
+100,101,114,108,101,115,115,60,47,108,97,98,101,108,62,10,32,32,32,32,32,
+32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,62,
+10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,
+32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,
+77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,
+73,68,95,70,83,95,77,79,68,69,91,49,93,34,62,10,32,32,32,32,32,32,32,32,
+32,32,60,108,97,98,101,108,62,95,69,120,99,108,117,115,105,118,101,60,47,
+108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,
+111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,60,47,
+111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,
+62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,
+34,119,120,77,101,110,117,34,32,110,97,109,101,61,34,73,68,77,95,86,73,
+68,95,82,69,78,68,69,82,95,68,82,73,86,69,82,34,62,10,32,32,32,32,32,32,
+32,32,60,108,97,98,101,108,62,95,82,101,110,100,101,114,32,100,114,105,
+118,101,114,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,60,111,
+98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,
+116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,82,69,78,
+68,69,82,95,68,82,73,86,69,82,91,48,93,34,62,10,32,32,32,32,32,32,32,32,
+32,32,60,108,97,98,101,108,62,65,117,116,111,60,47,108,97,98,101,108,62,
+10,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,
+97,100,105,111,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,
+62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
+115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,
+34,73,68,77,95,86,73,68,95,82,69,78,68,69,82,95,68,82,73,86,69,82,91,49,
+93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,68,105,
+114,101,99,116,51,68,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,
 32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,62,10,32,
 32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,
-32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,115,101,112,97,
-114,97,116,111,114,34,47,62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,
-99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,
-34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,82,69,83,79,76,85,84,
-73,79,78,95,67,85,83,84,79,77,34,62,10,32,32,32,32,32,32,32,32,32,32,60,
-108,97,98,101,108,62,83,101,116,32,99,117,115,116,111,109,32,114,101,115,
-111,108,117,116,105,111,110,46,46,46,60,47,108,97,98,101,108,62,10,32,32,
-32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,
-47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,
+32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,
+110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,
+95,82,69,78,68,69,82,95,68,82,73,86,69,82,91,50,93,34,62,10,32,32,32,32,
+32,32,32,32,32,32,60,108,97,98,101,108,62,79,112,101,110,71,76,60,47,108,
+97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,
+62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,60,47,111,
+98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,
 32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,
-110,97,109,101,61,34,73,68,77,95,86,73,68,95,82,69,77,69,77,66,69,82,34,
-62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,82,101,109,101,109,
-98,101,114,32,115,105,122,101,32,38,97,109,112,59,38,97,109,112,59,32,112,
-111,115,105,116,105,111,110,60,47,108,97,98,101,108,62,10,32,32,32,32,32,
+110,97,109,101,61,34,73,68,77,95,86,73,68,95,82,69,78,68,69,82,95,68,82,
+73,86,69,82,91,54,93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,
+101,108,62,79,112,101,110,71,76,32,51,46,48,60,47,108,97,98,101,108,62,
+10,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,
+97,100,105,111,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,
+62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
+115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,
+34,73,68,77,95,86,73,68,95,82,69,78,68,69,82,95,68,82,73,86,69,82,91,53,
+93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,83,111,
+102,116,119,97,114,101,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,
+32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,62,10,
+32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,
+32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,
+99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,
+34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,86,83,89,78,67,34,62,
+10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,86,83,121,110,99,
+60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,60,99,104,101,99,
+107,97,98,108,101,62,49,60,47,99,104,101,99,107,97,98,108,101,62,10,32,
+32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,111,
+98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,
+116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,76,79,83,
+84,95,70,79,67,85,83,95,68,73,77,34,62,10,32,32,32,32,32,32,32,32,60,108,
+97,98,101,108,62,95,68,105,109,32,100,105,115,112,108,97,121,32,111,110,
+32,108,111,115,116,32,102,111,99,117,115,60,47,108,97,98,101,108,62,10,
+32,32,32,32,32,32,32,32,60,99,104,101,99,107,97,98,108,101,62,49,60,47,
+99,104,101,99,107,97,98,108,101,62,10,32,32,32,32,32,32,60,47,111,98,106,
+101,99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,
+115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,
+61,34,73,68,77,95,86,73,68,95,65,76,84,69,82,78,65,84,73,86,69,95,85,80,
+68,65,84,69,95,76,79,67,75,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,
+101,108,62,65,108,116,101,114,110,97,116,105,118,101,32,117,112,100,97,
+116,101,45,108,111,99,107,60,47,108,97,98,101,108,62,10,32,32,32,32,32,
 32,32,32,60,99,104,101,99,107,97,98,108,101,62,49,60,47,99,104,101,99,107,
 97,98,108,101,62,10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,
 32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,115,
 101,112,97,114,97,116,111,114,34,47,62,10,32,32,32,32,32,32,60,111,98,106,
-101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,
-109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,70,85,76,76,83,67,
-82,69,69,78,95,84,79,71,71,76,69,34,62,10,32,32,32,32,32,32,32,32,60,108,
-97,98,101,108,62,84,111,103,103,108,101,32,102,117,108,108,115,99,114,101,
-101,110,92,116,67,116,114,108,43,65,108,116,43,80,97,103,101,68,111,119,
-110,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,47,111,98,106,101,
-99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
-115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,
-34,73,68,77,95,86,73,68,95,70,85,76,76,83,67,82,69,69,78,34,62,10,32,32,
-32,32,32,32,32,32,60,108,97,98,101,108,62,70,117,108,108,115,99,114,101,
-101,110,32,111,110,32,105,110,112,117,116,32,103,114,97,98,60,47,108,97,
-98,101,108,62,10,32,32,32,32,32,32,32,32,60,99,104,101,99,107,97,98,108,
-101,62,49,60,47,99,104,101,99,107,97,98,108,101,62,10,32,32,32,32,32,32,
-60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,
-116,32,99,108,97,115,115,61,34,115,101,112,97,114,97,116,111,114,34,47,
-62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,
-34,119,120,77,101,110,117,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,
-101,108,62,70,117,108,108,115,99,114,101,101,110,32,109,111,100,101,60,
-47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,
-116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,
-32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,70,83,95,77,79,68,69,91,
-48,93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,
-66,111,114,100,101,114,108,101,115,115,60,47,108,97,98,101,108,62,10,32,
-32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,
-105,111,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,
-32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,
-34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,
-68,77,95,86,73,68,95,70,83,95,77,79,68,69,91,49,93,34,62,10,32,32,32,32,
-32,32,32,32,32,32,60,108,97,98,101,108,62,95,69,120,99,108,117,115,105,
-118,101,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,
-114,97,100,105,111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,
-32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,47,111,
-98,106,101,99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,
-108,97,115,115,61,34,119,120,77,101,110,117,34,32,110,97,109,101,61,34,
-73,68,77,95,86,73,68,95,82,69,78,68,69,82,95,68,82,73,86,69,82,34,62,10,
-32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,82,101,110,100,101,114,
-32,100,114,105,118,101,114,60,47,108,97,98,101,108,62,10,32,32,32,32,32,
+101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,34,62,10,32,
+32,32,32,32,32,32,32,60,108,97,98,101,108,62,83,99,97,108,101,32,102,105,
+108,116,101,114,105,110,103,60,47,108,97,98,101,108,62,10,32,32,32,32,32,
 32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,
 101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,
-68,95,82,69,78,68,69,82,95,68,82,73,86,69,82,91,48,93,34,62,10,32,32,32,
-32,32,32,32,32,32,32,60,108,97,98,101,108,62,65,117,116,111,60,47,108,97,
-98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,
-49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,60,47,111,98,
-106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,
-99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,
-97,109,101,61,34,73,68,77,95,86,73,68,95,82,69,78,68,69,82,95,68,82,73,
-86,69,82,91,49,93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,
-108,62,68,105,114,101,99,116,51,68,60,47,108,97,98,101,108,62,10,32,32,
-32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,
-111,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,
-32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,
-119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,
-77,95,86,73,68,95,82,69,78,68,69,82,95,68,82,73,86,69,82,91,50,93,34,62,
-10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,79,112,101,110,
-71,76,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,114,
-97,100,105,111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,
-32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,111,98,
-106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,
-101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,82,69,78,68,
-69,82,95,68,82,73,86,69,82,91,54,93,34,62,10,32,32,32,32,32,32,32,32,32,
-32,60,108,97,98,101,108,62,79,112,101,110,71,76,32,51,46,48,60,47,108,97,
-98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,
-49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,60,47,111,98,
-106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,
-99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,
-97,109,101,61,34,73,68,77,95,86,73,68,95,82,69,78,68,69,82,95,68,82,73,
-86,69,82,91,53,93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,
-108,62,83,111,102,116,119,97,114,101,60,47,108,97,98,101,108,62,10,32,32,
-32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,
-111,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,
-32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,111,
-98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,
-116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,86,83,89,
-78,67,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,86,83,
-121,110,99,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,60,99,
-104,101,99,107,97,98,108,101,62,49,60,47,99,104,101,99,107,97,98,108,101,
-62,10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,
-32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,
-117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,76,
-79,83,84,95,70,79,67,85,83,95,68,73,77,34,62,10,32,32,32,32,32,32,32,32,
-60,108,97,98,101,108,62,95,68,105,109,32,100,105,115,112,108,97,121,32,
-111,110,32,108,111,115,116,32,102,111,99,117,115,60,47,108,97,98,101,108,
-62,10,32,32,32,32,32,32,32,32,60,99,104,101,99,107,97,98,108,101,62,49,
-60,47,99,104,101,99,107,97,98,108,101,62,10,32,32,32,32,32,32,60,47,111,
-98,106,101,99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,
-108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,
-109,101,61,34,73,68,77,95,86,73,68,95,65,76,84,69,82,78,65,84,73,86,69,
-95,85,80,68,65,84,69,95,76,79,67,75,34,62,10,32,32,32,32,32,32,32,32,60,
-108,97,98,101,108,62,65,108,116,101,114,110,97,116,105,118,101,32,117,112,
-100,97,116,101,45,108,111,99,107,60,47,108,97,98,101,108,62,10,32,32,32,
-32,32,32,32,32,60,99,104,101,99,107,97,98,108,101,62,49,60,47,99,104,101,
-99,107,97,98,108,101,62,10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,
-62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,
-34,115,101,112,97,114,97,116,111,114,34,47,62,10,32,32,32,32,32,32,60,111,
-98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,34,
-62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,83,99,97,108,101,
-32,102,105,108,116,101,114,105,110,103,60,47,108,97,98,101,108,62,10,32,
-32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,
-119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,
-77,95,86,73,68,95,83,67,65,76,69,95,77,79,68,69,91,48,93,34,62,10,32,32,
-32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,78,101,97,114,101,115,
-116,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,114,
-97,100,105,111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,
-32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,111,98,
-106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,
-101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,83,67,65,76,
-69,95,77,79,68,69,91,49,93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,
-97,98,101,108,62,95,76,105,110,101,97,114,60,47,108,97,98,101,108,62,10,
-32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,
-100,105,111,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,
-10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,
-60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,
-117,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,79,117,116,
-112,117,116,32,115,116,114,101,116,99,104,45,109,111,100,101,60,47,108,
-97,98,101,108,62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,
-99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,
-97,109,101,61,34,73,68,77,95,86,73,68,95,70,83,91,48,93,34,62,10,32,32,
-32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,78,111,110,101,60,47,
-108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,
-111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,60,47,
-111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,
-116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,
-32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,70,83,91,49,93,34,62,10,
-32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,52,58,51,60,47,
+68,95,83,67,65,76,69,95,77,79,68,69,91,48,93,34,62,10,32,32,32,32,32,32,
+32,32,32,32,60,108,97,98,101,108,62,95,78,101,97,114,101,115,116,60,47,
 108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,
 111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,60,47,
 111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,
 116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,
-32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,70,83,91,50,93,34,62,10,
-32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,83,113,117,97,
-114,101,32,112,105,120,101,108,115,60,47,108,97,98,101,108,62,10,32,32,
-32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,
-111,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,
-32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,
-119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,
-77,95,86,73,68,95,70,83,91,51,93,34,62,10,32,32,32,32,32,32,32,32,32,32,
-60,108,97,98,101,108,62,95,73,110,116,101,103,101,114,32,115,99,97,108,
+32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,83,67,65,76,69,95,77,79,
+68,69,91,49,93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,
+108,62,95,76,105,110,101,97,114,60,47,108,97,98,101,108,62,10,32,32,32,
+32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,
+62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,
+32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,111,98,
+106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,34,62,
+10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,67,80,85,32,112,111,
+115,116,45,112,114,111,99,101,115,115,105,110,103,60,47,108,97,98,101,108,
+62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
+115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,
+34,73,68,77,95,86,73,68,95,80,79,83,84,80,82,79,67,91,48,93,34,62,10,32,
+32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,78,111,110,101,60,
+47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,114,97,100,
+105,111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,60,
+47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,
+99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,
+34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,80,79,83,84,80,82,79,
+67,91,49,93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,
+62,95,83,99,97,110,108,105,110,101,115,60,47,108,97,98,101,108,62,10,32,
+32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,
+105,111,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,
+32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,
+34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,
+68,77,95,86,73,68,95,80,79,83,84,80,82,79,67,91,50,93,34,62,10,32,32,32,
+32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,67,82,84,60,47,108,97,98,
+101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,
+60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,
+101,99,116,62,10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,
+32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,
+120,77,101,110,117,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,
+62,79,117,116,112,117,116,32,115,116,114,101,116,99,104,45,109,111,100,
+101,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,60,111,98,106,
+101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,
+109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,70,83,91,48,93,34,
+62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,78,111,110,
 101,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,114,
 97,100,105,111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,
-32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,47,111,98,106,
-101,99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,
-115,115,61,34,119,120,77,101,110,117,34,32,110,97,109,101,61,34,73,68,77,
-95,86,73,68,95,83,67,65,76,69,95,77,69,78,85,34,62,10,32,32,32,32,32,32,
-32,32,60,108,97,98,101,108,62,79,117,116,112,117,116,32,115,99,97,108,101,
-60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,
-99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,
-34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,83,67,65,76,69,91,48,
-93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,48,46,
-53,120,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,114,
+32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,111,98,
+106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,
+101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,70,83,91,49,
+93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,52,
+58,51,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,114,
 97,100,105,111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,
 32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,111,98,
 106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,
-101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,83,67,65,76,
-69,91,49,93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,
-62,49,120,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,
-114,97,100,105,111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,
-32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,111,
+101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,70,83,91,50,
+93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,83,
+113,117,97,114,101,32,112,105,120,101,108,115,60,47,108,97,98,101,108,62,
+10,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,
+97,100,105,111,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,
+62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
+115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,
+34,73,68,77,95,86,73,68,95,70,83,91,51,93,34,62,10,32,32,32,32,32,32,32,
+32,32,32,60,108,97,98,101,108,62,95,73,110,116,101,103,101,114,32,115,99,
+97,108,101,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,
+60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,
+32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,47,111,
+98,106,101,99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,
+108,97,115,115,61,34,119,120,77,101,110,117,34,32,110,97,109,101,61,34,
+73,68,77,95,86,73,68,95,83,67,65,76,69,95,77,69,78,85,34,62,10,32,32,32,
+32,32,32,32,32,60,108,97,98,101,108,62,79,117,116,112,117,116,32,115,99,
+97,108,101,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,60,111,
 98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,
 116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,83,67,65,
-76,69,91,50,93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,
-108,62,49,46,53,120,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,
+76,69,91,48,93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,
+108,62,48,46,53,120,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,
 32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,62,10,32,
 32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,
 32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,
 110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,
-95,83,67,65,76,69,91,51,93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,
-97,98,101,108,62,50,120,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,
+95,83,67,65,76,69,91,49,93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,
+97,98,101,108,62,49,120,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,
 32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,62,10,
 32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,
 32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,
 101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,
-68,95,83,67,65,76,69,91,52,93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,
-108,97,98,101,108,62,50,46,53,120,60,47,108,97,98,101,108,62,10,32,32,32,
+68,95,83,67,65,76,69,91,50,93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,
+108,97,98,101,108,62,49,46,53,120,60,47,108,97,98,101,108,62,10,32,32,32,
 32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,
 62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,
 32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,
 120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,
-86,73,68,95,83,67,65,76,69,91,53,93,34,62,10,32,32,32,32,32,32,32,32,32,
-32,60,108,97,98,101,108,62,51,120,60,47,108,97,98,101,108,62,10,32,32,32,
+86,73,68,95,83,67,65,76,69,91,51,93,34,62,10,32,32,32,32,32,32,32,32,32,
+32,60,108,97,98,101,108,62,50,120,60,47,108,97,98,101,108,62,10,32,32,32,
 32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,
 62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,
 32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,
 120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,
-86,73,68,95,83,67,65,76,69,91,54,93,34,62,10,32,32,32,32,32,32,32,32,32,
-32,60,108,97,98,101,108,62,51,46,53,120,60,47,108,97,98,101,108,62,10,32,
+86,73,68,95,83,67,65,76,69,91,52,93,34,62,10,32,32,32,32,32,32,32,32,32,
+32,60,108,97,98,101,108,62,50,46,53,120,60,47,108,97,98,101,108,62,10,32,
 32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,
 105,111,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,
 32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,
 34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,
-68,77,95,86,73,68,95,83,67,65,76,69,91,55,93,34,62,10,32,32,32,32,32,32,
-32,32,32,32,60,108,97,98,101,108,62,52,120,60,47,108,97,98,101,108,62,10,
+68,77,95,86,73,68,95,83,67,65,76,69,91,53,93,34,62,10,32,32,32,32,32,32,
+32,32,32,32,60,108,97,98,101,108,62,51,120,60,47,108,97,98,101,108,62,10,
 32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,
 100,105,111,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,
-10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,
-60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,115,101,112,97,114,
-97,116,111,114,34,47,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,
-99,108,97,115,115,61,34,119,120,77,101,110,117,34,32,110,97,109,101,61,
-34,73,68,77,95,86,73,68,95,71,76,51,34,62,10,32,32,32,32,32,32,32,32,60,
-108,97,98,101,108,62,79,112,101,110,71,76,32,51,46,48,32,114,101,110,100,
-101,114,101,114,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,60,
-111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,
-34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,73,110,112,
-117,116,32,115,116,114,101,116,99,104,45,109,111,100,101,60,47,108,97,98,
-101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,
-99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,
-97,109,101,61,34,73,68,77,95,86,73,68,95,71,76,51,95,73,78,80,85,84,95,
-83,84,82,69,84,67,72,91,48,93,34,62,10,32,32,32,32,32,32,32,32,32,32,32,
-32,60,108,97,98,101,108,62,95,78,111,110,101,60,47,108,97,98,101,108,62,
-10,32,32,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,
-114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,
-101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,
-32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,
-110,97,109,101,61,34,73,68,77,95,86,73,68,95,71,76,51,95,73,78,80,85,84,
-95,83,84,82,69,84,67,72,91,49,93,34,62,10,32,32,32,32,32,32,32,32,32,32,
-32,32,60,108,97,98,101,108,62,95,52,58,51,60,47,108,97,98,101,108,62,10,
-32,32,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,
-97,100,105,111,62,10,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,
-99,116,62,10,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,
-99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,
-97,109,101,61,34,73,68,77,95,86,73,68,95,71,76,51,95,73,78,80,85,84,95,
-83,84,82,69,84,67,72,91,50,93,34,62,10,32,32,32,32,32,32,32,32,32,32,32,
-32,60,108,97,98,101,108,62,95,83,113,117,97,114,101,32,112,105,120,101,
-108,115,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,32,
-32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,
-32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,
-32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,
-77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,
-73,68,95,71,76,51,95,73,78,80,85,84,95,83,84,82,69,84,67,72,91,51,93,34,
-62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,73,
-110,116,101,103,101,114,32,115,99,97,108,101,60,47,108,97,98,101,108,62,
-10,32,32,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,
-114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,
-101,99,116,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,
 10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,
-61,34,119,120,77,101,110,117,34,62,10,32,32,32,32,32,32,32,32,32,32,60,
-108,97,98,101,108,62,73,110,112,117,116,32,115,99,97,108,101,60,47,108,
-97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,
-116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,
-32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,71,76,51,95,73,78,80,85,
-84,95,83,67,65,76,69,91,48,93,34,62,10,32,32,32,32,32,32,32,32,32,32,32,
-32,60,108,97,98,101,108,62,48,46,53,120,60,47,108,97,98,101,108,62,10,32,
-32,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,
+61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,
+73,68,77,95,86,73,68,95,83,67,65,76,69,91,54,93,34,62,10,32,32,32,32,32,
+32,32,32,32,32,60,108,97,98,101,108,62,51,46,53,120,60,47,108,97,98,101,
+108,62,10,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,
+47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,
+99,116,62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,
+97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,
+101,61,34,73,68,77,95,86,73,68,95,83,67,65,76,69,91,55,93,34,62,10,32,32,
+32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,52,120,60,47,108,97,98,
+101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,
+60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,
+101,99,116,62,10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,
+32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,115,
+101,112,97,114,97,116,111,114,34,47,62,10,32,32,32,32,32,32,60,111,98,106,
+101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,34,32,110,
+97,109,101,61,34,73,68,77,95,86,73,68,95,71,76,51,34,62,10,32,32,32,32,
+32,32,32,32,60,108,97,98,101,108,62,79,112,101,110,71,76,32,51,46,48,32,
+114,101,110,100,101,114,101,114,60,47,108,97,98,101,108,62,10,32,32,32,
+32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,
+120,77,101,110,117,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,
+101,108,62,73,110,112,117,116,32,115,116,114,101,116,99,104,45,109,111,
+100,101,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,
+111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,
+73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,71,76,
+51,95,73,78,80,85,84,95,83,84,82,69,84,67,72,91,48,93,34,62,10,32,32,32,
+32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,78,111,110,101,60,
+47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,114,97,
+100,105,111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,
+32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,60,
+111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,
+73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,71,76,
+51,95,73,78,80,85,84,95,83,84,82,69,84,67,72,91,49,93,34,62,10,32,32,32,
+32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,52,58,51,60,47,108,
+97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,
+111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,32,32,
+60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,60,111,
+98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,
+116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,71,76,51,
+95,73,78,80,85,84,95,83,84,82,69,84,67,72,91,50,93,34,62,10,32,32,32,32,
+32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,83,113,117,97,114,101,
+32,112,105,120,101,108,115,60,47,108,97,98,101,108,62,10,32,32,32,32,32,
+32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,
+62,10,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,
+32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,
+61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,
+73,68,77,95,86,73,68,95,71,76,51,95,73,78,80,85,84,95,83,84,82,69,84,67,
+72,91,51,93,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,
+108,62,95,73,110,116,101,103,101,114,32,115,99,97,108,101,60,47,108,97,
+98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,
+111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,32,32,
+60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,47,111,98,
+106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,
+99,108,97,115,115,61,34,119,120,77,101,110,117,34,62,10,32,32,32,32,32,
+32,32,32,32,32,60,108,97,98,101,108,62,73,110,112,117,116,32,115,99,97,
+108,101,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,
+111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,
+73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,71,76,
+51,95,73,78,80,85,84,95,83,67,65,76,69,91,48,93,34,62,10,32,32,32,32,32,
+32,32,32,32,32,32,32,60,108,97,98,101,108,62,48,46,53,120,60,47,108,97,
+98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,
+111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,32,32,
+60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,60,111,
+98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,
+116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,71,76,51,
+95,73,78,80,85,84,95,83,67,65,76,69,91,49,93,34,62,10,32,32,32,32,32,32,
+32,32,32,32,32,32,60,108,97,98,101,108,62,49,120,60,47,108,97,98,101,108,
+62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,
+47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,32,32,60,47,111,98,
+106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,
+116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,
+32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,71,76,51,95,73,78,80,85,
+84,95,83,67,65,76,69,91,50,93,34,62,10,32,32,32,32,32,32,32,32,32,32,32,
+32,60,108,97,98,101,108,62,49,46,53,120,60,47,108,97,98,101,108,62,10,32,
+32,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,
 97,100,105,111,62,10,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,
 99,116,62,10,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,
 99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,
 97,109,101,61,34,73,68,77,95,86,73,68,95,71,76,51,95,73,78,80,85,84,95,
-83,67,65,76,69,91,49,93,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,
-108,97,98,101,108,62,49,120,60,47,108,97,98,101,108,62,10,32,32,32,32,32,
+83,67,65,76,69,91,51,93,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,
+108,97,98,101,108,62,50,120,60,47,108,97,98,101,108,62,10,32,32,32,32,32,
 32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,
 62,10,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,
 32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,
 61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,
 73,68,77,95,86,73,68,95,71,76,51,95,73,78,80,85,84,95,83,67,65,76,69,91,
-50,93,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,
-62,49,46,53,120,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,
+52,93,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,
+62,50,46,53,120,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,
 32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,62,10,32,
 32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,
 32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,
 120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,
-86,73,68,95,71,76,51,95,73,78,80,85,84,95,83,67,65,76,69,91,51,93,34,62,
-10,32,32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,50,120,60,
+86,73,68,95,71,76,51,95,73,78,80,85,84,95,83,67,65,76,69,91,53,93,34,62,
+10,32,32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,51,120,60,
 47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,114,97,
 100,105,111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,
 32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,60,
 111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,
 73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,71,76,
-51,95,73,78,80,85,84,95,83,67,65,76,69,91,52,93,34,62,10,32,32,32,32,32,
-32,32,32,32,32,32,32,60,108,97,98,101,108,62,50,46,53,120,60,47,108,97,
+51,95,73,78,80,85,84,95,83,67,65,76,69,91,54,93,34,62,10,32,32,32,32,32,
+32,32,32,32,32,32,32,60,108,97,98,101,108,62,51,46,53,120,60,47,108,97,
 98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,
 111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,32,32,
 60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,60,111,
 98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,
 116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,71,76,51,
-95,73,78,80,85,84,95,83,67,65,76,69,91,53,93,34,62,10,32,32,32,32,32,32,
-32,32,32,32,32,32,60,108,97,98,101,108,62,51,120,60,47,108,97,98,101,108,
+95,73,78,80,85,84,95,83,67,65,76,69,91,55,93,34,62,10,32,32,32,32,32,32,
+32,32,32,32,32,32,60,108,97,98,101,108,62,52,120,60,47,108,97,98,101,108,
+62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,
+47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,32,32,60,47,111,98,
+106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,
+62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
+115,61,34,119,120,77,101,110,117,34,62,10,32,32,32,32,32,32,32,32,32,32,
+60,108,97,98,101,108,62,83,104,97,100,101,114,32,114,101,102,114,101,115,
+104,32,114,97,116,101,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,
+32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,
+101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,
+68,95,71,76,51,95,83,72,65,68,69,82,95,82,69,70,82,69,83,72,95,82,65,84,
+69,91,48,93,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,
+108,62,83,97,109,101,32,97,115,32,101,109,117,108,97,116,101,100,32,100,
+105,115,112,108,97,121,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,
+32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,
+62,10,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,
+32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,
+61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,
+73,68,77,95,86,73,68,95,71,76,51,95,83,72,65,68,69,82,95,82,69,70,82,69,
+83,72,95,82,65,84,69,91,49,48,93,34,62,10,32,32,32,32,32,32,32,32,32,32,
+32,32,60,108,97,98,101,108,62,49,48,32,104,122,60,47,108,97,98,101,108,
 62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,
 47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,32,32,60,47,111,98,
 106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,
 116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,
-32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,71,76,51,95,73,78,80,85,
-84,95,83,67,65,76,69,91,54,93,34,62,10,32,32,32,32,32,32,32,32,32,32,32,
-32,60,108,97,98,101,108,62,51,46,53,120,60,47,108,97,98,101,108,62,10,32,
-32,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,
-97,100,105,111,62,10,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,
-99,116,62,10,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,
-99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,
-97,109,101,61,34,73,68,77,95,86,73,68,95,71,76,51,95,73,78,80,85,84,95,
-83,67,65,76,69,91,55,93,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,
-108,97,98,101,108,62,52,120,60,47,108,97,98,101,108,62,10,32,32,32,32,32,
-32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,
-62,10,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,
-32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,
-32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,
-110,117,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,
-83,104,97,100,101,114,32,114,101,102,114,101,115,104,32,114,97,116,101,
-60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,111,98,106,
-101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,
-109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,71,76,51,95,83,72,
-65,68,69,82,95,82,69,70,82,69,83,72,95,82,65,84,69,91,48,93,34,62,10,32,
-32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,83,97,109,101,
-32,97,115,32,101,109,117,108,97,116,101,100,32,100,105,115,112,108,97,121,
+32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,71,76,51,95,83,72,65,68,
+69,82,95,82,69,70,82,69,83,72,95,82,65,84,69,91,50,53,93,34,62,10,32,32,
+32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,50,53,32,104,122,
 60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,114,
 97,100,105,111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,
 32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,
 60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,
 117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,71,
-76,51,95,83,72,65,68,69,82,95,82,69,70,82,69,83,72,95,82,65,84,69,91,49,
+76,51,95,83,72,65,68,69,82,95,82,69,70,82,69,83,72,95,82,65,84,69,91,51,
 48,93,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,
-62,49,48,32,104,122,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,
+62,51,48,32,104,122,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,
 32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,62,
 10,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,
 32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,
 34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,
 68,77,95,86,73,68,95,71,76,51,95,83,72,65,68,69,82,95,82,69,70,82,69,83,
-72,95,82,65,84,69,91,50,53,93,34,62,10,32,32,32,32,32,32,32,32,32,32,32,
-32,60,108,97,98,101,108,62,50,53,32,104,122,60,47,108,97,98,101,108,62,
+72,95,82,65,84,69,91,53,48,93,34,62,10,32,32,32,32,32,32,32,32,32,32,32,
+32,60,108,97,98,101,108,62,53,48,32,104,122,60,47,108,97,98,101,108,62,
 10,32,32,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,
 114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,
 101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,
 32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,
 110,97,109,101,61,34,73,68,77,95,86,73,68,95,71,76,51,95,83,72,65,68,69,
-82,95,82,69,70,82,69,83,72,95,82,65,84,69,91,51,48,93,34,62,10,32,32,32,
-32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,51,48,32,104,122,60,
+82,95,82,69,70,82,69,83,72,95,82,65,84,69,91,54,48,93,34,62,10,32,32,32,
+32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,54,48,32,104,122,60,
 47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,114,97,
 100,105,111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,
 32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,60,
 111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,
 73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,71,76,
-51,95,83,72,65,68,69,82,95,82,69,70,82,69,83,72,95,82,65,84,69,91,53,48,
+51,95,83,72,65,68,69,82,95,82,69,70,82,69,83,72,95,82,65,84,69,91,55,50,
 93,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,
-53,48,32,104,122,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,
+55,50,32,104,122,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,
 32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,62,10,
 32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,
 32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,
 119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,
 77,95,86,73,68,95,71,76,51,95,83,72,65,68,69,82,95,82,69,70,82,69,83,72,
-95,82,65,84,69,91,54,48,93,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,
-60,108,97,98,101,108,62,54,48,32,104,122,60,47,108,97,98,101,108,62,10,
+95,82,65,84,69,91,56,53,93,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,
+60,108,97,98,101,108,62,56,53,32,104,122,60,47,108,97,98,101,108,62,10,
 32,32,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,
 97,100,105,111,62,10,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,
-99,116,62,10,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,
-99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,
-97,109,101,61,34,73,68,77,95,86,73,68,95,71,76,51,95,83,72,65,68,69,82,
-95,82,69,70,82,69,83,72,95,82,65,84,69,91,55,50,93,34,62,10,32,32,32,32,
-32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,55,50,32,104,122,60,47,
-108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,114,97,100,
-105,111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,32,
-32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,60,111,
-98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,
-116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,71,76,51,
-95,83,72,65,68,69,82,95,82,69,70,82,69,83,72,95,82,65,84,69,91,56,53,93,
-34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,56,
-53,32,104,122,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,
-32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,62,10,32,
-32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,
-32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,
-111,98,106,101,99,116,32,99,108,97,115,115,61,34,115,101,112,97,114,97,
-116,111,114,34,47,62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,
-32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,
-110,97,109,101,61,34,73,68,77,95,86,73,68,95,71,76,51,95,83,72,65,68,69,
-82,95,77,65,78,65,71,69,82,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,
-97,98,101,108,62,83,104,97,100,101,114,32,109,97,110,97,103,101,114,60,
-47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,
-99,116,62,10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,
-32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,60,111,98,106,101,99,
-116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,34,62,10,32,32,32,
-32,32,32,60,108,97,98,101,108,62,83,111,117,110,100,60,47,108,97,98,101,
-108,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,
-61,34,119,120,77,101,110,117,34,62,10,32,32,32,32,32,32,32,32,60,108,97,
-98,101,108,62,95,66,117,102,102,101,114,32,108,101,110,103,116,104,60,47,
-108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,
-32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,
-110,97,109,101,61,34,73,68,77,95,83,78,68,95,66,85,70,91,48,93,34,62,10,
-32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,53,48,32,109,115,
-60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,114,97,100,
-105,111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,60,
-47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,
-99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,
-34,32,110,97,109,101,61,34,73,68,77,95,83,78,68,95,66,85,70,91,49,93,34,
-62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,49,48,48,
-32,109,115,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,
-60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,
-32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,
+99,116,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,
+32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,
+34,115,101,112,97,114,97,116,111,114,34,47,62,10,32,32,32,32,32,32,32,32,
+60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,
+117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,86,73,68,95,71,
+76,51,95,83,72,65,68,69,82,95,77,65,78,65,71,69,82,34,62,10,32,32,32,32,
+32,32,32,32,32,32,60,108,97,98,101,108,62,83,104,97,100,101,114,32,109,
+97,110,97,103,101,114,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,
+32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,47,111,98,106,
+101,99,116,62,10,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,
+32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,
+117,34,62,10,32,32,32,32,32,32,60,108,97,98,101,108,62,83,111,117,110,100,
+60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,
+32,99,108,97,115,115,61,34,119,120,77,101,110,117,34,62,10,32,32,32,32,
+32,32,32,32,60,108,97,98,101,108,62,95,66,117,102,102,101,114,32,108,101,
+110,103,116,104,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,60,
 111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,
 73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,83,78,68,95,66,85,
-70,91,50,93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,
-62,95,50,48,48,32,109,115,60,47,108,97,98,101,108,62,10,32,32,32,32,32,
-32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,62,
-10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,
-32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,
-77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,83,
-78,68,95,66,85,70,91,51,93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,
-97,98,101,108,62,95,52,48,48,32,109,115,60,47,108,97,98,101,108,62,10,32,
-32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,
-105,111,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,
-32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,
-111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,
-34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,79,117,116,
-112,117,116,32,108,101,118,101,108,60,47,108,97,98,101,108,62,10,32,32,
-32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,
-120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,
-83,78,68,95,71,65,73,78,91,48,93,34,62,10,32,32,32,32,32,32,32,32,32,32,
-60,108,97,98,101,108,62,95,78,111,114,109,97,108,60,47,108,97,98,101,108,
+70,91,48,93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,
+62,95,53,48,32,109,115,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,
+32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,62,10,
+32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,
+32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,
+101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,83,78,
+68,95,66,85,70,91,49,93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,
+98,101,108,62,95,49,48,48,32,109,115,60,47,108,97,98,101,108,62,10,32,32,
+32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,
+111,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,
+32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,
+119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,
+77,95,83,78,68,95,66,85,70,91,50,93,34,62,10,32,32,32,32,32,32,32,32,32,
+32,60,108,97,98,101,108,62,95,50,48,48,32,109,115,60,47,108,97,98,101,108,
 62,10,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,
 97,100,105,111,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,
 62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
 115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,
-34,73,68,77,95,83,78,68,95,71,65,73,78,91,49,93,34,62,10,32,32,32,32,32,
-32,32,32,32,32,60,108,97,98,101,108,62,43,95,50,32,100,66,60,47,108,97,
+34,73,68,77,95,83,78,68,95,66,85,70,91,51,93,34,62,10,32,32,32,32,32,32,
+32,32,32,32,60,108,97,98,101,108,62,95,52,48,48,32,109,115,60,47,108,97,
 98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,
 49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,60,47,111,98,
-106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,
-99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,
-97,109,101,61,34,73,68,77,95,83,78,68,95,71,65,73,78,91,50,93,34,62,10,
-32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,43,95,52,32,100,66,
-60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,114,97,100,
+106,101,99,116,62,10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,
+32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,
+120,77,101,110,117,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,
+62,95,79,117,116,112,117,116,32,108,101,118,101,108,60,47,108,97,98,101,
+108,62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,
+115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,
+61,34,73,68,77,95,83,78,68,95,71,65,73,78,91,48,93,34,62,10,32,32,32,32,
+32,32,32,32,32,32,60,108,97,98,101,108,62,95,78,111,114,109,97,108,60,47,
+108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,
+111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,60,47,
+111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,
+116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,
+32,110,97,109,101,61,34,73,68,77,95,83,78,68,95,71,65,73,78,91,49,93,34,
+62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,43,95,50,32,
+100,66,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,114,
+97,100,105,111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,
+32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,111,98,
+106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,
+101,109,34,32,110,97,109,101,61,34,73,68,77,95,83,78,68,95,71,65,73,78,
+91,50,93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,
+43,95,52,32,100,66,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,
+32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,62,10,32,32,
+32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,
+32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,
+117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,83,78,68,95,71,
+65,73,78,91,51,93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,
+108,62,43,95,54,32,100,66,60,47,108,97,98,101,108,62,10,32,32,32,32,32,
+32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,62,
+10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,
+32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,
+77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,83,
+78,68,95,71,65,73,78,91,52,93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,
+108,97,98,101,108,62,43,95,56,32,100,66,60,47,108,97,98,101,108,62,10,32,
+32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,
+105,111,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,
+32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,
+34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,
+68,77,95,83,78,68,95,71,65,73,78,91,53,93,34,62,10,32,32,32,32,32,32,32,
+32,32,32,60,108,97,98,101,108,62,43,95,49,48,32,100,66,60,47,108,97,98,
+101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,
+60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,
+101,99,116,62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,
+108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,
+109,101,61,34,73,68,77,95,83,78,68,95,71,65,73,78,91,54,93,34,62,10,32,
+32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,43,49,50,32,100,66,60,
+47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,114,97,100,
 105,111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,60,
 47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,
 99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,
-34,32,110,97,109,101,61,34,73,68,77,95,83,78,68,95,71,65,73,78,91,51,93,
-34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,43,95,54,
+34,32,110,97,109,101,61,34,73,68,77,95,83,78,68,95,71,65,73,78,91,55,93,
+34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,43,49,52,
 32,100,66,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,
 114,97,100,105,111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,
 32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,111,
 98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,
 116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,83,78,68,95,71,65,73,
-78,91,52,93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,
-62,43,95,56,32,100,66,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,
+78,91,56,93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,
+62,43,49,54,32,100,66,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,
 32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,62,10,32,
 32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,
 32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,
 110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,83,78,68,
-95,71,65,73,78,91,53,93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,
-98,101,108,62,43,95,49,48,32,100,66,60,47,108,97,98,101,108,62,10,32,32,
-32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,
-111,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,
-32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,
-119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,
-77,95,83,78,68,95,71,65,73,78,91,54,93,34,62,10,32,32,32,32,32,32,32,32,
-32,32,60,108,97,98,101,108,62,43,49,50,32,100,66,60,47,108,97,98,101,108,
-62,10,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,
-97,100,105,111,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,
-62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
-115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,
-34,73,68,77,95,83,78,68,95,71,65,73,78,91,55,93,34,62,10,32,32,32,32,32,
-32,32,32,32,32,60,108,97,98,101,108,62,43,49,52,32,100,66,60,47,108,97,
-98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,
-49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,60,47,111,98,
-106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,
-99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,
-97,109,101,61,34,73,68,77,95,83,78,68,95,71,65,73,78,91,56,93,34,62,10,
-32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,43,49,54,32,100,66,
-60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,114,97,100,
-105,111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,60,
-47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,
-99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,
-34,32,110,97,109,101,61,34,73,68,77,95,83,78,68,95,71,65,73,78,91,57,93,
-34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,43,49,56,
-32,100,66,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,
-114,97,100,105,111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,
-32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,47,111,
-98,106,101,99,116,62,10,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,
+95,71,65,73,78,91,57,93,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,
+98,101,108,62,43,49,56,32,100,66,60,47,108,97,98,101,108,62,10,32,32,32,
+32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,
+62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,
+32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,60,47,111,98,106,
+101,99,116,62,10,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
+115,61,34,119,120,77,101,110,117,34,62,10,32,32,32,32,32,32,60,108,97,98,
+101,108,62,77,105,115,99,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,
+60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,
+117,34,62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,83,99,114,
+101,101,110,115,104,111,116,60,47,108,97,98,101,108,62,10,32,32,32,32,32,
 32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,
-101,110,117,34,62,10,32,32,32,32,32,32,60,108,97,98,101,108,62,77,105,115,
-99,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,111,98,106,101,99,
-116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,34,62,10,32,32,32,
-32,32,32,32,32,60,108,97,98,101,108,62,95,83,99,114,101,101,110,115,104,
-111,116,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,60,111,98,
-106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,
-101,109,34,32,110,97,109,101,61,34,73,68,77,95,83,67,82,69,69,78,83,72,
-79,84,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,
-84,97,107,101,32,115,99,114,101,101,110,115,104,111,116,92,116,67,116,114,
-108,43,65,108,116,43,80,97,103,101,85,112,60,47,108,97,98,101,108,62,10,
+101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,83,67,
+82,69,69,78,83,72,79,84,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,
+98,101,108,62,95,84,97,107,101,32,115,99,114,101,101,110,115,104,111,116,
+92,116,67,116,114,108,43,65,108,116,43,80,97,103,101,85,112,60,47,108,97,
+98,101,108,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,
+10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,
+61,34,119,120,77,101,110,117,34,62,10,32,32,32,32,32,32,32,32,32,32,60,
+108,97,98,101,108,62,95,70,111,114,109,97,116,60,47,108,97,98,101,108,62,
+10,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,
+115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,
+61,34,73,68,77,95,83,67,82,69,69,78,83,72,79,84,95,70,79,82,77,65,84,91,
+48,93,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,
+62,80,78,71,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,
+32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,62,10,32,32,
 32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,
-32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,
-101,110,117,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,
-62,95,70,111,114,109,97,116,60,47,108,97,98,101,108,62,10,32,32,32,32,32,
 32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,
 120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,
-83,67,82,69,69,78,83,72,79,84,95,70,79,82,77,65,84,91,48,93,34,62,10,32,
-32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,80,78,71,60,47,
-108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,114,97,100,
-105,111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,32,
-32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,60,111,
-98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,
-116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,83,67,82,69,69,78,83,
-72,79,84,95,70,79,82,77,65,84,91,49,93,34,62,10,32,32,32,32,32,32,32,32,
-32,32,32,32,60,108,97,98,101,108,62,84,73,70,70,60,47,108,97,98,101,108,
+83,67,82,69,69,78,83,72,79,84,95,70,79,82,77,65,84,91,49,93,34,62,10,32,
+32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,84,73,70,70,60,
+47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,114,97,
+100,105,111,62,49,60,47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,
+32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,60,
+111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,
+73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,83,67,82,69,69,78,
+83,72,79,84,95,70,79,82,77,65,84,91,50,93,34,62,10,32,32,32,32,32,32,32,
+32,32,32,32,32,60,108,97,98,101,108,62,66,77,80,60,47,108,97,98,101,108,
 62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,
 47,114,97,100,105,111,62,10,32,32,32,32,32,32,32,32,32,32,60,47,111,98,
 106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,
 116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,
 32,110,97,109,101,61,34,73,68,77,95,83,67,82,69,69,78,83,72,79,84,95,70,
-79,82,77,65,84,91,50,93,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,
-108,97,98,101,108,62,66,77,80,60,47,108,97,98,101,108,62,10,32,32,32,32,
+79,82,77,65,84,91,51,93,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,
+108,97,98,101,108,62,74,80,71,60,47,108,97,98,101,108,62,10,32,32,32,32,
 32,32,32,32,32,32,32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,
 111,62,10,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,
-10,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,
-115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,110,97,109,101,
-61,34,73,68,77,95,83,67,82,69,69,78,83,72,79,84,95,70,79,82,77,65,84,91,
-51,93,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,
-62,74,80,71,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,
-32,32,60,114,97,100,105,111,62,49,60,47,114,97,100,105,111,62,10,32,32,
-32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,
-32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,60,111,
+10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,
+32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,
+77,101,110,117,73,116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,83,
+67,82,69,69,78,83,72,79,84,95,70,76,65,83,72,34,62,10,32,32,32,32,32,32,
+32,32,32,32,60,108,97,98,101,108,62,70,108,97,115,104,32,115,99,114,101,
+101,110,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,
+99,104,101,99,107,97,98,108,101,62,49,60,47,99,104,101,99,107,97,98,108,
+101,62,10,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,
+32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,111,
 98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,
-116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,83,67,82,69,69,78,83,
-72,79,84,95,70,76,65,83,72,34,62,10,32,32,32,32,32,32,32,32,32,32,60,108,
-97,98,101,108,62,70,108,97,115,104,32,115,99,114,101,101,110,60,47,108,
-97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,60,99,104,101,99,107,
-97,98,108,101,62,49,60,47,99,104,101,99,107,97,98,108,101,62,10,32,32,32,
-32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,47,
-111,98,106,101,99,116,62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,
-32,99,108,97,115,115,61,34,119,120,77,101,110,117,73,116,101,109,34,32,
-110,97,109,101,61,34,73,68,77,95,83,84,65,84,85,83,34,62,10,32,32,32,32,
-32,32,32,32,60,108,97,98,101,108,62,95,77,97,99,104,105,110,101,60,47,108,
-97,98,101,108,62,10,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,
-32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,60,47,111,98,106,101,
-99,116,62,10,32,32,60,105,100,115,45,114,97,110,103,101,32,110,97,109,101,
-61,34,73,68,67,95,72,68,80,65,78,69,76,34,32,115,116,97,114,116,61,34,49,
-48,34,47,62,10,32,32,60,105,100,115,45,114,97,110,103,101,32,110,97,109,
-101,61,34,73,68,67,95,67,79,77,66,79,68,82,73,86,69,84,89,80,69,34,32,115,
-116,97,114,116,61,34,49,48,48,34,47,62,10,32,32,60,105,100,115,45,114,97,
-110,103,101,32,110,97,109,101,61,34,73,68,67,95,69,68,73,84,95,70,78,34,
-32,115,116,97,114,116,61,34,51,48,48,34,47,62,10,32,32,60,105,100,115,45,
-114,97,110,103,101,32,110,97,109,101,61,34,73,68,67,95,70,73,76,69,34,32,
-115,116,97,114,116,61,34,52,48,48,34,47,62,10,32,32,60,105,100,115,45,114,
-97,110,103,101,32,110,97,109,101,61,34,73,68,67,95,69,74,69,67,84,34,32,
-115,116,97,114,116,61,34,53,48,48,34,47,62,10,32,32,60,105,100,115,45,114,
-97,110,103,101,32,110,97,109,101,61,34,73,68,67,95,78,69,87,34,32,115,116,
-97,114,116,61,34,54,48,48,34,47,62,10,32,32,60,105,100,115,45,114,97,110,
-103,101,32,110,97,109,101,61,34,73,68,67,95,69,68,73,84,95,83,80,84,34,
-32,115,116,97,114,116,61,34,55,48,48,34,47,62,10,32,32,60,105,100,115,45,
-114,97,110,103,101,32,110,97,109,101,61,34,73,68,67,95,69,68,73,84,95,72,
-80,67,34,32,115,116,97,114,116,61,34,56,48,48,34,47,62,10,32,32,60,105,
+116,101,109,34,32,110,97,109,101,61,34,73,68,77,95,83,84,65,84,85,83,34,
+62,10,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,95,77,97,99,104,105,
+110,101,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,60,47,111,98,106,
+101,99,116,62,10,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,60,
+47,111,98,106,101,99,116,62,10,32,32,60,105,100,115,45,114,97,110,103,101,
+32,110,97,109,101,61,34,73,68,67,95,72,68,80,65,78,69,76,34,32,115,116,
+97,114,116,61,34,49,48,34,47,62,10,32,32,60,105,100,115,45,114,97,110,103,
+101,32,110,97,109,101,61,34,73,68,67,95,67,79,77,66,79,68,82,73,86,69,84,
+89,80,69,34,32,115,116,97,114,116,61,34,49,48,48,34,47,62,10,32,32,60,105,
+100,115,45,114,97,110,103,101,32,110,97,109,101,61,34,73,68,67,95,69,68,
+73,84,95,70,78,34,32,115,116,97,114,116,61,34,51,48,48,34,47,62,10,32,32,
+60,105,100,115,45,114,97,110,103,101,32,110,97,109,101,61,34,73,68,67,95,
+70,73,76,69,34,32,115,116,97,114,116,61,34,52,48,48,34,47,62,10,32,32,60,
+105,100,115,45,114,97,110,103,101,32,110,97,109,101,61,34,73,68,67,95,69,
+74,69,67,84,34,32,115,116,97,114,116,61,34,53,48,48,34,47,62,10,32,32,60,
+105,100,115,45,114,97,110,103,101,32,110,97,109,101,61,34,73,68,67,95,78,
+69,87,34,32,115,116,97,114,116,61,34,54,48,48,34,47,62,10,32,32,60,105,
 100,115,45,114,97,110,103,101,32,110,97,109,101,61,34,73,68,67,95,69,68,
-73,84,95,67,89,76,34,32,115,116,97,114,116,61,34,57,48,48,34,47,62,10,32,
+73,84,95,83,80,84,34,32,115,116,97,114,116,61,34,55,48,48,34,47,62,10,32,
 32,60,105,100,115,45,114,97,110,103,101,32,110,97,109,101,61,34,73,68,67,
-95,84,69,88,84,95,83,73,90,69,34,32,115,116,97,114,116,61,34,49,48,48,48,
-34,47,62,10,32,32,60,105,100,115,45,114,97,110,103,101,32,110,97,109,101,
-61,34,73,68,67,95,72,68,68,95,76,65,66,69,76,34,32,115,116,97,114,116,61,
-34,49,49,48,48,34,47,62,10,32,32,60,111,98,106,101,99,116,32,99,108,97,
-115,115,61,34,119,120,68,105,97,108,111,103,34,32,110,97,109,101,61,34,
-67,111,110,102,105,103,117,114,101,68,108,103,34,62,10,32,32,32,32,60,115,
-116,121,108,101,62,119,120,68,69,70,65,85,76,84,95,68,73,65,76,79,71,95,
-83,84,89,76,69,60,47,115,116,121,108,101,62,10,32,32,32,32,60,116,105,116,
-108,101,62,67,111,110,102,105,103,117,114,101,32,80,67,101,109,60,47,116,
-105,116,108,101,62,10,32,32,32,32,60,99,101,110,116,101,114,101,100,62,
-49,60,47,99,101,110,116,101,114,101,100,62,10,32,32,32,32,60,111,98,106,
-101,99,116,32,99,108,97,115,115,61,34,119,120,80,97,110,101,108,34,32,110,
-97,109,101,61,34,82,79,79,84,95,80,65,78,69,76,34,62,10,32,32,32,32,32,
-32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,70,108,101,
-120,71,114,105,100,83,105,122,101,114,34,62,10,32,32,32,32,32,32,32,32,
-60,114,111,119,115,62,48,60,47,114,111,119,115,62,10,32,32,32,32,32,32,
-32,32,60,99,111,108,115,62,49,60,47,99,111,108,115,62,10,32,32,32,32,32,
-32,32,32,60,118,103,97,112,62,48,60,47,118,103,97,112,62,10,32,32,32,32,
-32,32,32,32,60,104,103,97,112,62,48,60,47,104,103,97,112,62,10,32,32,32,
-32,32,32,32,32,60,103,114,111,119,97,98,108,101,99,111,108,115,47,62,10,
-32,32,32,32,32,32,32,32,60,103,114,111,119,97,98,108,101,114,111,119,115,
-47,62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,
-115,115,61,34,115,105,122,101,114,105,116,101,109,34,62,10,32,32,32,32,
-32,32,32,32,32,32,60,111,112,116,105,111,110,62,49,60,47,111,112,116,105,
-111,110,62,10,32,32,32,32,32,32,32,32,32,32,60,102,108,97,103,62,119,120,
-65,76,76,124,119,120,69,88,80,65,78,68,60,47,102,108,97,103,62,10,32,32,
-32,32,32,32,32,32,32,32,60,98,111,114,100,101,114,62,53,60,47,98,111,114,
-100,101,114,62,10,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,
-32,99,108,97,115,115,61,34,119,120,78,111,116,101,98,111,111,107,34,32,
-110,97,109,101,61,34,73,68,67,95,78,79,84,69,66,79,79,75,34,62,10,32,32,
-32,32,32,32,32,32,32,32,32,32,60,115,116,121,108,101,62,119,120,78,66,95,
-68,69,70,65,85,76,84,60,47,115,116,121,108,101,62,10,32,32,32,32,32,32,
-32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,110,
-111,116,101,98,111,111,107,112,97,103,101,34,62,10,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,60,115,101,108,101,99,116,101,100,62,49,60,47,115,
-101,108,101,99,116,101,100,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,60,98,105,116,109,97,112,62,119,120,45,114,101,115,111,117,114,99,101,
-115,46,99,112,112,36,105,99,111,110,115,95,51,50,120,51,50,95,109,111,116,
-104,101,114,98,111,97,114,100,46,112,110,103,60,47,98,105,116,109,97,112,
-62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,
-32,99,108,97,115,115,61,34,119,120,80,97,110,101,108,34,62,10,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,60,115,116,121,108,101,62,119,120,
-84,65,66,95,84,82,65,86,69,82,83,65,76,60,47,115,116,121,108,101,62,10,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,
-32,99,108,97,115,115,61,34,119,120,70,108,101,120,71,114,105,100,83,105,
-122,101,114,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,60,114,111,119,115,62,48,60,47,114,111,119,115,62,10,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,60,99,111,108,115,62,51,60,47,99,
-111,108,115,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-60,118,103,97,112,62,48,60,47,118,103,97,112,62,10,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,60,104,103,97,112,62,48,60,47,104,103,
-97,112,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,103,
-114,111,119,97,98,108,101,99,111,108,115,62,49,60,47,103,114,111,119,97,
-98,108,101,99,111,108,115,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,60,103,114,111,119,97,98,108,101,114,111,119,115,47,62,10,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,
+95,69,68,73,84,95,72,80,67,34,32,115,116,97,114,116,61,34,56,48,48,34,47,
+62,10,32,32,60,105,100,115,45,114,97,110,103,101,32,110,97,109,101,61,34,
+73,68,67,95,69,68,73,84,95,67,89,76,34,32,115,116,97,114,116,61,34,57,48,
+48,34,47,62,10,32,32,60,105,100,115,45,114,97,110,103,101,32,110,97,109,
+101,61,34,73,68,67,95,84,69,88,84,95,83,73,90,69,34,32,115,116,97,114,116,
+61,34,49,48,48,48,34,47,62,10,32,32,60,105,100,115,45,114,97,110,103,101,
+32,110,97,109,101,61,34,73,68,67,95,72,68,68,95,76,65,66,69,76,34,32,115,
+116,97,114,116,61,34,49,49,48,48,34,47,62,10,32,32,60,111,98,106,101,99,
+116,32,99,108,97,115,115,61,34,119,120,68,105,97,108,111,103,34,32,110,
+97,109,101,61,34,67,111,110,102,105,103,117,114,101,68,108,103,34,62,10,
+32,32,32,32,60,115,116,121,108,101,62,119,120,68,69,70,65,85,76,84,95,68,
+73,65,76,79,71,95,83,84,89,76,69,60,47,115,116,121,108,101,62,10,32,32,
+32,32,60,116,105,116,108,101,62,67,111,110,102,105,103,117,114,101,32,80,
+67,101,109,60,47,116,105,116,108,101,62,10,32,32,32,32,60,99,101,110,116,
+101,114,101,100,62,49,60,47,99,101,110,116,101,114,101,100,62,10,32,32,
+32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,80,97,
+110,101,108,34,32,110,97,109,101,61,34,82,79,79,84,95,80,65,78,69,76,34,
+62,10,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,
+34,119,120,70,108,101,120,71,114,105,100,83,105,122,101,114,34,62,10,32,
+32,32,32,32,32,32,32,60,114,111,119,115,62,48,60,47,114,111,119,115,62,
+10,32,32,32,32,32,32,32,32,60,99,111,108,115,62,49,60,47,99,111,108,115,
+62,10,32,32,32,32,32,32,32,32,60,118,103,97,112,62,48,60,47,118,103,97,
+112,62,10,32,32,32,32,32,32,32,32,60,104,103,97,112,62,48,60,47,104,103,
+97,112,62,10,32,32,32,32,32,32,32,32,60,103,114,111,119,97,98,108,101,99,
+111,108,115,47,62,10,32,32,32,32,32,32,32,32,60,103,114,111,119,97,98,108,
+101,114,111,119,115,47,62,10,32,32,32,32,32,32,32,32,60,111,98,106,101,
 99,116,32,99,108,97,115,115,61,34,115,105,122,101,114,105,116,101,109,34,
-62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,
-112,116,105,111,110,62,48,60,47,111,112,116,105,111,110,62,10,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,102,108,97,103,62,
-119,120,65,76,76,32,124,32,119,120,65,76,73,71,78,95,67,69,78,84,69,82,
-95,86,69,82,84,73,67,65,76,60,47,102,108,97,103,62,10,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,98,111,114,100,101,114,62,
-53,60,47,98,111,114,100,101,114,62,10,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,
-61,34,119,120,83,116,97,116,105,99,84,101,120,116,34,62,10,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,115,105,122,101,
-62,56,48,44,45,49,60,47,115,105,122,101,62,10,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,77,97,99,
-104,105,110,101,58,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,119,114,97,112,62,45,49,60,
-47,119,114,97,112,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,
+62,10,32,32,32,32,32,32,32,32,32,32,60,111,112,116,105,111,110,62,49,60,
+47,111,112,116,105,111,110,62,10,32,32,32,32,32,32,32,32,32,32,60,102,108,
+97,103,62,119,120,65,76,76,124,119,120,69,88,80,65,78,68,60,47,102,108,
+97,103,62,10,32,32,32,32,32,32,32,32,32,32,60,98,111,114,100,101,114,62,
+53,60,47,98,111,114,100,101,114,62,10,32,32,32,32,32,32,32,32,32,32,60,
+111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,78,111,116,101,
+98,111,111,107,34,32,110,97,109,101,61,34,73,68,67,95,78,79,84,69,66,79,
+79,75,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,115,116,121,108,101,
+62,119,120,78,66,95,68,69,70,65,85,76,84,60,47,115,116,121,108,101,62,10,
+32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,
+97,115,115,61,34,110,111,116,101,98,111,111,107,112,97,103,101,34,62,10,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,115,101,108,101,99,116,101,
+100,62,49,60,47,115,101,108,101,99,116,101,100,62,10,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,60,98,105,116,109,97,112,62,119,120,45,114,101,
+115,111,117,114,99,101,115,46,99,112,112,36,105,99,111,110,115,95,51,50,
+120,51,50,95,109,111,116,104,101,114,98,111,97,114,100,46,112,110,103,60,
+47,98,105,116,109,97,112,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,80,97,110,101,
+108,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,115,116,
+121,108,101,62,119,120,84,65,66,95,84,82,65,86,69,82,83,65,76,60,47,115,
+116,121,108,101,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,
+111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,70,108,101,120,
+71,114,105,100,83,105,122,101,114,34,62,10,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,60,114,111,119,115,62,48,60,47,114,111,119,115,
+62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,99,111,108,
+115,62,51,60,47,99,111,108,115,62,10,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,60,118,103,97,112,62,48,60,47,118,103,97,112,62,10,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,104,103,97,112,62,
+48,60,47,104,103,97,112,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,60,103,114,111,119,97,98,108,101,99,111,108,115,62,49,60,47,
+103,114,111,119,97,98,108,101,99,111,108,115,62,10,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,60,103,114,111,119,97,98,108,101,114,111,
+119,115,47,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,115,105,122,101,114,
+105,116,101,109,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,60,111,112,116,105,111,110,62,48,60,47,111,112,116,105,111,
+110,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,
+102,108,97,103,62,119,120,65,76,76,32,124,32,119,120,65,76,73,71,78,95,
+67,69,78,84,69,82,95,86,69,82,84,73,67,65,76,60,47,102,108,97,103,62,10,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,98,111,114,
+100,101,114,62,53,60,47,98,111,114,100,101,114,62,10,32,32,32,32,32,32,
 32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,
-108,97,115,115,61,34,115,105,122,101,114,105,116,101,109,34,62,10,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,112,116,105,
-111,110,62,49,60,47,111,112,116,105,111,110,62,10,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,60,102,108,97,103,62,119,120,69,
-88,80,65,78,68,60,47,102,108,97,103,62,10,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,60,98,111,114,100,101,114,62,53,60,47,98,
-111,114,100,101,114,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,
+108,97,115,115,61,34,119,120,83,116,97,116,105,99,84,101,120,116,34,62,
+10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,
+115,105,122,101,62,56,48,44,45,49,60,47,115,105,122,101,62,10,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,
+108,62,77,97,99,104,105,110,101,58,60,47,108,97,98,101,108,62,10,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,119,114,
+97,112,62,45,49,60,47,119,114,97,112,62,10,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,
+62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,
+101,99,116,32,99,108,97,115,115,61,34,115,105,122,101,114,105,116,101,109,
+34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,
+111,112,116,105,111,110,62,49,60,47,111,112,116,105,111,110,62,10,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,102,108,97,103,
+62,119,120,69,88,80,65,78,68,60,47,102,108,97,103,62,10,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,98,111,114,100,101,114,
+62,53,60,47,98,111,114,100,101,114,62,10,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
+115,61,34,119,120,66,111,120,83,105,122,101,114,34,62,10,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,114,105,101,110,
+116,62,119,120,72,79,82,73,90,79,78,84,65,76,60,47,111,114,105,101,110,
+116,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,115,105,122,101,
+114,105,116,101,109,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,60,111,112,116,105,111,110,62,48,60,47,111,
+112,116,105,111,110,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,60,102,108,97,103,62,119,120,65,76,76,60,47,
+102,108,97,103,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,60,98,111,114,100,101,114,62,53,60,47,98,111,114,100,
+101,114,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,
+120,67,111,109,98,111,66,111,120,34,32,110,97,109,101,61,34,73,68,67,95,
+67,79,77,66,79,49,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,60,115,116,121,108,101,62,119,120,67,66,
+95,68,82,79,80,68,79,87,78,124,119,120,67,66,95,82,69,65,68,79,78,76,89,
+60,47,115,116,121,108,101,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,60,115,105,122,101,62,51,53,48,44,
+45,49,60,47,115,105,122,101,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,60,118,97,108,117,101,47,62,10,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,60,99,111,110,116,101,110,116,47,62,10,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,
+10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,
+47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,
+32,99,108,97,115,115,61,34,115,105,122,101,114,105,116,101,109,34,62,10,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,112,
+116,105,111,110,62,48,60,47,111,112,116,105,111,110,62,10,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,102,108,97,103,62,119,120,
+65,76,76,60,47,102,108,97,103,62,10,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,60,98,111,114,100,101,114,62,53,60,47,98,111,114,
+100,101,114,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,66,105,
+116,109,97,112,66,117,116,116,111,110,34,32,110,97,109,101,61,34,73,68,
+67,95,67,79,78,70,73,71,85,82,69,77,79,68,34,62,10,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,98,105,116,109,97,112,62,
+119,120,45,114,101,115,111,117,114,99,101,115,46,99,112,112,36,105,99,111,
+110,115,95,49,54,120,49,54,95,115,101,116,116,105,110,103,95,116,111,111,
+108,115,46,112,110,103,60,47,98,105,116,109,97,112,62,10,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,100,101,102,97,117,
+108,116,62,48,60,47,100,101,102,97,117,108,116,62,10,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,
+10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,
+101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,115,105,122,101,114,
+105,116,101,109,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,60,111,112,116,105,111,110,62,48,60,47,111,112,116,105,111,
+110,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,
+102,108,97,103,62,119,120,65,76,76,32,124,32,119,120,65,76,73,71,78,95,
+67,69,78,84,69,82,95,86,69,82,84,73,67,65,76,60,47,102,108,97,103,62,10,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,98,111,114,
+100,101,114,62,53,60,47,98,111,114,100,101,114,62,10,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,
+108,97,115,115,61,34,119,120,83,116,97,116,105,99,84,101,120,116,34,62,
+10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,
+115,105,122,101,62,56,48,44,45,49,60,47,115,105,122,101,62,10,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,
+108,62,67,80,85,58,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,119,114,97,112,62,45,49,60,
+47,119,114,97,112,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,
+108,97,115,115,61,34,115,105,122,101,114,105,116,101,109,34,62,10,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,112,116,105,
+111,110,62,49,60,47,111,112,116,105,111,110,62,10,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,60,102,108,97,103,62,119,120,69,
+88,80,65,78,68,60,47,102,108,97,103,62,10,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,60,98,111,114,100,101,114,62,53,60,47,98,
+111,114,100,101,114,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,
 120,66,111,120,83,105,122,101,114,34,62,10,32,32,32,32,32,32,32,32,32,32,
 32,32,32,32,32,32,32,32,32,32,32,32,60,111,114,105,101,110,116,62,119,120,
 72,79,82,73,90,79,78,84,65,76,60,47,111,114,105,101,110,116,62,10,32,32,
@@ -2723,82 +2824,95 @@ static unsigned char xml_res_file_26[] = {
 60,98,111,114,100,101,114,62,53,60,47,98,111,114,100,101,114,62,10,32,32,
 32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,
 98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,67,111,109,98,111,
-66,111,120,34,32,110,97,109,101,61,34,73,68,67,95,67,79,77,66,79,49,34,
-62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,60,115,116,121,108,101,62,119,120,67,66,95,68,82,79,80,68,79,
-87,78,124,119,120,67,66,95,82,69,65,68,79,78,76,89,60,47,115,116,121,108,
-101,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,60,115,105,122,101,62,51,53,48,44,45,49,60,47,115,105,122,
-101,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,60,118,97,108,117,101,47,62,10,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,99,111,110,116,101,
-110,116,47,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,
-62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,47,
-111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,
-34,115,105,122,101,114,105,116,101,109,34,62,10,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,60,111,112,116,105,111,110,62,48,60,
-47,111,112,116,105,111,110,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,60,102,108,97,103,62,119,120,65,76,76,60,47,102,108,
-97,103,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-60,98,111,114,100,101,114,62,53,60,47,98,111,114,100,101,114,62,10,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,
-99,116,32,99,108,97,115,115,61,34,119,120,66,105,116,109,97,112,66,117,
-116,116,111,110,34,32,110,97,109,101,61,34,73,68,67,95,67,79,78,70,73,71,
-85,82,69,77,79,68,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,60,98,105,116,109,97,112,62,119,120,45,114,101,115,
-111,117,114,99,101,115,46,99,112,112,36,105,99,111,110,115,95,49,54,120,
-49,54,95,115,101,116,116,105,110,103,95,116,111,111,108,115,46,112,110,
-103,60,47,98,105,116,109,97,112,62,10,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,60,100,101,102,97,117,108,116,62,48,60,
-47,100,101,102,97,117,108,116,62,10,32,32,32,32,32,32,32,32,32,32,32,32,
+66,111,120,34,32,110,97,109,101,61,34,73,68,67,95,67,79,77,66,79,67,80,
+85,77,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,60,115,116,121,108,101,62,119,120,67,66,95,68,82,79,
+80,68,79,87,78,124,119,120,67,66,95,82,69,65,68,79,78,76,89,60,47,115,116,
+121,108,101,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,60,115,105,122,101,62,49,50,48,44,45,49,60,47,115,
+105,122,101,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,60,118,97,108,117,101,47,62,10,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,99,111,110,
+116,101,110,116,47,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
 32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,
-99,116,32,99,108,97,115,115,61,34,115,105,122,101,114,105,116,101,109,34,
-62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,
-112,116,105,111,110,62,48,60,47,111,112,116,105,111,110,62,10,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,102,108,97,103,62,
-119,120,65,76,76,32,124,32,119,120,65,76,73,71,78,95,67,69,78,84,69,82,
-95,86,69,82,84,73,67,65,76,60,47,102,108,97,103,62,10,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,98,111,114,100,101,114,62,
-53,60,47,98,111,114,100,101,114,62,10,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,
-61,34,119,120,83,116,97,116,105,99,84,101,120,116,34,62,10,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,115,105,122,101,
-62,56,48,44,45,49,60,47,115,105,122,101,62,10,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,67,80,85,
-58,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,60,119,114,97,112,62,45,49,60,47,119,114,97,
-112,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,
+99,116,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,115,105,122,101,
+114,105,116,101,109,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,60,111,112,116,105,111,110,62,48,60,47,111,
+112,116,105,111,110,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,60,102,108,97,103,62,119,120,65,76,76,60,47,
+102,108,97,103,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,60,98,111,114,100,101,114,62,53,60,47,98,111,114,100,
+101,114,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,
+120,67,111,109,98,111,66,111,120,34,32,110,97,109,101,61,34,73,68,67,95,
+67,79,77,66,79,51,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,60,115,116,121,108,101,62,119,120,67,66,
+95,68,82,79,80,68,79,87,78,124,119,120,67,66,95,82,69,65,68,79,78,76,89,
+60,47,115,116,121,108,101,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,60,115,105,122,101,62,50,50,48,44,
+45,49,60,47,115,105,122,101,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,60,118,97,108,117,101,47,62,10,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,60,99,111,110,116,101,110,116,47,62,10,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,
+10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,
 47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,
-61,34,115,105,122,101,114,105,116,101,109,34,62,10,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,112,116,105,111,110,62,49,
-60,47,111,112,116,105,111,110,62,10,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,60,102,108,97,103,62,119,120,69,88,80,65,78,68,
-60,47,102,108,97,103,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,60,98,111,114,100,101,114,62,53,60,47,98,111,114,100,101,
-114,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,
-111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,66,111,120,83,
-105,122,101,114,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,60,111,114,105,101,110,116,62,119,120,72,79,82,73,90,
-79,78,84,65,76,60,47,111,114,105,101,110,116,62,10,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,
-99,108,97,115,115,61,34,115,105,122,101,114,105,116,101,109,34,62,10,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,
+32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,
+32,99,108,97,115,115,61,34,115,112,97,99,101,114,34,62,10,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,112,116,105,111,110,
+62,49,60,47,111,112,116,105,111,110,62,10,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,60,102,108,97,103,62,119,120,69,88,80,65,
+78,68,60,47,102,108,97,103,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,60,98,111,114,100,101,114,62,53,60,47,98,111,114,100,
+101,114,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,60,115,105,122,101,62,48,44,48,60,47,115,105,122,101,62,10,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,
+62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,
+101,99,116,32,99,108,97,115,115,61,34,115,105,122,101,114,105,116,101,109,
+34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,
 111,112,116,105,111,110,62,48,60,47,111,112,116,105,111,110,62,10,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,102,
-108,97,103,62,119,120,65,76,76,60,47,102,108,97,103,62,10,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,98,111,114,
-100,101,114,62,53,60,47,98,111,114,100,101,114,62,10,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,
-99,116,32,99,108,97,115,115,61,34,119,120,67,111,109,98,111,66,111,120,
-34,32,110,97,109,101,61,34,73,68,67,95,67,79,77,66,79,67,80,85,77,34,62,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,102,108,97,103,
+62,119,120,65,76,76,32,124,32,119,120,65,76,73,71,78,95,67,69,78,84,69,
+82,95,86,69,82,84,73,67,65,76,60,47,102,108,97,103,62,10,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,98,111,114,100,101,114,
+62,53,60,47,98,111,114,100,101,114,62,10,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
+115,61,34,119,120,83,116,97,116,105,99,84,101,120,116,34,62,10,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,115,105,122,
+101,62,56,48,44,45,49,60,47,115,105,122,101,62,10,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,70,
+80,85,58,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,60,119,114,97,112,62,45,49,60,47,119,114,
+97,112,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
+115,61,34,115,105,122,101,114,105,116,101,109,34,62,10,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,112,116,105,111,110,62,
+49,60,47,111,112,116,105,111,110,62,10,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,60,102,108,97,103,62,119,120,69,88,80,65,78,
+68,60,47,102,108,97,103,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,60,98,111,114,100,101,114,62,53,60,47,98,111,114,100,
+101,114,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,66,111,120,
+83,105,122,101,114,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,32,60,111,114,105,101,110,116,62,119,120,72,79,82,73,
+90,79,78,84,65,76,60,47,111,114,105,101,110,116,62,10,32,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,
+32,99,108,97,115,115,61,34,115,105,122,101,114,105,116,101,109,34,62,10,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+60,111,112,116,105,111,110,62,48,60,47,111,112,116,105,111,110,62,10,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,
+102,108,97,103,62,119,120,65,76,76,60,47,102,108,97,103,62,10,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,98,111,
+114,100,101,114,62,53,60,47,98,111,114,100,101,114,62,10,32,32,32,32,32,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,
+101,99,116,32,99,108,97,115,115,61,34,119,120,67,111,109,98,111,66,111,
+120,34,32,110,97,109,101,61,34,73,68,67,95,67,79,77,66,79,70,80,85,34,62,
 10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
 32,32,32,60,115,116,121,108,101,62,119,120,67,66,95,68,82,79,80,68,79,87,
 78,124,119,120,67,66,95,82,69,65,68,79,78,76,89,60,47,115,116,121,108,101,
@@ -2810,98 +2924,10 @@ static unsigned char xml_res_file_26[] = {
 116,47,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
 32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,
 32,32,32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,
-98,106,101,99,116,32,99,108,97,115,115,61,34,115,105,122,101,114,105,116,
-101,109,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,60,111,112,116,105,111,110,62,48,60,47,111,112,116,105,
-111,110,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,60,102,108,97,103,62,119,120,65,76,76,60,47,102,108,97,103,
-62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,60,98,111,114,100,101,114,62,53,60,47,98,111,114,100,101,114,62,10,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,120,67,111,109,
-98,111,66,111,120,34,32,110,97,109,101,61,34,73,68,67,95,67,79,77,66,79,
-51,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,60,115,116,121,108,101,62,119,120,67,66,95,68,82,79,80,
-68,79,87,78,124,119,120,67,66,95,82,69,65,68,79,78,76,89,60,47,115,116,
-121,108,101,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,60,115,105,122,101,62,50,50,48,44,45,49,60,47,115,
-105,122,101,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,60,118,97,108,117,101,47,62,10,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,99,111,110,
-116,101,110,116,47,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,
-99,116,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,
-115,61,34,115,112,97,99,101,114,34,62,10,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,60,111,112,116,105,111,110,62,49,60,47,111,
-112,116,105,111,110,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,60,102,108,97,103,62,119,120,69,88,80,65,78,68,60,47,102,
-108,97,103,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,60,98,111,114,100,101,114,62,53,60,47,98,111,114,100,101,114,62,10,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,115,105,
-122,101,62,48,44,48,60,47,115,105,122,101,62,10,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,
-99,108,97,115,115,61,34,115,105,122,101,114,105,116,101,109,34,62,10,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,112,116,
-105,111,110,62,48,60,47,111,112,116,105,111,110,62,10,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,102,108,97,103,62,119,120,
-65,76,76,32,124,32,119,120,65,76,73,71,78,95,67,69,78,84,69,82,95,86,69,
-82,84,73,67,65,76,60,47,102,108,97,103,62,10,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,60,98,111,114,100,101,114,62,53,60,47,
-98,111,114,100,101,114,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,119,
-120,83,116,97,116,105,99,84,101,120,116,34,62,10,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,115,105,122,101,62,56,48,44,
-45,49,60,47,115,105,122,101,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,70,80,85,58,60,47,108,
-97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,60,119,114,97,112,62,45,49,60,47,119,114,97,112,62,10,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,
-101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,115,
-105,122,101,114,105,116,101,109,34,62,10,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,60,111,112,116,105,111,110,62,49,60,47,111,
-112,116,105,111,110,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,60,102,108,97,103,62,119,120,69,88,80,65,78,68,60,47,102,
-108,97,103,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,60,98,111,114,100,101,114,62,53,60,47,98,111,114,100,101,114,62,10,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,
-101,99,116,32,99,108,97,115,115,61,34,119,120,66,111,120,83,105,122,101,
-114,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,60,111,114,105,101,110,116,62,119,120,72,79,82,73,90,79,78,84,65,
-76,60,47,111,114,105,101,110,116,62,10,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,
-115,115,61,34,115,105,122,101,114,105,116,101,109,34,62,10,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,112,
-116,105,111,110,62,48,60,47,111,112,116,105,111,110,62,10,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,102,108,97,
-103,62,119,120,65,76,76,60,47,102,108,97,103,62,10,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,98,111,114,100,101,
-114,62,53,60,47,98,111,114,100,101,114,62,10,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,111,98,106,101,99,116,32,
-99,108,97,115,115,61,34,119,120,67,111,109,98,111,66,111,120,34,32,110,
-97,109,101,61,34,73,68,67,95,67,79,77,66,79,70,80,85,34,62,10,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,
-115,116,121,108,101,62,119,120,67,66,95,68,82,79,80,68,79,87,78,124,119,
-120,67,66,95,82,69,65,68,79,78,76,89,60,47,115,116,121,108,101,62,10,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,60,115,105,122,101,62,49,50,48,44,45,49,60,47,115,105,122,101,62,10,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,60,118,97,108,117,101,47,62,10,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,99,111,110,116,101,110,116,
-47,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,101,99,116,62,10,32,
-32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,106,
-101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
-60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,
-32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,115,
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,47,111,98,
+106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,60,47,111,98,106,101,99,116,62,10,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,60,111,98,106,101,99,116,32,99,108,97,115,115,61,34,115,
 112,97,99,101,114,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
 32,32,32,32,32,60,111,112,116,105,111,110,62,49,60,47,111,112,116,105,111,
 110,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,
@@ -136,7 +136,7 @@ int get_status(char* machine, char* device)
                 "\n"
 
                 "New blocks : %i\nOld blocks : %i\nRecompiled speed : %f MIPS\nAverage size : %f\n"
-                "Flushes : %i\nEvicted : %i\nReused : %i\nRemoved : %i\nReal speed : %f MIPS\nMem blocks used : %i (%g MB)"
+                "Flushes : %i\nEvicted : %i\nReused : %i\nRemoved : %i\nImmediate writes tolerated : %i\nReal speed : %f MIPS\nMem blocks used : %i (%g MB)"
         //                        "\nFully recompiled ins %% : %f%%"
                 ,mips,
                 flops,
@@ -157,7 +157,7 @@ int get_status(char* machine, char* device)
 
                 , cpu_new_blocks_latched, cpu_recomp_blocks_latched, (double)cpu_recomp_ins_latched / 1000000.0, (double)cpu_recomp_ins_latched/cpu_recomp_blocks_latched,
                 cpu_recomp_flushes_latched, cpu_recomp_evicted_latched,
-                cpu_recomp_reuse_latched, cpu_recomp_removed_latched,
+                cpu_recomp_reuse_latched, cpu_recomp_removed_latched, cpu_recomp_imm_avoided_latched,
 
                 ((double)cpu_recomp_ins_latched / 1000000.0) / ((double)main_time / timer_freq),
                 codegen_allocator_usage,
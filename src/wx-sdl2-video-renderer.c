@@ -3,6 +3,7 @@
 #include <string.h>
 #include <stdio.h>
 #include "video.h"
+#include "video_postproc.h"
 #include "wx-utils.h"
 #include "wx-sdl2-video.h"
 #include "wx-sdl2-video-renderer.h"
@@ -10,9 +11,19 @@
 static SDL_Texture* texture = NULL;
 static SDL_Renderer* renderer = NULL;
 
+/* When scaling on the CPU, updates are kept in source and scaled into
+   output_texture at the window size */
+static int cpu_scale = 0;
+static uint32_t* source = NULL;
+static int source_pitch;
+static int source_updated;
+static SDL_Texture* output_texture = NULL;
+static int output_w, output_h;
+
 extern int video_scale_mode;
 extern int video_vsync;
 extern int video_focus_dim;
+extern int video_postproc_filter;
 extern int take_screenshot;
 extern void screenshot_taken(unsigned char* rgb, int width, int height);
 
@@ -47,9 +58,29 @@ int sdl_video_renderer_init(SDL_Window* window, sdl_render_driver requested_rend
         else
                 strcpy(current_render_driver_name, d->name);
 
-        texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888,
-                        SDL_TEXTUREACCESS_STREAMING,
-                        screen.w, screen.h);
+        /* The software renderer scales on one thread, so do it ourselves. Any
+           renderer needs to go this way for the CPU filters */
+        cpu_scale = (d && d->id == RENDERER_SOFTWARE) || video_postproc_filter;
+        if (cpu_scale)
+        {
+                source = malloc(screen.w * screen.h * 4);
+                if (!source)
+                {
+                        wx_messagebox(0, "Could not allocate the scaling buffer!", "SDL Error", WX_MB_OK);
+                        cpu_scale = 0;
+                        SDL_DestroyRenderer(renderer);
+                        renderer = NULL;
+                        return SDL_FALSE;
+                }
+                source_pitch = screen.w;
+                source_updated = 1;
+                output_w = output_h = 0;
+                postproc_init(SDL_GetCPUCount());
+        }
+        else
+                texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888,
+                                SDL_TEXTUREACCESS_STREAMING,
+                                screen.w, screen.h);
 
         return SDL_TRUE;
 
@@ -62,6 +93,21 @@ void sdl_video_renderer_close()
                 SDL_DestroyTexture(texture);
                 texture = NULL;
         }
+        if (output_texture)
+        {
+                SDL_DestroyTexture(output_texture);
+                output_texture = NULL;
+        }
+        if (source)
+        {
+                free(source);
+                source = NULL;
+        }
+        if (cpu_scale)
+        {
+                postproc_close();
+                cpu_scale = 0;
+        }
         if (renderer)
         {
                 SDL_DestroyRenderer(renderer);
@@ -71,13 +117,60 @@ void sdl_video_renderer_close()
 
 void sdl_video_renderer_update(SDL_Window* window, SDL_Rect updated_rect, BITMAP* screen)
 {
+        if (cpu_scale)
+        {
+                int y;
+
+                for (y = updated_rect.y; y < updated_rect.y + updated_rect.h; y++)
+                        memcpy(&source[y * source_pitch + updated_rect.x],
+                                        &((uint32_t*) screen->dat)[y * screen->w + updated_rect.x], updated_rect.w * 4);
+                source_updated = 1;
+                return;
+        }
         SDL_UpdateTexture(texture, &updated_rect, &((uint32_t*) screen->dat)[updated_rect.y * screen->w + updated_rect.x], screen->w * 4);
 }
 
+/* Scale the source image to the output size on the CPU. Only redone when
+   the image or the window size has changed */
+static void sdl_video_renderer_scale(SDL_Rect texture_rect, SDL_Rect window_rect)
+{
+        void* pixels;
+        int pitch;
+
+        if (window_rect.w != output_w || window_rect.h != output_h)
+        {
+                if (output_texture)
+                        SDL_DestroyTexture(output_texture);
+                output_texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888,
+                                SDL_TEXTUREACCESS_STREAMING,
+                                window_rect.w, window_rect.h);
+                output_w = window_rect.w;
+                output_h = window_rect.h;
+                source_updated = 1;
+        }
+        if (!output_texture || !source_updated)
+                return;
+
+        if (!SDL_LockTexture(output_texture, NULL, &pixels, &pitch))
+        {
+                postproc_scale((uint32_t*) pixels, pitch / 4, output_w, output_h,
+                                &source[texture_rect.y * source_pitch + texture_rect.x], source_pitch,
+                                texture_rect.w, texture_rect.h, video_scale_mode, video_postproc_filter);
+                SDL_UnlockTexture(output_texture);
+                source_updated = 0;
+        }
+}
+
 void sdl_video_renderer_present(SDL_Window* window, SDL_Rect texture_rect, SDL_Rect window_rect, SDL_Rect screen)
 {
         SDL_RenderClear(renderer);
-        SDL_RenderCopy(renderer, texture, &texture_rect, &window_rect);
+        if (cpu_scale)
+        {
+                sdl_video_renderer_scale(texture_rect, window_rect);
+                SDL_RenderCopy(renderer, output_texture, NULL, &window_rect);
+        }
+        else
+                SDL_RenderCopy(renderer, texture, &texture_rect, &window_rect);
         int sshot = take_screenshot;
         if (!sshot)
         {
@@ -28,6 +28,7 @@ static void sdl_blit_memtoscreen(int x, int y, int y1, int y2, int w, int h);
 int video_scale_mode = 1;
 int video_vsync = 0;
 int video_focus_dim = 0;
+int video_postproc_filter = 0;
 int video_fullscreen_mode = 0;
 int video_alternative_update_lock = 0;
 
@@ -312,6 +312,7 @@ void sdl_loadconfig()
         video_scale_mode = config_get_int(CFG_MACHINE, "SDL2", "scale_mode", video_scale_mode);
         video_vsync = config_get_int(CFG_MACHINE, "SDL2", "vsync", video_vsync);
         video_focus_dim = config_get_int(CFG_MACHINE, "SDL2", "focus_dim", video_focus_dim);
+        video_postproc_filter = config_get_int(CFG_MACHINE, "SDL2", "postproc_filter", video_postproc_filter);
         video_alternative_update_lock = config_get_int(CFG_MACHINE, "SDL2", "alternative_update_lock", video_alternative_update_lock);
         requested_render_driver = sdl_get_render_driver_by_name(config_get_string(CFG_MACHINE, "SDL2", "render_driver", ""), RENDERER_SOFTWARE);
 
@@ -349,6 +350,7 @@ void sdl_saveconfig()
         config_set_int(CFG_MACHINE, "SDL2", "scale_mode", video_scale_mode);
         config_set_int(CFG_MACHINE, "SDL2", "vsync", video_vsync);
         config_set_int(CFG_MACHINE, "SDL2", "focus_dim", video_focus_dim);
+        config_set_int(CFG_MACHINE, "SDL2", "postproc_filter", video_postproc_filter);
         config_set_int(CFG_MACHINE, "SDL2", "alternative_update_lock", video_alternative_update_lock);
         config_set_string(CFG_MACHINE, "SDL2", "render_driver", (char*)requested_render_driver.sdl_id);
 
@@ -446,6 +448,8 @@ int wx_setupmenu(void* data)
 
         sprintf(menuitem, "IDM_VID_SCALE_MODE[%d]", video_scale_mode);
         wx_checkmenuitem(menu, WX_ID(menuitem), WX_MB_CHECKED);
+        sprintf(menuitem, "IDM_VID_POSTPROC[%d]", video_postproc_filter);
+        wx_checkmenuitem(menu, WX_ID(menuitem), WX_MB_CHECKED);
         sprintf(menuitem, "IDM_VID_SCALE[%d]", video_scale);
         wx_checkmenuitem(menu, WX_ID(menuitem), WX_MB_CHECKED);
         sprintf(menuitem, "IDM_VID_FS_MODE[%d]", video_fullscreen_mode);
@@ -1025,6 +1029,13 @@ int wx_handle_command(void* hwnd, int wParam, int checked)
                 wx_checkmenuitem(hmenu, wParam, WX_MB_CHECKED);
                 saveconfig(NULL);
         }
+        else if (ID_RANGE("IDM_VID_POSTPROC[start]", "IDM_VID_POSTPROC[end]"))
+        {
+                video_postproc_filter = wParam - wx_xrcid("IDM_VID_POSTPROC[start]");
+                renderer_doreset = 1;
+                wx_checkmenuitem(hmenu, wParam, WX_MB_CHECKED);
+                saveconfig(NULL);
+        }
         else if (ID_RANGE("IDM_VID_SCALE[start]", "IDM_VID_SCALE[end]"))
         {
                 video_scale = wParam - wx_xrcid("IDM_VID_SCALE[start]");
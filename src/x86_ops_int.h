@@ -95,6 +95,14 @@ static int opINT(uint32_t fetchdat)
                         fatal("RIGHT\n");
         }*/
 
+        if (cpu_idle_detect)
+        {
+                if (temp == 0x16 && (AH == 0x01 || AH == 0x11))
+                        cpu_idle_poll(CPU_IDLE_POLL_KBD);
+                else if (temp == 0x28)
+                        cpu_idle_poll(CPU_IDLE_POLL_DOS);
+        }
+
         x86_int_sw(temp);
         PREFETCH_RUN(cycles_old-cycles, 2, -1, 0,0,0,0, 0);
         return 1;
@@ -2,7 +2,7 @@ static int opIN_AL_imm(uint32_t fetchdat)
 {       
         uint16_t port = (uint16_t)getbytef();
         check_io_perm(port);
-        AL = inb(port);
+        AL = inb_const(port);
         CLOCK_CYCLES(12);
         PREFETCH_RUN(12, 2, -1, 1,0,0,0, 0);
         if (cpu_state.smi_pending)
@@ -16,7 +16,7 @@ static int opIN_AX_imm(uint32_t fetchdat)
         uint16_t port = (uint16_t)getbytef();
         check_io_perm(port);
         check_io_perm(port + 1);
-        AX = inw(port);
+        AX = inw_const(port);
         CLOCK_CYCLES(12);
         PREFETCH_RUN(12, 2, -1, 1,0,0,0, 0);
         if (cpu_state.smi_pending)
@@ -32,7 +32,7 @@ static int opIN_EAX_imm(uint32_t fetchdat)
         check_io_perm(port + 1);
         check_io_perm(port + 2);
         check_io_perm(port + 3);
-        EAX = inl(port);
+        EAX = inl_const(port);
         CLOCK_CYCLES(12);
         PREFETCH_RUN(12, 2, -1, 0,1,0,0, 0);
         if (cpu_state.smi_pending)
@@ -46,7 +46,7 @@ static int opOUT_AL_imm(uint32_t fetchdat)
 {
         uint16_t port = (uint16_t)getbytef();        
         check_io_perm(port);
-        outb(port, AL);
+        outb_const(port, AL);
         CLOCK_CYCLES(10);
         PREFETCH_RUN(10, 2, -1, 0,0,1,0, 0);
         if (cpu_state.smi_pending)
@@ -62,7 +62,7 @@ static int opOUT_AX_imm(uint32_t fetchdat)
         uint16_t port = (uint16_t)getbytef();        
         check_io_perm(port);
         check_io_perm(port + 1);
-        outw(port, AX);
+        outw_const(port, AX);
         CLOCK_CYCLES(10);
         PREFETCH_RUN(10, 2, -1, 0,0,1,0, 0);
         if (cpu_state.smi_pending)
@@ -78,7 +78,7 @@ static int opOUT_EAX_imm(uint32_t fetchdat)
         check_io_perm(port + 1);
         check_io_perm(port + 2);
         check_io_perm(port + 3);
-        outl(port, EAX);
+        outl_const(port, EAX);
         CLOCK_CYCLES(10);
         PREFETCH_RUN(10, 2, -1, 0,0,0,1, 0);
         if (cpu_state.smi_pending)
@@ -626,7 +626,8 @@ static int opHLT(uint32_t fetchdat)
         }
         if (!((cpu_state.flags & I_FLAG) && pic_intpending))
         {
-                CLOCK_CYCLES_ALWAYS(100);
+                /*Nothing can wake the CPU before the next timer event*/
+                cpu_idle_skip(100);
                 cpu_state.pc--;
         }
         else
@@ -1,4 +1,310 @@
-#define REP_OPS(size, CNT_REG, SRC_REG, DEST_REG) \
+/*Bulk execution of REP string instructions.
+
+  Runs of elements are done directly on host memory when the whole run lies
+  within one page for each operand, both pages are RAM with a cached
+  translation, and the destination passes the limit check the per-element
+  loop would do. Anything else (device memory, uncached translations,
+  elements straddling a page, offset wrap, limit faults) is left to the
+  per-element loop, which also fills the lookup tables for the next run.
+
+  Destination pages holding recompiled code are written through the page's
+  write functions, so the dirty masks are kept exactly as for single writes.
+
+  When using the dynarec, timers are only serviced once cycles runs out, so
+  bulk runs may carry on to that point rather than stopping at the usual
+  per-instruction cycle budget*/
+#define REP_BULK_END(cycles_end) ((is386 && cpu_use_dynarec && !trap && (cycles_end) > 0) ? 0 : (cycles_end))
+
+/*Number of elements, up to count, that can be done before cycles drops
+  below cycles_end. The per-element loop does one more element when cycles
+  is exactly at the limit, so this matches it*/
+static inline uint32_t rep_cycle_limit(uint32_t count, int cyc, int cycles_end)
+{
+        uint32_t n;
+
+        if (cycles < cycles_end)
+                return 0;
+        n = ((cycles - cycles_end) / cyc) + 1;
+        return (n < count) ? n : count;
+}
+
+/*Limit n so that a run of size byte elements starting at linear address
+  addr / offset off stays within one page and doesn't wrap the offset*/
+static inline uint32_t rep_run_length(uint32_t addr, uint32_t off, uint32_t off_mask, int size, int down, uint32_t n)
+{
+        uint32_t page_off = addr & 0xfff;
+        uint32_t max_n, max_off_n;
+
+        if (page_off + size > 0x1000 || (uint64_t)off + size - 1 > off_mask)
+                return 0;
+        if (down)
+        {
+                max_n = (page_off / size) + 1;
+                max_off_n = (off / size) + 1;
+        }
+        else
+        {
+                max_n = (0x1000 - page_off) / size;
+                max_off_n = (uint32_t)(((uint64_t)off_mask + 1 - off) / size);
+        }
+        if (max_off_n < max_n)
+                max_n = max_off_n;
+        return (n < max_n) ? n : max_n;
+}
+
+/*Check every element of a run against CHECK_WRITE_REP(seg, off, off + extra)*/
+static inline int rep_run_in_limit(x86seg *seg, uint32_t off, uint32_t n, int size, int down, int extra)
+{
+        uint32_t lo = down ? (off - (n - 1) * size) : off;
+        uint32_t hi = down ? off : (off + (n - 1) * size);
+
+        return (lo >= seg->limit_low) && (hi + extra <= seg->limit_high);
+}
+
+/*Host address of addr if it is in RAM with a cached read translation*/
+static inline uint8_t *rep_read_host(uint32_t addr)
+{
+        if (readlookup2[addr >> 12] == LOOKUP_INV)
+                return NULL;
+        return (uint8_t *)(readlookup2[addr >> 12] + addr);
+}
+
+/*Host address of addr if it is in RAM with a cached write translation. If
+  the page holds recompiled code, *code_page is set and writes must go
+  through its write functions*/
+static inline uint8_t *rep_write_host(uint32_t addr, page_t **code_page)
+{
+        page_t *p = page_lookup[addr >> 12];
+
+        *code_page = NULL;
+        if (writelookup2[addr >> 12] != LOOKUP_INV)
+                return (uint8_t *)(writelookup2[addr >> 12] + addr);
+        if (p && p->write_b == mem_write_ramb_page)
+        {
+                *code_page = p;
+                return &p->mem[addr & 0xfff];
+        }
+        return NULL;
+}
+
+static inline uint32_t rep_read_element(const uint8_t *s, int size)
+{
+        switch (size)
+        {
+                case 1: return *s;
+                case 2: return *(uint16_t *)s;
+                default: return *(uint32_t *)s;
+        }
+}
+
+static inline void rep_write_element(uint8_t *d, page_t *code_page, uint32_t addr, int size, uint32_t val)
+{
+        if (code_page)
+        {
+                switch (size)
+                {
+                        case 1: code_page->write_b(addr, val, code_page); break;
+                        case 2: code_page->write_w(addr, val, code_page); break;
+                        default: code_page->write_l(addr, val, code_page); break;
+                }
+        }
+        else
+        {
+                switch (size)
+                {
+                        case 1: *d = val; break;
+                        case 2: *(uint16_t *)d = val; break;
+                        default: *(uint32_t *)d = val; break;
+                }
+        }
+}
+
+/*REP MOVS. Returns the number of elements copied, 0 if the next element must
+  use the per-element loop*/
+static int rep_movs_bulk(uint32_t src_base, uint32_t src_off, uint32_t dst_base, uint32_t dst_off,
+                         uint32_t off_mask, uint32_t count, int size, int cyc, int cycles_end)
+{
+        int down = cpu_state.flags & D_FLAG;
+        int step = down ? -size : size;
+        uint32_t src_addr = src_base + src_off, dst_addr = dst_base + dst_off;
+        uint32_t n = rep_cycle_limit(count, cyc, cycles_end);
+        uint32_t c;
+        uint8_t *s, *d;
+        page_t *code_page;
+
+        n = rep_run_length(src_addr, src_off, off_mask, size, down, n);
+        n = rep_run_length(dst_addr, dst_off, off_mask, size, down, n);
+        if (!n || !rep_run_in_limit(&cpu_state.seg_es, dst_off, n, size, down, 0))
+                return 0;
+        s = rep_read_host(src_addr);
+        d = rep_write_host(dst_addr, &code_page);
+        if (!s || !d)
+                return 0;
+
+        if (!code_page)
+        {
+                uint8_t *s_lo = down ? (s - (n - 1) * size) : s;
+                uint8_t *d_lo = down ? (d - (n - 1) * size) : d;
+                uint32_t len = n * size;
+
+                /*memmove() gives the same result as copying one element at a
+                  time unless the destination overlaps source elements that
+                  haven't been read yet*/
+                if (down ? (d_lo >= s_lo || d_lo + len <= s_lo) : (d_lo <= s_lo || d_lo >= s_lo + len))
+                {
+                        memmove(d_lo, s_lo, len);
+                        return n;
+                }
+        }
+        for (c = 0; c < n; c++)
+        {
+                rep_write_element(d, code_page, dst_addr, size, rep_read_element(s, size));
+                s += step;
+                d += step;
+                dst_addr += step;
+        }
+        return n;
+}
+
+/*REP STOS*/
+static int rep_stos_bulk(uint32_t dst_base, uint32_t dst_off, uint32_t off_mask, uint32_t count,
+                         int size, uint32_t val, int cyc, int cycles_end)
+{
+        int down = cpu_state.flags & D_FLAG;
+        int step = down ? -size : size;
+        uint32_t dst_addr = dst_base + dst_off;
+        uint32_t n = rep_cycle_limit(count, cyc, cycles_end);
+        uint32_t c;
+        uint8_t *d;
+        page_t *code_page;
+
+        n = rep_run_length(dst_addr, dst_off, off_mask, size, down, n);
+        if (!n || !rep_run_in_limit(&cpu_state.seg_es, dst_off, n, size, down, size - 1))
+                return 0;
+        d = rep_write_host(dst_addr, &code_page);
+        if (!d)
+                return 0;
+
+        if (!code_page)
+        {
+                if (down)
+                        d -= (n - 1) * size;
+                if (size == 1)
+                        memset(d, val, n);
+                else if (size == 2)
+                {
+                        for (c = 0; c < n; c++)
+                                ((uint16_t *)d)[c] = val;
+                }
+                else
+                {
+                        for (c = 0; c < n; c++)
+                                ((uint32_t *)d)[c] = val;
+                }
+                return n;
+        }
+        for (c = 0; c < n; c++)
+        {
+                rep_write_element(d, code_page, dst_addr, size, val);
+                d += step;
+                dst_addr += step;
+        }
+        return n;
+}
+
+/*REP LODS. Only the last element read is kept*/
+static int rep_lods_bulk(uint32_t src_base, uint32_t src_off, uint32_t off_mask, uint32_t count,
+                         int size, uint32_t *val, int cyc, int cycles_end)
+{
+        int down = cpu_state.flags & D_FLAG;
+        uint32_t src_addr = src_base + src_off;
+        uint32_t n = rep_cycle_limit(count, cyc, cycles_end);
+        uint8_t *s;
+
+        n = rep_run_length(src_addr, src_off, off_mask, size, down, n);
+        if (!n)
+                return 0;
+        s = rep_read_host(src_addr);
+        if (!s)
+                return 0;
+
+        *val = rep_read_element(down ? (s - (n - 1) * size) : (s + (n - 1) * size), size);
+        return n;
+}
+
+/*REP SCAS. Stops after the first element where (element == val) != fv, and
+  returns the last element compared in *last*/
+static int rep_scas_bulk(uint32_t dst_base, uint32_t dst_off, uint32_t off_mask, uint32_t count,
+                         int size, uint32_t val, int fv, uint32_t *last, int cyc, int cycles_end)
+{
+        int down = cpu_state.flags & D_FLAG;
+        int step = down ? -size : size;
+        uint32_t dst_addr = dst_base + dst_off;
+        uint32_t n = rep_cycle_limit(count, cyc, cycles_end);
+        uint32_t c;
+        uint8_t *d;
+
+        n = rep_run_length(dst_addr, dst_off, off_mask, size, down, n);
+        if (!n)
+                return 0;
+        d = rep_read_host(dst_addr);
+        if (!d)
+                return 0;
+
+        if (size == 1 && !down && !fv)
+        {
+                /*REPNE SCASB*/
+                uint8_t *match = memchr(d, val, n);
+
+                if (match)
+                        n = (match - d) + 1;
+                *last = d[n - 1];
+                return n;
+        }
+        for (c = 0; c < n; c++)
+        {
+                *last = rep_read_element(d, size);
+                if ((*last == val) != fv)
+                        return c + 1;
+                d += step;
+        }
+        return n;
+}
+
+/*REP CMPS. Stops after the first pair where (src == dst) != fv*/
+static int rep_cmps_bulk(uint32_t src_base, uint32_t src_off, uint32_t dst_base, uint32_t dst_off,
+                         uint32_t off_mask, uint32_t count, int size, int fv,
+                         uint32_t *last_src, uint32_t *last_dst, int cyc, int cycles_end)
+{
+        int down = cpu_state.flags & D_FLAG;
+        int step = down ? -size : size;
+        uint32_t src_addr = src_base + src_off, dst_addr = dst_base + dst_off;
+        uint32_t n = rep_cycle_limit(count, cyc, cycles_end);
+        uint32_t c;
+        uint8_t *s, *d;
+
+        n = rep_run_length(src_addr, src_off, off_mask, size, down, n);
+        n = rep_run_length(dst_addr, dst_off, off_mask, size, down, n);
+        if (!n)
+                return 0;
+        s = rep_read_host(src_addr);
+        d = rep_read_host(dst_addr);
+        if (!s || !d)
+                return 0;
+
+        for (c = 0; c < n; c++)
+        {
+                *last_src = rep_read_element(s, size);
+                *last_dst = rep_read_element(d, size);
+                if ((*last_src == *last_dst) != fv)
+                        return c + 1;
+                s += step;
+                d += step;
+        }
+        return n;
+}
+
+#define REP_OPS(size, CNT_REG, SRC_REG, DEST_REG, OFF_MASK) \
 static int opREP_INSB_ ## size(uint32_t fetchdat)                               \
 {                                                                               \
         int reads = 0, writes = 0, total_cycles = 0;                            \
@@ -174,9 +480,12 @@ static int opREP_OUTSL_ ## size(uint32_t fetchdat)
 static int opREP_MOVSB_ ## size(uint32_t fetchdat)                              \
 {                                                                               \
         int reads = 0, writes = 0, total_cycles = 0;                            \
+        uint32_t n = 0;                                                         \
+        int bulk_end;                                                           \
         int cycles_end = cycles - ((is386 && cpu_use_dynarec) ? 1000 : 100);    \
         if (trap)                                                               \
                 cycles_end = cycles+1; /*Force the instruction to end after only one iteration when trap flag set*/     \
+        bulk_end = REP_BULK_END(cycles_end);                                    \
         if (CNT_REG > 0)                                                        \
         {                                                                       \
                 SEG_CHECK_READ(cpu_state.ea_seg);                               \
@@ -186,6 +495,21 @@ static int opREP_MOVSB_ ## size(uint32_t fetchdat)
         {                                                                       \
                 uint8_t temp;                                                   \
                                                                                 \
+                n = rep_movs_bulk(cpu_state.ea_seg->base, SRC_REG, es, DEST_REG, OFF_MASK, CNT_REG, 1, is486 ? 3 : 4, bulk_end); \
+                if (n)                                                          \
+                {                                                               \
+                        if (cpu_state.flags & D_FLAG) { DEST_REG -= n; SRC_REG -= n; } \
+                        else                          { DEST_REG += n; SRC_REG += n; } \
+                        reads += n; writes += n;                                \
+                        CNT_REG -= n;                                           \
+                        cycles -= n * (is486 ? 3 : 4);                          \
+                        total_cycles += n * (is486 ? 3 : 4);                    \
+                        ins += n;                                               \
+                        if (cycles < cycles_end)                                \
+                                break;                                          \
+                        continue;                                               \
+                }                                                               \
+                                                                                \
                 CHECK_WRITE_REP(&cpu_state.seg_es, DEST_REG, DEST_REG);         \
                 temp = readmemb(cpu_state.ea_seg->base, SRC_REG); if (cpu_state.abrt) return 1;    \
                 writememb(es, DEST_REG, temp); if (cpu_state.abrt) return 1;       \
@@ -212,9 +536,12 @@ static int opREP_MOVSB_ ## size(uint32_t fetchdat)
 static int opREP_MOVSW_ ## size(uint32_t fetchdat)                              \
 {                                                                               \
         int reads = 0, writes = 0, total_cycles = 0;                            \
+        uint32_t n = 0;                                                         \
+        int bulk_end;                                                           \
         int cycles_end = cycles - ((is386 && cpu_use_dynarec) ? 1000 : 100);    \
         if (trap)                                                               \
                 cycles_end = cycles+1; /*Force the instruction to end after only one iteration when trap flag set*/     \
+        bulk_end = REP_BULK_END(cycles_end);                                    \
         if (CNT_REG > 0)                                                        \
         {                                                                       \
                 SEG_CHECK_READ(cpu_state.ea_seg);                               \
@@ -224,6 +551,21 @@ static int opREP_MOVSW_ ## size(uint32_t fetchdat)
         {                                                                       \
                 uint16_t temp;                                                  \
                                                                                 \
+                n = rep_movs_bulk(cpu_state.ea_seg->base, SRC_REG, es, DEST_REG, OFF_MASK, CNT_REG, 2, is486 ? 3 : 4, bulk_end); \
+                if (n)                                                          \
+                {                                                               \
+                        if (cpu_state.flags & D_FLAG) { DEST_REG -= n * 2; SRC_REG -= n * 2; } \
+                        else                          { DEST_REG += n * 2; SRC_REG += n * 2; } \
+                        reads += n; writes += n;                                \
+                        CNT_REG -= n;                                           \
+                        cycles -= n * (is486 ? 3 : 4);                          \
+                        total_cycles += n * (is486 ? 3 : 4);                    \
+                        ins += n;                                               \
+                        if (cycles < cycles_end)                                \
+                                break;                                          \
+                        continue;                                               \
+                }                                                               \
+                                                                                \
                 CHECK_WRITE_REP(&cpu_state.seg_es, DEST_REG, DEST_REG);         \
                 temp = readmemw(cpu_state.ea_seg->base, SRC_REG); if (cpu_state.abrt) return 1;    \
                 writememw(es, DEST_REG, temp); if (cpu_state.abrt) return 1;       \
@@ -250,9 +592,12 @@ static int opREP_MOVSW_ ## size(uint32_t fetchdat)
 static int opREP_MOVSL_ ## size(uint32_t fetchdat)                              \
 {                                                                               \
         int reads = 0, writes = 0, total_cycles = 0;                            \
+        uint32_t n = 0;                                                         \
+        int bulk_end;                                                           \
         int cycles_end = cycles - ((is386 && cpu_use_dynarec) ? 1000 : 100);    \
         if (trap)                                                               \
                 cycles_end = cycles+1; /*Force the instruction to end after only one iteration when trap flag set*/     \
+        bulk_end = REP_BULK_END(cycles_end);                                    \
         if (CNT_REG > 0)                                                        \
         {                                                                       \
                 SEG_CHECK_READ(cpu_state.ea_seg);                               \
@@ -262,6 +607,21 @@ static int opREP_MOVSL_ ## size(uint32_t fetchdat)
         {                                                                       \
                 uint32_t temp;                                                  \
                                                                                 \
+                n = rep_movs_bulk(cpu_state.ea_seg->base, SRC_REG, es, DEST_REG, OFF_MASK, CNT_REG, 4, is486 ? 3 : 4, bulk_end); \
+                if (n)                                                          \
+                {                                                               \
+                        if (cpu_state.flags & D_FLAG) { DEST_REG -= n * 4; SRC_REG -= n * 4; } \
+                        else                          { DEST_REG += n * 4; SRC_REG += n * 4; } \
+                        reads += n; writes += n;                                \
+                        CNT_REG -= n;                                           \
+                        cycles -= n * (is486 ? 3 : 4);                          \
+                        total_cycles += n * (is486 ? 3 : 4);                    \
+                        ins += n;                                               \
+                        if (cycles < cycles_end)                                \
+                                break;                                          \
+                        continue;                                               \
+                }                                                               \
+                                                                                \
                 CHECK_WRITE_REP(&cpu_state.seg_es, DEST_REG, DEST_REG);         \
                 temp = readmeml(cpu_state.ea_seg->base, SRC_REG); if (cpu_state.abrt) return 1;    \
                 writememl(es, DEST_REG, temp); if (cpu_state.abrt) return 1;       \
@@ -290,13 +650,30 @@ static int opREP_MOVSL_ ## size(uint32_t fetchdat)
 static int opREP_STOSB_ ## size(uint32_t fetchdat)                              \
 {                                                                               \
         int writes = 0, total_cycles = 0;                                       \
+        uint32_t n = 0;                                                         \
+        int bulk_end;                                                           \
         int cycles_end = cycles - ((is386 && cpu_use_dynarec) ? 1000 : 100);    \
         if (trap)                                                               \
                 cycles_end = cycles+1; /*Force the instruction to end after only one iteration when trap flag set*/     \
+        bulk_end = REP_BULK_END(cycles_end);                                    \
         if (CNT_REG > 0)                                                        \
                 SEG_CHECK_WRITE(&cpu_state.seg_es);                             \
         while (CNT_REG > 0)                                                     \
         {                                                                       \
+                n = rep_stos_bulk(es, DEST_REG, OFF_MASK, CNT_REG, 1, AL, is486 ? 4 : 5, bulk_end); \
+                if (n)                                                          \
+                {                                                               \
+                        if (cpu_state.flags & D_FLAG) DEST_REG -= n;            \
+                        else                          DEST_REG += n;            \
+                        writes += n;                                            \
+                        CNT_REG -= n;                                           \
+                        cycles -= n * (is486 ? 4 : 5);                          \
+                        total_cycles += n * (is486 ? 4 : 5);                    \
+                        ins += n;                                               \
+                        if (cycles < cycles_end)                                \
+                                break;                                          \
+                        continue;                                               \
+                }                                                               \
                 CHECK_WRITE_REP(&cpu_state.seg_es, DEST_REG, DEST_REG);         \
                 writememb(es, DEST_REG, AL); if (cpu_state.abrt) return 1;         \
                 if (cpu_state.flags & D_FLAG) DEST_REG--;                                 \
@@ -320,13 +697,30 @@ static int opREP_STOSB_ ## size(uint32_t fetchdat)
 static int opREP_STOSW_ ## size(uint32_t fetchdat)                              \
 {                                                                               \
         int writes = 0, total_cycles = 0;                                       \
+        uint32_t n = 0;                                                         \
+        int bulk_end;                                                           \
         int cycles_end = cycles - ((is386 && cpu_use_dynarec) ? 1000 : 100);    \
         if (trap)                                                               \
                 cycles_end = cycles+1; /*Force the instruction to end after only one iteration when trap flag set*/     \
+        bulk_end = REP_BULK_END(cycles_end);                                    \
         if (CNT_REG > 0)                                                        \
                 SEG_CHECK_WRITE(&cpu_state.seg_es);                             \
         while (CNT_REG > 0)                                                     \
         {                                                                       \
+                n = rep_stos_bulk(es, DEST_REG, OFF_MASK, CNT_REG, 2, AX, is486 ? 4 : 5, bulk_end); \
+                if (n)                                                          \
+                {                                                               \
+                        if (cpu_state.flags & D_FLAG) DEST_REG -= n * 2;        \
+                        else                          DEST_REG += n * 2;        \
+                        writes += n;                                            \
+                        CNT_REG -= n;                                           \
+                        cycles -= n * (is486 ? 4 : 5);                          \
+                        total_cycles += n * (is486 ? 4 : 5);                    \
+                        ins += n;                                               \
+                        if (cycles < cycles_end)                                \
+                                break;                                          \
+                        continue;                                               \
+                }                                                               \
                 CHECK_WRITE_REP(&cpu_state.seg_es, DEST_REG, DEST_REG+1);       \
                 writememw(es, DEST_REG, AX); if (cpu_state.abrt) return 1;         \
                 if (cpu_state.flags & D_FLAG) DEST_REG -= 2;                              \
@@ -350,13 +744,30 @@ static int opREP_STOSW_ ## size(uint32_t fetchdat)
 static int opREP_STOSL_ ## size(uint32_t fetchdat)                              \
 {                                                                               \
         int writes = 0, total_cycles = 0;                                       \
+        uint32_t n = 0;                                                         \
+        int bulk_end;                                                           \
         int cycles_end = cycles - ((is386 && cpu_use_dynarec) ? 1000 : 100);    \
         if (trap)                                                               \
                 cycles_end = cycles+1; /*Force the instruction to end after only one iteration when trap flag set*/     \
+        bulk_end = REP_BULK_END(cycles_end);                                    \
         if (CNT_REG > 0)                                                        \
                 SEG_CHECK_WRITE(&cpu_state.seg_es);                             \
         while (CNT_REG > 0)                                                     \
         {                                                                       \
+                n = rep_stos_bulk(es, DEST_REG, OFF_MASK, CNT_REG, 4, EAX, is486 ? 4 : 5, bulk_end); \
+                if (n)                                                          \
+                {                                                               \
+                        if (cpu_state.flags & D_FLAG) DEST_REG -= n * 4;        \
+                        else                          DEST_REG += n * 4;        \
+                        writes += n;                                            \
+                        CNT_REG -= n;                                           \
+                        cycles -= n * (is486 ? 4 : 5);                          \
+                        total_cycles += n * (is486 ? 4 : 5);                    \
+                        ins += n;                                               \
+                        if (cycles < cycles_end)                                \
+                                break;                                          \
+                        continue;                                               \
+                }                                                               \
                 CHECK_WRITE_REP(&cpu_state.seg_es, DEST_REG, DEST_REG+3);       \
                 writememl(es, DEST_REG, EAX); if (cpu_state.abrt) return 1;        \
                 if (cpu_state.flags & D_FLAG) DEST_REG -= 4;                              \
@@ -381,13 +792,31 @@ static int opREP_STOSL_ ## size(uint32_t fetchdat)
 static int opREP_LODSB_ ## size(uint32_t fetchdat)                              \
 {                                                                               \
         int reads = 0, total_cycles = 0;                                        \
+        uint32_t n = 0, val;                                                    \
+        int bulk_end;                                                           \
         int cycles_end = cycles - ((is386 && cpu_use_dynarec) ? 1000 : 100);    \
         if (trap)                                                               \
                 cycles_end = cycles+1; /*Force the instruction to end after only one iteration when trap flag set*/     \
+        bulk_end = REP_BULK_END(cycles_end);                                    \
         if (CNT_REG > 0)                                                        \
                 SEG_CHECK_READ(cpu_state.ea_seg);                               \
         while (CNT_REG > 0)                                                     \
         {                                                                       \
+                n = rep_lods_bulk(cpu_state.ea_seg->base, SRC_REG, OFF_MASK, CNT_REG, 1, &val, is486 ? 4 : 5, bulk_end); \
+                if (n)                                                          \
+                {                                                               \
+                        AL = val;                                               \
+                        if (cpu_state.flags & D_FLAG) SRC_REG -= n;             \
+                        else                          SRC_REG += n;             \
+                        reads += n;                                             \
+                        CNT_REG -= n;                                           \
+                        cycles -= n * (is486 ? 4 : 5);                          \
+                        total_cycles += n * (is486 ? 4 : 5);                    \
+                        ins += n;                                               \
+                        if (cycles < cycles_end)                                \
+                                break;                                          \
+                        continue;                                               \
+                }                                                               \
                 AL = readmemb(cpu_state.ea_seg->base, SRC_REG); if (cpu_state.abrt) return 1;      \
                 if (cpu_state.flags & D_FLAG) SRC_REG--;                                  \
                 else                          SRC_REG++;                                  \
@@ -410,13 +839,31 @@ static int opREP_LODSB_ ## size(uint32_t fetchdat)
 static int opREP_LODSW_ ## size(uint32_t fetchdat)                              \
 {                                                                               \
         int reads = 0, total_cycles = 0;                                        \
+        uint32_t n = 0, val;                                                    \
+        int bulk_end;                                                           \
         int cycles_end = cycles - ((is386 && cpu_use_dynarec) ? 1000 : 100);    \
         if (trap)                                                               \
                 cycles_end = cycles+1; /*Force the instruction to end after only one iteration when trap flag set*/     \
+        bulk_end = REP_BULK_END(cycles_end);                                    \
         if (CNT_REG > 0)                                                        \
                 SEG_CHECK_READ(cpu_state.ea_seg);                               \
         while (CNT_REG > 0)                                                     \
         {                                                                       \
+                n = rep_lods_bulk(cpu_state.ea_seg->base, SRC_REG, OFF_MASK, CNT_REG, 2, &val, is486 ? 4 : 5, bulk_end); \
+                if (n)                                                          \
+                {                                                               \
+                        AX = val;                                               \
+                        if (cpu_state.flags & D_FLAG) SRC_REG -= n * 2;         \
+                        else                          SRC_REG += n * 2;         \
+                        reads += n;                                             \
+                        CNT_REG -= n;                                           \
+                        cycles -= n * (is486 ? 4 : 5);                          \
+                        total_cycles += n * (is486 ? 4 : 5);                    \
+                        ins += n;                                               \
+                        if (cycles < cycles_end)                                \
+                                break;                                          \
+                        continue;                                               \
+                }                                                               \
                 AX = readmemw(cpu_state.ea_seg->base, SRC_REG); if (cpu_state.abrt) return 1;      \
                 if (cpu_state.flags & D_FLAG) SRC_REG -= 2;                               \
                 else                          SRC_REG += 2;                               \
@@ -439,13 +886,31 @@ static int opREP_LODSW_ ## size(uint32_t fetchdat)
 static int opREP_LODSL_ ## size(uint32_t fetchdat)                              \
 {                                                                               \
         int reads = 0, total_cycles = 0;                                        \
+        uint32_t n = 0, val;                                                    \
+        int bulk_end;                                                           \
         int cycles_end = cycles - ((is386 && cpu_use_dynarec) ? 1000 : 100);    \
         if (trap)                                                               \
                 cycles_end = cycles+1; /*Force the instruction to end after only one iteration when trap flag set*/     \
+        bulk_end = REP_BULK_END(cycles_end);                                    \
         if (CNT_REG > 0)                                                        \
                 SEG_CHECK_READ(cpu_state.ea_seg);                               \
         while (CNT_REG > 0)                                                     \
         {                                                                       \
+                n = rep_lods_bulk(cpu_state.ea_seg->base, SRC_REG, OFF_MASK, CNT_REG, 4, &val, is486 ? 4 : 5, bulk_end); \
+                if (n)                                                          \
+                {                                                               \
+                        EAX = val;                                              \
+                        if (cpu_state.flags & D_FLAG) SRC_REG -= n * 4;         \
+                        else                          SRC_REG += n * 4;         \
+                        reads += n;                                             \
+                        CNT_REG -= n;                                           \
+                        cycles -= n * (is486 ? 4 : 5);                          \
+                        total_cycles += n * (is486 ? 4 : 5);                    \
+                        ins += n;                                               \
+                        if (cycles < cycles_end)                                \
+                                break;                                          \
+                        continue;                                               \
+                }                                                               \
                 EAX = readmeml(cpu_state.ea_seg->base, SRC_REG); if (cpu_state.abrt) return 1;     \
                 if (cpu_state.flags & D_FLAG) SRC_REG -= 4;                               \
                 else                          SRC_REG += 4;                               \
@@ -467,27 +932,50 @@ static int opREP_LODSL_ ## size(uint32_t fetchdat)
 }                                                                               \
 
 
-#define REP_OPS_CMPS_SCAS(size, CNT_REG, SRC_REG, DEST_REG, FV) \
+#define REP_OPS_CMPS_SCAS(size, CNT_REG, SRC_REG, DEST_REG, OFF_MASK, FV) \
 static int opREP_CMPSB_ ## size(uint32_t fetchdat)                              \
 {                                                                               \
         int reads = 0, total_cycles = 0, tempz;                                 \
+        uint32_t n = 0, val, val2;                                              \
+        int cycles_end = cycles - ((is386 && cpu_use_dynarec) ? 1000 : 100);    \
+        int bulk_end;                                                           \
+        if (trap)                                                               \
+                cycles_end = cycles+1; /*Force the instruction to end after only one iteration when trap flag set*/ \
+        bulk_end = REP_BULK_END(cycles_end);                                    \
                                                                                 \
         tempz = FV;                                                             \
         if ((CNT_REG > 0) && (FV == tempz))                                     \
         {                                                                       \
-                uint8_t temp, temp2;                                            \
                 SEG_CHECK_READ(cpu_state.ea_seg);                               \
                 SEG_CHECK_READ(&cpu_state.seg_es);                              \
-                temp = readmemb(cpu_state.ea_seg->base, SRC_REG);               \
-                temp2 = readmemb(es, DEST_REG); if (cpu_state.abrt) return 1;   \
+                n = rep_cmps_bulk(cpu_state.ea_seg->base, SRC_REG, es, DEST_REG, OFF_MASK, CNT_REG, 1, FV, &val, &val2, is486 ? 7 : 9, bulk_end); \
+                if (n)                                                          \
+                {                                                               \
+                        setsub8(val, val2);                                     \
+                        tempz = (ZF_SET()) ? 1 : 0;                             \
+                        if (cpu_state.flags & D_FLAG) { DEST_REG -= n; SRC_REG -= n; } \
+                        else                          { DEST_REG += n; SRC_REG += n; } \
+                        reads += 2 * n;                                         \
+                        ins += n - 1;                                           \
+                        CNT_REG -= n;                                           \
+                        cycles -= n * (is486 ? 7 : 9);                          \
+                        total_cycles += n * (is486 ? 7 : 9);                    \
+                }                                                               \
+                else                                                            \
+                {                                                               \
+                        uint8_t temp, temp2;                                    \
                                                                                 \
-                if (cpu_state.flags & D_FLAG) { DEST_REG--; SRC_REG--; }                  \
-                else                          { DEST_REG++; SRC_REG++; }                  \
-                CNT_REG--;                                                      \
-                cycles -= is486 ? 7 : 9;                                        \
-                reads += 2; total_cycles += is486 ? 7 : 9;                      \
-                setsub8(temp, temp2);                                           \
-                tempz = (ZF_SET()) ? 1 : 0;                                     \
+                        temp = readmemb(cpu_state.ea_seg->base, SRC_REG);       \
+                        temp2 = readmemb(es, DEST_REG); if (cpu_state.abrt) return 1; \
+                                                                                \
+                        if (cpu_state.flags & D_FLAG) { DEST_REG--; SRC_REG--; } \
+                        else                          { DEST_REG++; SRC_REG++; } \
+                        CNT_REG--;                                              \
+                        cycles -= is486 ? 7 : 9;                                \
+                        reads += 2; total_cycles += is486 ? 7 : 9;              \
+                        setsub8(temp, temp2);                                   \
+                        tempz = (ZF_SET()) ? 1 : 0;                             \
+                }                                                               \
         }                                                                       \
         PREFETCH_RUN(total_cycles, 1, -1, reads, 0, 0, 0, 0);                   \
         if ((CNT_REG > 0) && (FV == tempz))                                     \
@@ -501,23 +989,46 @@ static int opREP_CMPSB_ ## size(uint32_t fetchdat)
 static int opREP_CMPSW_ ## size(uint32_t fetchdat)                              \
 {                                                                               \
         int reads = 0, total_cycles = 0, tempz;                                 \
+        uint32_t n = 0, val, val2;                                              \
+        int cycles_end = cycles - ((is386 && cpu_use_dynarec) ? 1000 : 100);    \
+        int bulk_end;                                                           \
+        if (trap)                                                               \
+                cycles_end = cycles+1; /*Force the instruction to end after only one iteration when trap flag set*/ \
+        bulk_end = REP_BULK_END(cycles_end);                                    \
                                                                                 \
         tempz = FV;                                                             \
         if ((CNT_REG > 0) && (FV == tempz))                                     \
         {                                                                       \
-                uint16_t temp, temp2;                                           \
                 SEG_CHECK_READ(cpu_state.ea_seg);                               \
                 SEG_CHECK_READ(&cpu_state.seg_es);                              \
-                temp = readmemw(cpu_state.ea_seg->base, SRC_REG);               \
-                temp2 = readmemw(es, DEST_REG); if (cpu_state.abrt) return 1;   \
+                n = rep_cmps_bulk(cpu_state.ea_seg->base, SRC_REG, es, DEST_REG, OFF_MASK, CNT_REG, 2, FV, &val, &val2, is486 ? 7 : 9, bulk_end); \
+                if (n)                                                          \
+                {                                                               \
+                        setsub16(val, val2);                                    \
+                        tempz = (ZF_SET()) ? 1 : 0;                             \
+                        if (cpu_state.flags & D_FLAG) { DEST_REG -= n * 2; SRC_REG -= n * 2; } \
+                        else                          { DEST_REG += n * 2; SRC_REG += n * 2; } \
+                        reads += 2 * n;                                         \
+                        ins += n - 1;                                           \
+                        CNT_REG -= n;                                           \
+                        cycles -= n * (is486 ? 7 : 9);                          \
+                        total_cycles += n * (is486 ? 7 : 9);                    \
+                }                                                               \
+                else                                                            \
+                {                                                               \
+                        uint16_t temp, temp2;                                   \
                                                                                 \
-                if (cpu_state.flags & D_FLAG) { DEST_REG -= 2; SRC_REG -= 2; }            \
-                else                          { DEST_REG += 2; SRC_REG += 2; }            \
-                CNT_REG--;                                                      \
-                cycles -= is486 ? 7 : 9;                                        \
-                reads += 2; total_cycles += is486 ? 7 : 9;                      \
-                setsub16(temp, temp2);                                          \
-                tempz = (ZF_SET()) ? 1 : 0;                                     \
+                        temp = readmemw(cpu_state.ea_seg->base, SRC_REG);       \
+                        temp2 = readmemw(es, DEST_REG); if (cpu_state.abrt) return 1; \
+                                                                                \
+                        if (cpu_state.flags & D_FLAG) { DEST_REG -= 2; SRC_REG -= 2; } \
+                        else                          { DEST_REG += 2; SRC_REG += 2; } \
+                        CNT_REG--;                                              \
+                        cycles -= is486 ? 7 : 9;                                \
+                        reads += 2; total_cycles += is486 ? 7 : 9;              \
+                        setsub16(temp, temp2);                                  \
+                        tempz = (ZF_SET()) ? 1 : 0;                             \
+                }                                                               \
         }                                                                       \
         PREFETCH_RUN(total_cycles, 1, -1, reads, 0, 0, 0, 0);                   \
         if ((CNT_REG > 0) && (FV == tempz))                                     \
@@ -531,23 +1042,46 @@ static int opREP_CMPSW_ ## size(uint32_t fetchdat)
 static int opREP_CMPSL_ ## size(uint32_t fetchdat)                              \
 {                                                                               \
         int reads = 0,  total_cycles = 0, tempz;                                \
+        uint32_t n = 0, val, val2;                                              \
+        int cycles_end = cycles - ((is386 && cpu_use_dynarec) ? 1000 : 100);    \
+        int bulk_end;                                                           \
+        if (trap)                                                               \
+                cycles_end = cycles+1; /*Force the instruction to end after only one iteration when trap flag set*/ \
+        bulk_end = REP_BULK_END(cycles_end);                                    \
                                                                                 \
         tempz = FV;                                                             \
         if ((CNT_REG > 0) && (FV == tempz))                                     \
         {                                                                       \
-                uint32_t temp, temp2;                                           \
                 SEG_CHECK_READ(cpu_state.ea_seg);                               \
                 SEG_CHECK_READ(&cpu_state.seg_es);                              \
-                temp = readmeml(cpu_state.ea_seg->base, SRC_REG);               \
-                temp2 = readmeml(es, DEST_REG); if (cpu_state.abrt) return 1;   \
+                n = rep_cmps_bulk(cpu_state.ea_seg->base, SRC_REG, es, DEST_REG, OFF_MASK, CNT_REG, 4, FV, &val, &val2, is486 ? 7 : 9, bulk_end); \
+                if (n)                                                          \
+                {                                                               \
+                        setsub32(val, val2);                                    \
+                        tempz = (ZF_SET()) ? 1 : 0;                             \
+                        if (cpu_state.flags & D_FLAG) { DEST_REG -= n * 4; SRC_REG -= n * 4; } \
+                        else                          { DEST_REG += n * 4; SRC_REG += n * 4; } \
+                        reads += 2 * n;                                         \
+                        ins += n - 1;                                           \
+                        CNT_REG -= n;                                           \
+                        cycles -= n * (is486 ? 7 : 9);                          \
+                        total_cycles += n * (is486 ? 7 : 9);                    \
+                }                                                               \
+                else                                                            \
+                {                                                               \
+                        uint32_t temp, temp2;                                   \
                                                                                 \
-                if (cpu_state.flags & D_FLAG) { DEST_REG -= 4; SRC_REG -= 4; }            \
-                else                          { DEST_REG += 4; SRC_REG += 4; }            \
-                CNT_REG--;                                                      \
-                cycles -= is486 ? 7 : 9;                                        \
-                reads += 2; total_cycles += is486 ? 7 : 9;                      \
-                setsub32(temp, temp2);                                          \
-                tempz = (ZF_SET()) ? 1 : 0;                                     \
+                        temp = readmeml(cpu_state.ea_seg->base, SRC_REG);       \
+                        temp2 = readmeml(es, DEST_REG); if (cpu_state.abrt) return 1; \
+                                                                                \
+                        if (cpu_state.flags & D_FLAG) { DEST_REG -= 4; SRC_REG -= 4; } \
+                        else                          { DEST_REG += 4; SRC_REG += 4; } \
+                        CNT_REG--;                                              \
+                        cycles -= is486 ? 7 : 9;                                \
+                        reads += 2; total_cycles += is486 ? 7 : 9;              \
+                        setsub32(temp, temp2);                                  \
+                        tempz = (ZF_SET()) ? 1 : 0;                             \
+                }                                                               \
         }                                                                       \
         PREFETCH_RUN(total_cycles, 1, -1, 0, reads, 0, 0, 0);                   \
         if ((CNT_REG > 0) && (FV == tempz))                                     \
@@ -562,14 +1096,33 @@ static int opREP_CMPSL_ ## size(uint32_t fetchdat)
 static int opREP_SCASB_ ## size(uint32_t fetchdat)                              \
 {                                                                               \
         int reads = 0, total_cycles = 0, tempz;                                 \
+        uint32_t n = 0, val;                                                    \
+        int bulk_end;                                                           \
         int cycles_end = cycles - ((is386 && cpu_use_dynarec) ? 1000 : 100);    \
         if (trap)                                                               \
                 cycles_end = cycles+1; /*Force the instruction to end after only one iteration when trap flag set*/     \
+        bulk_end = REP_BULK_END(cycles_end);                                    \
         tempz = FV;                                                             \
         if ((CNT_REG > 0) && (FV == tempz))                                     \
                 SEG_CHECK_READ(&cpu_state.seg_es);                              \
         while ((CNT_REG > 0) && (FV == tempz))                                  \
         {                                                                       \
+                n = rep_scas_bulk(es, DEST_REG, OFF_MASK, CNT_REG, 1, AL, FV, &val, is486 ? 5 : 8, bulk_end); \
+                if (n)                                                          \
+                {                                                               \
+                        setsub8(AL, val);                                       \
+                        tempz = (ZF_SET()) ? 1 : 0;                             \
+                        if (cpu_state.flags & D_FLAG) DEST_REG -= n;            \
+                        else                          DEST_REG += n;            \
+                        reads += n;                                             \
+                        CNT_REG -= n;                                           \
+                        cycles -= n * (is486 ? 5 : 8);                          \
+                        total_cycles += n * (is486 ? 5 : 8);                    \
+                        ins += n;                                               \
+                        if (cycles < cycles_end)                                \
+                                break;                                          \
+                        continue;                                               \
+                }                                                               \
                 uint8_t temp = readmemb(es, DEST_REG); if (cpu_state.abrt) break;\
                 setsub8(AL, temp);                                              \
                 tempz = (ZF_SET()) ? 1 : 0;                                     \
@@ -595,14 +1148,33 @@ static int opREP_SCASB_ ## size(uint32_t fetchdat)
 static int opREP_SCASW_ ## size(uint32_t fetchdat)                              \
 {                                                                               \
         int reads = 0, total_cycles = 0, tempz;                                 \
+        uint32_t n = 0, val;                                                    \
+        int bulk_end;                                                           \
         int cycles_end = cycles - ((is386 && cpu_use_dynarec) ? 1000 : 100);    \
         if (trap)                                                               \
                 cycles_end = cycles+1; /*Force the instruction to end after only one iteration when trap flag set*/     \
+        bulk_end = REP_BULK_END(cycles_end);                                    \
         tempz = FV;                                                             \
         if ((CNT_REG > 0) && (FV == tempz))                                     \
                 SEG_CHECK_READ(&cpu_state.seg_es);                              \
         while ((CNT_REG > 0) && (FV == tempz))                                  \
         {                                                                       \
+                n = rep_scas_bulk(es, DEST_REG, OFF_MASK, CNT_REG, 2, AX, FV, &val, is486 ? 5 : 8, bulk_end); \
+                if (n)                                                          \
+                {                                                               \
+                        setsub16(AX, val);                                      \
+                        tempz = (ZF_SET()) ? 1 : 0;                             \
+                        if (cpu_state.flags & D_FLAG) DEST_REG -= n * 2;        \
+                        else                          DEST_REG += n * 2;        \
+                        reads += n;                                             \
+                        CNT_REG -= n;                                           \
+                        cycles -= n * (is486 ? 5 : 8);                          \
+                        total_cycles += n * (is486 ? 5 : 8);                    \
+                        ins += n;                                               \
+                        if (cycles < cycles_end)                                \
+                                break;                                          \
+                        continue;                                               \
+                }                                                               \
                 uint16_t temp = readmemw(es, DEST_REG); if (cpu_state.abrt) break;\
                 setsub16(AX, temp);                                             \
                 tempz = (ZF_SET()) ? 1 : 0;                                     \
@@ -628,14 +1200,33 @@ static int opREP_SCASW_ ## size(uint32_t fetchdat)
 static int opREP_SCASL_ ## size(uint32_t fetchdat)                              \
 {                                                                               \
         int reads = 0, total_cycles = 0, tempz;                                 \
+        uint32_t n = 0, val;                                                    \
+        int bulk_end;                                                           \
         int cycles_end = cycles - ((is386 && cpu_use_dynarec) ? 1000 : 100);    \
         if (trap)                                                               \
                 cycles_end = cycles+1; /*Force the instruction to end after only one iteration when trap flag set*/     \
+        bulk_end = REP_BULK_END(cycles_end);                                    \
         tempz = FV;                                                             \
         if ((CNT_REG > 0) && (FV == tempz))                                     \
                 SEG_CHECK_READ(&cpu_state.seg_es);                              \
         while ((CNT_REG > 0) && (FV == tempz))                                  \
         {                                                                       \
+                n = rep_scas_bulk(es, DEST_REG, OFF_MASK, CNT_REG, 4, EAX, FV, &val, is486 ? 5 : 8, bulk_end); \
+                if (n)                                                          \
+                {                                                               \
+                        setsub32(EAX, val);                                     \
+                        tempz = (ZF_SET()) ? 1 : 0;                             \
+                        if (cpu_state.flags & D_FLAG) DEST_REG -= n * 4;        \
+                        else                          DEST_REG += n * 4;        \
+                        reads += n;                                             \
+                        CNT_REG -= n;                                           \
+                        cycles -= n * (is486 ? 5 : 8);                          \
+                        total_cycles += n * (is486 ? 5 : 8);                    \
+                        ins += n;                                               \
+                        if (cycles < cycles_end)                                \
+                                break;                                          \
+                        continue;                                               \
+                }                                                               \
                 uint32_t temp = readmeml(es, DEST_REG); if (cpu_state.abrt) break;\
                 setsub32(EAX, temp);                                            \
                 tempz = (ZF_SET()) ? 1 : 0;                                     \
@@ -659,12 +1250,12 @@ static int opREP_SCASL_ ## size(uint32_t fetchdat)
         return cpu_state.abrt;                                                  \
 }
 
-REP_OPS(a16, CX, SI, DI)
-REP_OPS(a32, ECX, ESI, EDI)
-REP_OPS_CMPS_SCAS(a16_NE, CX, SI, DI, 0)
-REP_OPS_CMPS_SCAS(a16_E,  CX, SI, DI, 1)
-REP_OPS_CMPS_SCAS(a32_NE, ECX, ESI, EDI, 0)
-REP_OPS_CMPS_SCAS(a32_E,  ECX, ESI, EDI, 1)
+REP_OPS(a16, CX, SI, DI, 0xffff)
+REP_OPS(a32, ECX, ESI, EDI, 0xffffffff)
+REP_OPS_CMPS_SCAS(a16_NE, CX, SI, DI, 0xffff, 0)
+REP_OPS_CMPS_SCAS(a16_E,  CX, SI, DI, 0xffff, 1)
+REP_OPS_CMPS_SCAS(a32_NE, ECX, ESI, EDI, 0xffffffff, 0)
+REP_OPS_CMPS_SCAS(a32_E,  ECX, ESI, EDI, 0xffffffff, 1)
 
 static int opREPNE(uint32_t fetchdat)
 {
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include <stdarg.h>
 #include <stdlib.h>
+#include <string.h>
 #include "ibm.h"
 #include "mem.h"
 #include "x86.h"
@@ -265,6 +266,44 @@ static void do_seg_v86_init(x86seg *s)
         s->limit_high = 0xffff;
 }
 
+/*Read the 8 byte descriptor at linear address addr into segdat. When the soft
+  TLB has a read translation for the page and the descriptor doesn't cross a
+  page boundary, this is a single host read instead of four readmemw()s.
+  Returns non-zero on abort*/
+static inline int read_descriptor(uint32_t addr, uint16_t *segdat)
+{
+        uintptr_t lookup = readlookup2[addr >> 12];
+
+        if (lookup != LOOKUP_INV && (addr & 0xfff) <= 0xff8)
+        {
+                memcpy(segdat, (uint8_t *)(lookup + addr), 8);
+                return 0;
+        }
+
+        cpl_override=1;
+        segdat[0]=readmemw(0,addr);
+        segdat[1]=readmemw(0,addr+2);
+        segdat[2]=readmemw(0,addr+4);
+        segdat[3]=readmemw(0,addr+6);
+        cpl_override=0;
+
+        return cpu_state.abrt;
+}
+
+/*Set the accessed bit of the descriptor at linear address addr. Reloading a
+  selector whose descriptor is already marked accessed is the common case, and
+  skipping the write there avoids a trip through the write path (and the code
+  page checks) on every segment load*/
+static inline void set_descriptor_accessed(uint32_t addr, uint16_t *segdat)
+{
+        if (!(segdat[2] & 0x100))
+        {
+                cpl_override = 1;
+                writememw(0, addr+4, segdat[2] | 0x100);
+                cpl_override = 0;
+        }
+}
+
 static void check_seg_valid(x86seg *s)
 {
         int dpl = (s->access >> 5) & 3;
@@ -368,11 +407,7 @@ int loadseg(uint16_t seg, x86seg *s)
                         }
                         addr+=gdt.base;
                 }
-                cpl_override=1;
-                segdat[0]=readmemw(0,addr);
-                segdat[1]=readmemw(0,addr+2);
-                segdat[2]=readmemw(0,addr+4);
-                segdat[3]=readmemw(0,addr+6); cpl_override=0; if (cpu_state.abrt) return 1;
+                if (read_descriptor(addr, segdat)) return 1;
                 dpl=(segdat[2]>>13)&3;
                 if (s==&cpu_state.seg_ss)
                 {
@@ -448,9 +483,7 @@ int loadseg(uint16_t seg, x86seg *s)
                 {
 #endif                   
 #ifdef SEL_ACCESSED         
-                        cpl_override = 1;
-                        writememw(0, addr+4, segdat[2] | 0x100); /*Set accessed bit*/
-                        cpl_override = 0;
+                        set_descriptor_accessed(addr, segdat);
 #endif
 #ifndef CS_ACCESSED
                 }
@@ -538,11 +571,7 @@ void loadcs(uint16_t seg)
                         }
                         addr+=gdt.base;
                 }
-                cpl_override=1;
-                segdat[0]=readmemw(0,addr);
-                segdat[1]=readmemw(0,addr+2);
-                segdat[2]=readmemw(0,addr+4);
-                segdat[3]=readmemw(0,addr+6); cpl_override=0; if (cpu_state.abrt) return;
+                if (read_descriptor(addr, segdat)) return;
                 if (optype==JMP) pclog("Code seg - %04X - %04X %04X %04X %04X\n",seg,segdat[0],segdat[1],segdat[2],segdat[3]);
 //                if (!(segdat[2]&0x8000)) x86abort("Code segment not present!\n");
 //                if (output) pclog("Segdat2 %04X\n",segdat[2]);
@@ -580,9 +609,7 @@ void loadcs(uint16_t seg)
                         oldcpl = CPL;
 
 #ifdef CS_ACCESSED                        
-                        cpl_override = 1;
-                        writememw(0, addr+4, segdat[2] | 0x100); /*Set accessed bit*/
-                        cpl_override = 0;
+                        set_descriptor_accessed(addr, segdat);
 #endif
 //                        if (output) pclog("Load CS %08X\n",_cs.base);
 //                        CS=(CS&0xFFFC)|((_cs.access>>5)&3);
@@ -658,11 +685,7 @@ void loadcsjmp(uint16_t seg, uint32_t old_pc)
                         }
                         addr+=gdt.base;
                 }
-                cpl_override=1;
-                segdat[0]=readmemw(0,addr);
-                segdat[1]=readmemw(0,addr+2);
-                segdat[2]=readmemw(0,addr+4);
-                segdat[3]=readmemw(0,addr+6); cpl_override=0; if (cpu_state.abrt) return;
+                if (read_descriptor(addr, segdat)) return;
                 if (output) pclog("%04X %04X %04X %04X\n",segdat[0],segdat[1],segdat[2],segdat[3]);
                 if (segdat[2]&0x1000) /*Normal code segment*/
                 {
@@ -693,9 +716,7 @@ void loadcsjmp(uint16_t seg, uint32_t old_pc)
                         set_use32(segdat[3]&0x40);
 
 #ifdef CS_ACCESSED                        
-                        cpl_override = 1;
-                        writememw(0, addr+4, segdat[2] | 0x100); /*Set accessed bit*/
-                        cpl_override = 0;
+                        set_descriptor_accessed(addr, segdat);
 #endif
                         
                         CS = (seg & ~3) | CPL;
@@ -776,11 +797,7 @@ void loadcsjmp(uint16_t seg, uint32_t old_pc)
                                         }
                                         addr+=gdt.base;
                                 }
-                                cpl_override=1;
-                                segdat[0]=readmemw(0,addr);
-                                segdat[1]=readmemw(0,addr+2);
-                                segdat[2]=readmemw(0,addr+4);
-                                segdat[3]=readmemw(0,addr+6); cpl_override=0; if (cpu_state.abrt) return;
+                                if (read_descriptor(addr, segdat)) return;
 
                                 if (DPL > CPL)
                                 {
@@ -812,9 +829,7 @@ void loadcsjmp(uint16_t seg, uint32_t old_pc)
                                         cpu_state.pc=newpc;
 
 #ifdef CS_ACCESSED                                                
-                                        cpl_override = 1;
-                                        writememw(0, addr+4, segdat[2] | 0x100); /*Set accessed bit*/
-                                        cpl_override = 0;
+                                        set_descriptor_accessed(addr, segdat);
 #endif
                                         break;
 
@@ -982,11 +997,7 @@ void loadcscall(uint16_t seg, uint32_t old_pc)
                         }
                         addr+=gdt.base;
                 }
-                cpl_override=1;
-                segdat[0]=readmemw(0,addr);
-                segdat[1]=readmemw(0,addr+2);
-                segdat[2]=readmemw(0,addr+4);
-                segdat[3]=readmemw(0,addr+6); cpl_override=0; if (cpu_state.abrt) return;
+                if (read_descriptor(addr, segdat)) return;
                 type=segdat[2]&0xF00;
                 newpc=segdat[0];
                 if (type&0x800) newpc|=segdat[3]<<16;
@@ -1024,9 +1035,7 @@ void loadcscall(uint16_t seg, uint32_t old_pc)
                         set_use32(segdat[3]&0x40);
 
 #ifdef CS_ACCESSED                        
-                        cpl_override = 1;
-                        writememw(0, addr+4, segdat[2] | 0x100); /*Set accessed bit*/
-                        cpl_override = 0;
+                        set_descriptor_accessed(addr, segdat);
 #endif
                         
                         /*Conforming segments don't change CPL, so preserve existing CPL*/
@@ -1110,11 +1119,7 @@ void loadcscall(uint16_t seg, uint32_t old_pc)
                                         }
                                         addr+=gdt.base;
                                 }
-                                cpl_override=1;
-                                segdat[0]=readmemw(0,addr);
-                                segdat[1]=readmemw(0,addr+2);
-                                segdat[2]=readmemw(0,addr+4);
-                                segdat[3]=readmemw(0,addr+6); cpl_override=0; if (cpu_state.abrt) return;
+                                if (read_descriptor(addr, segdat)) return;
                                 
                                 if (output) pclog("Code seg2 call - %04X - %04X %04X %04X\n",seg2,segdat[0],segdat[1],segdat[2]);
                                 
@@ -1222,9 +1227,7 @@ void loadcscall(uint16_t seg, uint32_t old_pc)
                                                 if (output) pclog("Set access 1\n");
 
 #ifdef SEL_ACCESSED                                                
-                                                cpl_override = 1;
-                                                writememw(0, addr+4, segdat2[2] | 0x100); /*Set accessed bit*/
-                                                cpl_override = 0;
+                                                set_descriptor_accessed(addr, segdat2);
 #endif
                                                 
                                                 CS=seg2;
@@ -1237,9 +1240,7 @@ void loadcscall(uint16_t seg, uint32_t old_pc)
                                                 if (output) pclog("Set access 2\n");
                                                 
 #ifdef CS_ACCESSED
-                                                cpl_override = 1;
-                                                writememw(0, oaddr+4, segdat[2] | 0x100); /*Set accessed bit*/
-                                                cpl_override = 0;
+                                                set_descriptor_accessed(oaddr, segdat);
 #endif
                         
                                                 if (output) pclog("Type %04X\n",type);
@@ -1330,9 +1331,7 @@ void loadcscall(uint16_t seg, uint32_t old_pc)
                                         cpu_state.pc=newpc;
 
 #ifdef CS_ACCESSED                                                
-                                        cpl_override = 1;
-                                        writememw(0, addr+4, segdat[2] | 0x100); /*Set accessed bit*/
-                                        cpl_override = 0;
+                                        set_descriptor_accessed(addr, segdat);
 #endif
                                         cycles -= timing_call_pm_gate;
                                         break;
@@ -1442,11 +1441,7 @@ void pmoderetf(int is32, uint16_t off)
                 }
                 addr+=gdt.base;
         }
-        cpl_override=1;
-        segdat[0]=readmemw(0,addr);
-        segdat[1]=readmemw(0,addr+2);
-        segdat[2]=readmemw(0,addr+4);
-        segdat[3]=readmemw(0,addr+6); cpl_override=0; if (cpu_state.abrt) { ESP=oldsp; return; }
+        if (read_descriptor(addr, segdat)) { ESP=oldsp; return; }
         oaddr = addr;
         
         if (output) pclog("CPL %i RPL %i %i\n",CPL,seg&3,is32);
@@ -1491,9 +1486,7 @@ void pmoderetf(int is32, uint16_t off)
                 }
                 
 #ifdef CS_ACCESSED
-                cpl_override = 1;
-                writememw(0, addr+4, segdat[2] | 0x100); /*Set accessed bit*/
-                cpl_override = 0;
+                set_descriptor_accessed(addr, segdat);
 #endif
                                 
                 cpu_state.pc=newpc;
@@ -1592,11 +1585,7 @@ void pmoderetf(int is32, uint16_t off)
                         }
                         addr+=gdt.base;
                 }
-                cpl_override=1;
-                segdat2[0]=readmemw(0,addr);
-                segdat2[1]=readmemw(0,addr+2);
-                segdat2[2]=readmemw(0,addr+4);
-                segdat2[3]=readmemw(0,addr+6); cpl_override=0; if (cpu_state.abrt) { ESP=oldsp; return; }
+                if (read_descriptor(addr, segdat2)) { ESP=oldsp; return; }
                 if (output) pclog("Segment data %04X %04X %04X %04X\n", segdat2[0], segdat2[1], segdat2[2], segdat2[3]);
 //                if (((newss & 3) != DPL) || (DPL2 != DPL))
                 if ((newss & 3) != (seg & 3))
@@ -1717,11 +1706,7 @@ void pmodeint(int num, int soft)
                 return;
         }
         addr+=idt.base;
-        cpl_override=1;
-        segdat[0]=readmemw(0,addr);
-        segdat[1]=readmemw(2,addr);
-        segdat[2]=readmemw(4,addr);
-        segdat[3]=readmemw(6,addr); cpl_override=0; if (cpu_state.abrt) { pclog("Abrt reading from %08X\n",addr); return; }
+        if (read_descriptor(addr, segdat)) { pclog("Abrt reading from %08X\n",addr); return; }
         oaddr = addr;
 
         if (output) pclog("Addr %08X seg %04X %04X %04X %04X\n",addr,segdat[0],segdat[1],segdat[2],segdat[3]);
@@ -1784,11 +1769,7 @@ void pmodeint(int num, int soft)
                                 x86gpf(NULL,seg&~3);
                                 return;
                         }*/
-                        cpl_override=1;
-                        segdat2[0]=readmemw(0,addr);
-                        segdat2[1]=readmemw(0,addr+2);
-                        segdat2[2]=readmemw(0,addr+4);
-                        segdat2[3]=readmemw(0,addr+6); cpl_override=0; if (cpu_state.abrt) return;
+                        if (read_descriptor(addr, segdat2)) return;
                         oaddr = addr;
                         
                         if (DPL2 > CPL)
@@ -1859,11 +1840,7 @@ void pmodeint(int num, int soft)
                                                 }
                                                 addr+=gdt.base;
                                         }
-                                        cpl_override=1;
-                                        segdat3[0]=readmemw(0,addr);
-                                        segdat3[1]=readmemw(0,addr+2);
-                                        segdat3[2]=readmemw(0,addr+4);
-                                        segdat3[3]=readmemw(0,addr+6); cpl_override=0; if (cpu_state.abrt) return;
+                                        if (read_descriptor(addr, segdat3)) return;
                                         if (((newss & 3) != DPL2) || (DPL3 != DPL2))
                                         {
                                                 pclog("Int gate loading SS with wrong permissions\n");
@@ -1889,9 +1866,7 @@ void pmodeint(int num, int soft)
                                         do_seg_load(&cpu_state.seg_ss, segdat3);
 
 #ifdef CS_ACCESSED                                        
-                                        cpl_override = 1;
-                                        writememw(0, addr+4, segdat3[2] | 0x100); /*Set accessed bit*/
-                                        cpl_override = 0;
+                                        set_descriptor_accessed(addr, segdat3);
 #endif
                                         
                                         if (output) pclog("New stack %04X:%08X\n",SS,ESP);
@@ -1992,9 +1967,7 @@ void pmodeint(int num, int soft)
 //                pclog("Int gate done!\n");
 
 #ifdef CS_ACCESSED
-                cpl_override = 1;
-                writememw(0, oaddr+4, segdat2[2] | 0x100); /*Set accessed bit*/
-                cpl_override = 0;
+                set_descriptor_accessed(oaddr, segdat2);
 #endif
                         
                 cpu_state.eflags &= ~VM_FLAG;
@@ -2248,11 +2221,7 @@ void pmodeiret(int is32)
                 x86gpf(NULL,seg&~3);
                 return;
         }
-        cpl_override=1;
-        segdat[0]=readmemw(0,addr);
-        segdat[1]=readmemw(0,addr+2);
-        segdat[2]=readmemw(0,addr+4);
-        segdat[3]=readmemw(0,addr+6); cpl_override=0; if (cpu_state.abrt) { ESP = oldsp; return; }
+        if (read_descriptor(addr, segdat)) { ESP = oldsp; return; }
 //        pclog("Seg type %04X %04X\n",segdat[2]&0x1F00,segdat[2]);
         
         switch (segdat[2]&0x1F00)
@@ -2304,9 +2273,7 @@ void pmodeiret(int is32)
                 set_use32(segdat[3]&0x40);
 
 #ifdef CS_ACCESSED                
-                cpl_override = 1;
-                writememw(0, addr+4, segdat[2] | 0x100); /*Set accessed bit*/
-                cpl_override = 0;
+                set_descriptor_accessed(addr, segdat);
 #endif
                 cycles -= timing_iret_pm;
         }
@@ -2357,11 +2324,7 @@ void pmodeiret(int is32)
                         }
                         addr+=gdt.base;
                 }
-                cpl_override=1;
-                segdat2[0]=readmemw(0,addr);
-                segdat2[1]=readmemw(0,addr+2);
-                segdat2[2]=readmemw(0,addr+4);
-                segdat2[3]=readmemw(0,addr+6); cpl_override=0; if (cpu_state.abrt) { ESP = oldsp; return; }
+                if (read_descriptor(addr, segdat2)) { ESP = oldsp; return; }
 //                pclog("IRET SS sd2 %04X\n",segdat2[2]);
 //                if (((newss & 3) != DPL) || (DPL2 != DPL))
                 if ((newss & 3) != (seg & 3))